@@ -88,6 +88,10 @@ $(is_gnu_source),_GNU_SOURCE,)
 CPPFLAGS += $(addprefix -I,$(include_dirs:/.=))
 CPPFLAGS += $(addprefix -D,$(cpp_symbols))
 
+# Add tracing policy flag to CPPFLAGS (tracing is off by default for
+# Minimal, Release and Small builds)
+CPPFLAGS += $(if $(filter false,$(WITH_TRACING)),-DNETWORK_NO_TRACING,)
+
 # CXX_ASFLAGS
 
 # CXXFLAGS
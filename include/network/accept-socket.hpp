@@ -17,11 +17,13 @@
 #define NETWORK_ACCEPT_SOCKET_HPP
 
 #include "network/socket.hpp"           // Socket
+#include "network/socketslab.hpp"       // SocketSlab
 #include "network/uniquesocket.hpp"     // UniqueSocket
 
 namespace Network
 {
     extern auto accept(const Socket& s) -> UniqueSocket;
+    extern auto accept(const Socket& s, SocketSlab& slab) -> UniqueSocket;
 }
 
 #endif
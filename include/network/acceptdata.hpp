@@ -16,15 +16,15 @@
 #ifndef NETWORK_ACCEPTDATA_HPP
 #define NETWORK_ACCEPTDATA_HPP
 
-#include "network/bytestring.hpp"       // ByteString
 #include "network/handle-type.hpp"      // handle_type
+#include "network/sockaddrstorage.hpp"  // SockAddrStorage
 #include "network/socketcore.hpp"       // SocketCore
 
 namespace Network
 {
     struct AcceptData
     {
-        AcceptData(const ByteString& t_nm,
+        AcceptData(const SockAddrStorage& t_nm,
                    const SocketCore& t_sc,
                    handle_type t_handle);
 
@@ -36,11 +36,11 @@ namespace Network
         auto operator=(AcceptData&&) noexcept -> AcceptData& = default;
 
         [[nodiscard]] auto core() const noexcept -> const SocketCore&;
-        [[nodiscard]] auto name() const noexcept -> const ByteString&;
+        [[nodiscard]] auto name() const noexcept -> const SockAddrStorage&;
 
     private:
         SocketCore m_sc;
-        ByteString m_nm;
+        SockAddrStorage m_nm;
     };
 }
 
@@ -17,10 +17,10 @@
 #define NETWORK_ADDRESS_HPP
 
 #include "network/bytespan.hpp"                 // ByteSpan
-#include "network/bytestring.hpp"               // ByteString
 #include "network/family-type.hpp"              // family_type
 #include "network/os-features.hpp"              // HAVE_SOCKADDR_SA_LEN
 #include "network/port-type.hpp"                // port_type
+#include "network/sockaddrstorage.hpp"          // SockAddrStorage
 
 #ifdef HAVE_SOCKADDR_SA_LEN
 #include "network/socket-length-type.hpp"       // socket_length_type
@@ -48,7 +48,7 @@ namespace Network
             std::ostream&;
 
     public:
-        using address_type = ByteString;
+        using address_type = SockAddrStorage;
 
         explicit Address(ByteSpan t_bs);
 
@@ -87,7 +87,6 @@ namespace Network
 
     private:
         address_type m_addr;
-        ByteSpan m_span;
     };
 
     extern auto operator<<(std::ostream& os,
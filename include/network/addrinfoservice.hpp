@@ -0,0 +1,48 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_ADDRINFOSERVICE_HPP
+#define NETWORK_ADDRINFOSERVICE_HPP
+
+#include "network/hostnameview.hpp"     // HostnameView
+#include "network/nameservice.hpp"      // NameService
+#include "network/optionalhints.hpp"    // OptionalHints
+#include "network/resolveresult.hpp"    // ResolveResult
+#include "network/runtime.hpp"          // Runtime
+#include "network/serviceview.hpp"      // ServiceView
+
+namespace Network
+{
+    class AddrinfoService final : public NameService
+    {
+    public:
+        AddrinfoService() noexcept = default;
+        AddrinfoService(const AddrinfoService&) noexcept = delete;
+        AddrinfoService(AddrinfoService&&) noexcept = delete;
+        ~AddrinfoService() noexcept final = default;
+        auto operator=(const AddrinfoService&) noexcept ->
+            AddrinfoService& = delete;
+        auto operator=(AddrinfoService&&) noexcept ->
+            AddrinfoService& = delete;
+
+        [[nodiscard]] auto lookup(const HostnameView& t_hostname,
+                                  const ServiceView& t_service,
+                                  const OptionalHints& t_hints,
+                                  const Runtime* t_rt) const ->
+            ResolveResult final;
+    };
+}
+
+#endif
@@ -17,7 +17,12 @@
 #define NETWORK_APIOPTIONS_HPP
 
 #include "network/failmode.hpp"                 // FailMode
+#include "network/iomode.hpp"                   // IoMode
 #include "network/optionalversion.hpp"          // OptionalVersion
+#include "network/sharedresolver.hpp"           // SharedResolver
+#include "network/sharedtracer.hpp"             // SharedTracer
+
+#include <utility>      // std::move()
 
 namespace Network
 {
@@ -39,6 +44,23 @@ namespace Network
         {
         }
 
+        ApiOptions(IoMode t_io_mode,
+                   bool t_is_verbose) noexcept :
+            m_io_mode(t_io_mode),
+            m_is_verbose(t_is_verbose)
+        {
+        }
+
+        explicit ApiOptions(SharedTracer t_tracer) noexcept :
+            m_tracer(std::move(t_tracer))
+        {
+        }
+
+        explicit ApiOptions(SharedResolver t_resolver) noexcept :
+            m_resolver(std::move(t_resolver))
+        {
+        }
+
         explicit ApiOptions(bool t_is_verbose) noexcept :
             m_is_verbose(t_is_verbose)
         {
@@ -61,15 +83,74 @@ namespace Network
             return m_fail_mode;
         }
 
+        // Only an IoEngine created with the runtime reads the mode.
+        // Programs that call the Socket members or the free functions
+        // must move their I/O onto an IoEngine to use a ring.
+        [[nodiscard]] auto io_mode() const noexcept -> IoMode
+        {
+            return m_io_mode;
+        }
+
         [[nodiscard]] auto is_verbose() const noexcept -> bool
         {
             return m_is_verbose;
         }
 
+        [[nodiscard]] auto resolver() const noexcept -> SharedResolver
+        {
+            return m_resolver;
+        }
+
+        [[nodiscard]] auto tracer() const noexcept -> SharedTracer
+        {
+            return m_tracer;
+        }
+
+        // Setters return the options, so that calls can be chained to
+        // combine settings no single constructor takes.
+        auto set_version(OptionalVersion t_version) noexcept -> ApiOptions&
+        {
+            m_version = t_version;
+            return *this;
+        }
+
+        auto set_fail_mode(FailMode t_fail_mode) noexcept -> ApiOptions&
+        {
+            m_fail_mode = t_fail_mode;
+            return *this;
+        }
+
+        auto set_io_mode(IoMode t_io_mode) noexcept -> ApiOptions&
+        {
+            m_io_mode = t_io_mode;
+            return *this;
+        }
+
+        auto set_verbose(bool t_is_verbose) noexcept -> ApiOptions&
+        {
+            m_is_verbose = t_is_verbose;
+            return *this;
+        }
+
+        auto set_resolver(SharedResolver t_resolver) noexcept -> ApiOptions&
+        {
+            m_resolver = std::move(t_resolver);
+            return *this;
+        }
+
+        auto set_tracer(SharedTracer t_tracer) noexcept -> ApiOptions&
+        {
+            m_tracer = std::move(t_tracer);
+            return *this;
+        }
+
     private:
         FailMode m_fail_mode {FailMode::throw_error};
+        IoMode m_io_mode {IoMode::standard};
         bool m_is_verbose {false};
         OptionalVersion m_version;
+        SharedResolver m_resolver;
+        SharedTracer m_tracer;
     };
 }
 
@@ -0,0 +1,172 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_BASICSOCKET_HPP
+#define NETWORK_BASICSOCKET_HPP
+
+#include "network/acceptdata.hpp"       // AcceptData
+#include "network/bytespan.hpp"         // ByteSpan
+#include "network/charspan.hpp"         // CharSpan
+#include "network/datagramdata.hpp"     // DatagramData
+#include "network/family-type.hpp"      // family_type
+#include "network/handle-null.hpp"      // handle_null
+#include "network/handle-type.hpp"      // handle_type
+#include "network/logicerror.hpp"       // LogicError
+#include "network/opensymbol.hpp"       // OpenSymbol
+#include "network/os-features.hpp"      // HAVE_SENDFILE
+#include "network/oserror.hpp"          // OsError
+#include "network/pathname.hpp"         // Pathname
+#include "network/runtime.hpp"          // Runtime
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/socketdata.hpp"       // SocketData
+#include "network/symbol.hpp"           // Symbol
+#include "network/to-bytestring.hpp"    // to_bytestring()
+
+#ifdef _WIN32
+#include <winsock2.h>       // AF_INET, AF_INET6
+#else
+#include <sys/socket.h>     // AF_INET, AF_INET6, AF_UNIX
+#endif
+#include <sys/types.h>      // off_t, ssize_t
+
+#include <cstddef>      // std::size_t
+#include <optional>     // std::optional
+#include <span>         // std::span
+#include <string_view>  // std::string_view
+#include <type_traits>  // std::conditional_t
+
+namespace Network
+{
+    // A movable, non-polymorphic socket for a single address family,
+    // fixed at compile time.  It owns its descriptor like the Socket
+    // implementations do, but its calls are not virtual, and it can
+    // be stored by value in contiguous containers.  A default-
+    // constructed or moved-from socket is closed.
+    template <family_type Family>
+    class BasicSocket
+    {
+    public:
+        static constexpr family_type family {Family};
+
+        BasicSocket(handle_type t_handle, const Runtime* t_rt);
+        explicit BasicSocket(const AcceptData& t_ad);
+        explicit BasicSocket(const SocketData& t_sd);
+
+        BasicSocket() noexcept = default;
+        BasicSocket(const BasicSocket&) = delete;
+        BasicSocket(BasicSocket&& t_socket) noexcept;
+        ~BasicSocket() noexcept;
+        auto operator=(const BasicSocket&) -> BasicSocket& = delete;
+        auto operator=(BasicSocket&& t_socket) noexcept -> BasicSocket&;
+
+        explicit operator handle_type() const noexcept
+        {
+            return m_sd ? m_sd->core().handle() : handle_null;
+        }
+
+        [[nodiscard]] auto accept() const -> AcceptData;
+        auto close() noexcept -> OsError;
+
+        [[nodiscard]] auto core() const -> const SocketCore&
+        {
+            if (!m_sd) {
+                throw LogicError {"Socket is closed"};
+            }
+
+            return m_sd->core();
+        }
+
+        [[nodiscard]] auto get_name(Symbol t_symbol) const -> ByteSpan;
+
+        [[nodiscard]] auto is_open() const noexcept -> bool
+        {
+            return m_sd.has_value();
+        }
+
+        [[nodiscard]] auto listen(int t_backlog) const -> OsError;
+        [[nodiscard]] auto open(ByteSpan t_bs, OpenSymbol t_symbol) ->
+            OsError;
+        [[nodiscard]] auto read(CharSpan t_cs) const -> ssize_t;
+        [[nodiscard]] auto read(std::span<const CharSpan> t_css) const ->
+            ssize_t;
+        [[nodiscard]] auto receive_from(CharSpan t_cs) const ->
+            DatagramData;
+        [[nodiscard]] auto release() noexcept -> handle_type;
+#ifdef HAVE_SENDFILE
+        [[nodiscard]] auto send_file(handle_type t_handle,
+                                     off_t t_offset,
+                                     std::size_t t_length) const ->
+            ssize_t;
+        [[nodiscard]] auto send_file(const Pathname& t_path,
+                                     off_t t_offset,
+                                     std::size_t t_length) const ->
+            ssize_t;
+#endif
+        [[nodiscard]] auto send_to(std::string_view t_sv,
+                                   ByteSpan t_bs) const -> ssize_t;
+        [[nodiscard]] auto set_nonblocking(bool t_is_nonblocking) const ->
+            OsError;
+        [[nodiscard]] auto shutdown(int t_how) const -> OsError;
+        [[nodiscard]] auto write(std::string_view t_sv) const -> ssize_t;
+        [[nodiscard]] auto write(std::span<const std::string_view> t_svs)
+            const -> ssize_t;
+
+        [[nodiscard]] auto bind(auto t_peer) -> OsError
+        {
+            return open(to_bytestring(t_peer), OpenSymbol::bind);
+        }
+
+        [[nodiscard]] auto connect(auto t_peer) -> OsError
+        {
+            return open(to_bytestring(t_peer), OpenSymbol::connect);
+        }
+
+        [[nodiscard]] auto get_peername() const -> ByteSpan
+        {
+            return get_name(Symbol::getpeername);
+        }
+
+        [[nodiscard]] auto get_sockname() const -> ByteSpan
+        {
+            return get_name(Symbol::getsockname);
+        }
+
+    private:
+        struct NoPath
+        {
+        };
+
+#ifdef _WIN32
+        static constexpr bool is_local {false};
+#else
+        static constexpr bool is_local {Family == AF_UNIX};
+#endif
+
+        // Only a local socket remembers the path it is bound to, so
+        // that it can remove the path again when it is closed.
+        using path_type = std::conditional_t<is_local, Pathname, NoPath>;
+
+        std::optional<SocketData> m_sd;
+        [[no_unique_address]] path_type m_path;
+    };
+
+    extern template class BasicSocket<AF_INET>;
+    extern template class BasicSocket<AF_INET6>;
+#ifndef _WIN32
+    extern template class BasicSocket<AF_UNIX>;
+#endif
+}
+
+#endif
@@ -17,8 +17,8 @@
 #define NETWORK_BINARYBUFFER_HPP
 
 #include "network/buffer.hpp"                   // Buffer
-#include "network/bytestring.hpp"               // ByteString
 #include "network/socket-length-type.hpp"       // socket_length_type
+#include "network/sockaddrstorage.hpp"          // SockAddrStorage
 
 #ifdef _WIN32
 #include <winsock2.h>       // sockaddr
@@ -28,7 +28,7 @@
 
 namespace Network
 {
-    class BinaryBuffer : public Buffer<ByteString>
+    class BinaryBuffer : public Buffer<SockAddrStorage>
     {
     public:
         using span_type = std::pair<sockaddr*, socket_length_type&>;
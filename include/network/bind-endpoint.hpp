@@ -17,6 +17,7 @@
 #define NETWORK_BIND_ENDPOINT_HPP
 
 #include "network/endpointview.hpp"             // EndpointView
+#include "network/opensetup.hpp"                // OpenSetup
 #include "network/runtime.hpp"                  // Runtime
 #include "network/sockethints.hpp"              // SocketHints
 #include "network/socketresultvector.hpp"       // SocketResultVector
@@ -26,6 +27,10 @@ namespace Network
     extern auto bind(const EndpointView& endpoint,
                      const SocketHints& hints,
                      const Runtime* rt) -> SocketResultVector;
+    extern auto bind(const EndpointView& endpoint,
+                     const SocketHints& hints,
+                     const Runtime* rt,
+                     const OpenSetup& setup) -> SocketResultVector;
     extern auto bind(const EndpointView& endpoint,
                      const SocketHints& hints,
                      bool is_verbose = false) -> SocketResultVector;
@@ -0,0 +1,56 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_BUFFERPOOL_HPP
+#define NETWORK_BUFFERPOOL_HPP
+
+#include <cstddef>      // std::size_t
+#include <utility>      // std::pair
+
+namespace Network
+{
+    // Hands out uninitialized, cache-line-aligned blocks in
+    // power-of-two size classes.  Each thread recycles released
+    // blocks through its own free lists, so no lock is taken, and
+    // frees whatever it still holds when it exits.
+    class BufferPool
+    {
+    public:
+        using allocation_type = std::pair<char*, std::size_t>;
+
+        static constexpr std::size_t alignment {64};
+        static constexpr std::size_t cache_max {16};
+        static constexpr std::size_t capacity_max {1UZ << 20U};
+        static constexpr std::size_t capacity_min {64};
+
+        BufferPool() = delete;
+        BufferPool(const BufferPool&) = delete;
+        BufferPool(BufferPool&&) = delete;
+        ~BufferPool() = delete;
+        auto operator=(const BufferPool&) -> BufferPool& = delete;
+        auto operator=(BufferPool&&) -> BufferPool& = delete;
+
+        // Return a block of at least t_size bytes and its capacity.
+        static auto allocate(std::size_t t_size) -> allocation_type;
+        static auto deallocate(char* t_data,
+                               std::size_t t_capacity) noexcept -> void;
+
+        // Report or release the blocks cached by the calling thread.
+        [[nodiscard]] static auto cached() noexcept -> std::size_t;
+        static auto trim() noexcept -> void;
+    };
+}
+
+#endif
@@ -0,0 +1,316 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_CONNECTIONTABLE_HPP
+#define NETWORK_CONNECTIONTABLE_HPP
+
+#include "network/handle-type.hpp"              // handle_type
+#include "network/handlegenerations.hpp"        // HandleGenerations
+#include "network/socketcore.hpp"               // SocketCore
+
+#include <array>        // std::array
+#include <atomic>       // std::atomic, std::atomic_thread_fence()
+#include <bit>          // std::bit_cast()
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint32_t
+#include <memory>       // std::unique_ptr
+#include <optional>     // std::optional
+#include <type_traits>  // std::is_default_constructible_v,
+                        // std::is_trivially_copyable_v
+
+namespace Network
+{
+    // Maps socket descriptors to per-connection values in a flat
+    // array indexed by descriptor, allocated in chunks as larger
+    // descriptors appear.  Each slot is guarded by a sequence lock,
+    // so lookups never block and never take a lock.  The fields of a
+    // slot are atomic, and its value is copied a byte at a time, so
+    // that a lookup racing with a writer reads a torn copy, which it
+    // then discards, rather than causing a data race.  Each entry
+    // records the generation of its descriptor when it was inserted,
+    // and close() advances that generation, so entries for closed
+    // descriptors disappear without being erased and are never
+    // returned for a later connection that reuses the descriptor.
+    template <typename T>
+        requires std::is_trivially_copyable_v<T> &&
+                 std::is_default_constructible_v<T>
+    class ConnectionTable
+    {
+    public:
+        using generation_type = HandleGenerations::generation_type;
+        using value_type = T;
+
+        static constexpr std::size_t chunk_size {
+            HandleGenerations::chunk_size
+        };
+
+        ConnectionTable() noexcept = default;
+        ConnectionTable(const ConnectionTable&) = delete;
+        ConnectionTable(ConnectionTable&&) = delete;
+
+        ~ConnectionTable() noexcept
+        {
+            for (auto& chunk : m_chunks) {
+                delete chunk.load(std::memory_order_relaxed);  // NOLINT
+            }
+        }
+
+        auto operator=(const ConnectionTable&) -> ConnectionTable& = delete;
+        auto operator=(ConnectionTable&&) -> ConnectionTable& = delete;
+
+        // Store a value for a descriptor, replacing any previous one.
+        // Return false if the descriptor is null or out of range.
+        auto insert(handle_type t_handle, const T& t_value) -> bool
+        {
+            const auto index {HandleGenerations::index(t_handle)};
+
+            if (index == HandleGenerations::index_max) {
+                return false;
+            }
+
+            const auto generation {HandleGenerations::reserve(t_handle)};
+            write(get_slot(index), generation, true, t_value);
+            return true;
+        }
+
+        auto insert(const SocketCore& t_sc, const T& t_value) -> bool
+        {
+            return insert(t_sc.handle(), t_value);
+        }
+
+        // Remove a descriptor's value.  Return false if there was
+        // none.
+        auto erase(handle_type t_handle) noexcept -> bool
+        {
+            auto* const slot {find_slot(t_handle)};
+
+            if (slot == nullptr) {
+                return false;
+            }
+
+            // Check and clear the entry under the slot's lock, so that
+            // an entry inserted meanwhile is not erased in its place.
+            const auto sequence {lock(*slot)};
+            const auto is_found {is_current(*slot, t_handle)};
+
+            if (is_found) {
+                store(*slot, 0, false, T {});
+            }
+
+            unlock(*slot, sequence);
+            return is_found;
+        }
+
+        auto erase(const SocketCore& t_sc) noexcept -> bool
+        {
+            return erase(t_sc.handle());
+        }
+
+        [[nodiscard]] auto contains(handle_type t_handle) const noexcept ->
+            bool
+        {
+            return find(t_handle).has_value();
+        }
+
+        // Return a copy of a descriptor's value, if it has one and
+        // the descriptor has not been closed since it was inserted.
+        [[nodiscard]] auto find(handle_type t_handle) const noexcept ->
+            std::optional<T>
+        {
+            if (const auto* const slot {find_slot(t_handle)}) {
+                return read(*slot, t_handle);
+            }
+
+            return std::nullopt;
+        }
+
+        [[nodiscard]] auto find(const SocketCore& t_sc) const noexcept ->
+            std::optional<T>
+        {
+            return find(t_sc.handle());
+        }
+
+        [[nodiscard]] auto capacity() const noexcept -> std::size_t
+        {
+            std::size_t result {0};
+
+            for (const auto& chunk : m_chunks) {
+                if (chunk.load(std::memory_order_acquire) != nullptr) {
+                    result += chunk_size;
+                }
+            }
+
+            return result;
+        }
+
+    private:
+        using Bytes = std::array<unsigned char, sizeof(T)>;
+
+        struct Slot
+        {
+            std::atomic<std::uint32_t> m_sequence {0};
+            std::atomic<generation_type> m_generation {0};
+            std::atomic<bool> m_is_used {false};
+            std::array<std::atomic<unsigned char>, sizeof(T)> m_value {};
+        };
+
+        using Chunk = std::array<Slot, chunk_size>;
+
+        static constexpr auto chunk_count {HandleGenerations::index_max /
+                                           chunk_size};
+
+        static auto is_current(const Slot& t_slot,
+                               handle_type t_handle) noexcept -> bool
+        {
+            return t_slot.m_is_used.load(std::memory_order_relaxed) &&
+                t_slot.m_generation.load(std::memory_order_relaxed) ==
+                HandleGenerations::current(t_handle);
+        }
+
+        static auto load(const Slot& t_slot) noexcept -> T
+        {
+            Bytes bytes {};
+
+            for (std::size_t i {0}; i < bytes.size(); ++i) {
+                bytes[i] = t_slot.m_value[i].load(std::memory_order_relaxed);
+            }
+
+            return std::bit_cast<T>(bytes);
+        }
+
+        // Take a slot's write lock by making its sequence odd, and
+        // return the even sequence it had.
+        static auto lock(Slot& t_slot) noexcept -> std::uint32_t
+        {
+            auto sequence {t_slot.m_sequence.load(std::memory_order_relaxed)};
+
+            do {
+                while ((sequence & 1U) != 0) {
+                    sequence = t_slot.m_sequence.load(
+                        std::memory_order_relaxed);
+                }
+            } while (!t_slot.m_sequence.compare_exchange_weak(
+                         sequence, sequence + 1,
+                         std::memory_order_acquire));
+
+            // Keep the stores to the fields after the odd sequence.
+            std::atomic_thread_fence(std::memory_order_release);
+            return sequence;
+        }
+
+        static auto read(const Slot& t_slot, handle_type t_handle) noexcept ->
+            std::optional<T>
+        {
+            for (;;) {
+                const auto sequence {
+                    t_slot.m_sequence.load(std::memory_order_acquire)
+                };
+
+                if ((sequence & 1U) != 0) {
+                    continue;
+                }
+
+                const auto is_found {is_current(t_slot, t_handle)};
+                const auto value {load(t_slot)};
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if (t_slot.m_sequence.load(std::memory_order_relaxed) !=
+                    sequence) {
+                    continue;
+                }
+
+                if (!is_found) {
+                    return std::nullopt;
+                }
+
+                return value;
+            }
+        }
+
+        static auto store(Slot& t_slot,
+                          generation_type t_generation,
+                          bool t_is_used,
+                          const T& t_value) noexcept -> void
+        {
+            const auto bytes {std::bit_cast<Bytes>(t_value)};
+            t_slot.m_generation.store(t_generation,
+                                      std::memory_order_relaxed);
+            t_slot.m_is_used.store(t_is_used, std::memory_order_relaxed);
+
+            for (std::size_t i {0}; i < bytes.size(); ++i) {
+                t_slot.m_value[i].store(bytes[i], std::memory_order_relaxed);
+            }
+        }
+
+        // Release a slot's write lock by making its sequence even
+        // again, so that lookups overlapping the write retry.
+        static auto unlock(Slot& t_slot, std::uint32_t t_sequence) noexcept ->
+            void
+        {
+            t_slot.m_sequence.store(t_sequence + 2,
+                                    std::memory_order_release);
+        }
+
+        static auto write(Slot& t_slot,
+                          generation_type t_generation,
+                          bool t_is_used,
+                          const T& t_value) noexcept -> void
+        {
+            const auto sequence {lock(t_slot)};
+            store(t_slot, t_generation, t_is_used, t_value);
+            unlock(t_slot, sequence);
+        }
+
+        [[nodiscard]] auto find_slot(handle_type t_handle) const noexcept ->
+            Slot*
+        {
+            const auto index {HandleGenerations::index(t_handle)};
+
+            if (index == HandleGenerations::index_max) {
+                return nullptr;
+            }
+
+            auto* const chunk {m_chunks.at(index / chunk_size).load(
+                std::memory_order_acquire)};
+
+            if (chunk == nullptr) {
+                return nullptr;
+            }
+
+            return &chunk->at(index % chunk_size);
+        }
+
+        auto get_slot(std::size_t t_index) -> Slot&
+        {
+            auto& pointer {m_chunks.at(t_index / chunk_size)};
+            auto* chunk {pointer.load(std::memory_order_acquire)};
+
+            if (chunk == nullptr) {
+                auto owner {std::make_unique<Chunk>()};
+
+                if (pointer.compare_exchange_strong(
+                        chunk, owner.get(), std::memory_order_acq_rel)) {
+                    chunk = owner.release();
+                }
+            }
+
+            return chunk->at(t_index % chunk_size);
+        }
+
+        std::array<std::atomic<Chunk*>, chunk_count> m_chunks {};
+    };
+}
+
+#endif
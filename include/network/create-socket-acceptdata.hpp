@@ -17,11 +17,14 @@
 #define NETWORK_CREATE_SOCKET_ACCEPTDATA_HPP
 
 #include "network/acceptdata.hpp"       // AcceptData
+#include "network/socketslab.hpp"       // SocketSlab
 #include "network/uniquesocket.hpp"     // UniqueSocket
 
 namespace Network
 {
     extern auto create_socket(const AcceptData& ad) -> UniqueSocket;
+    extern auto create_socket(const AcceptData& ad,
+                              SocketSlab& slab) -> UniqueSocket;
 }
 
 #endif
@@ -17,11 +17,14 @@
 #define NETWORK_CREATE_SOCKET_SOCKETDATA_HPP
 
 #include "network/socketdata.hpp"       // SocketData
+#include "network/socketslab.hpp"       // SocketSlab
 #include "network/uniquesocket.hpp"     // UniqueSocket
 
 namespace Network
 {
     extern auto create_socket(const SocketData& sd) -> UniqueSocket;
+    extern auto create_socket(const SocketData& sd,
+                              SocketSlab& slab) -> UniqueSocket;
 }
 
 #endif
@@ -0,0 +1,30 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_DATAGRAMDATA_HPP
+#define NETWORK_DATAGRAMDATA_HPP
+
+#include "network/sockaddrstorage.hpp"  // SockAddrStorage
+
+#include <sys/types.h>      // ssize_t
+
+#include <utility>      // std::pair
+
+namespace Network
+{
+    using DatagramData = std::pair<SockAddrStorage, ssize_t>;
+}
+
+#endif
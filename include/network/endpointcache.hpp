@@ -0,0 +1,75 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_ENDPOINTCACHE_HPP
+#define NETWORK_ENDPOINTCACHE_HPP
+
+#include "network/bytespan.hpp"         // ByteSpan
+#include "network/endpoint.hpp"         // Endpoint
+#include "network/sockaddrstorage.hpp"  // SockAddrStorage
+
+#include <cstddef>      // std::size_t
+#include <list>         // std::list
+#include <map>          // std::map
+#include <mutex>        // std::mutex
+#include <optional>     // std::optional
+#include <utility>      // std::pair
+
+namespace Network
+{
+    // A bounded cache of reverse lookups, keyed by socket address
+    // and ::getnameinfo() flags, that evicts the least recently used
+    // entry when full.
+    class EndpointCache
+    {
+    public:
+        explicit EndpointCache(std::size_t t_capacity = 1024);
+
+        EndpointCache() = delete;
+        EndpointCache(const EndpointCache&) = delete;
+        EndpointCache(EndpointCache&&) = delete;
+        ~EndpointCache() noexcept = default;
+        auto operator=(const EndpointCache&) -> EndpointCache& = delete;
+        auto operator=(EndpointCache&&) -> EndpointCache& = delete;
+
+        auto clear() -> void;
+        [[nodiscard]] auto find(ByteSpan t_bs,
+                                int t_flags) -> std::optional<Endpoint>;
+        auto insert(ByteSpan t_bs,
+                    int t_flags,
+                    const Endpoint& t_endpoint) -> void;
+
+        [[nodiscard]] auto capacity() const noexcept -> std::size_t;
+        [[nodiscard]] auto hits() const -> std::size_t;
+        [[nodiscard]] auto misses() const -> std::size_t;
+        [[nodiscard]] auto size() const -> std::size_t;
+
+    private:
+        using Key = std::pair<SockAddrStorage, int>;
+        using Entry = std::pair<Key, Endpoint>;
+        using EntryList = std::list<Entry>;
+
+        static auto to_key(ByteSpan t_bs, int t_flags) -> Key;
+
+        EntryList m_entries;
+        std::map<Key, EntryList::iterator> m_index;
+        mutable std::mutex m_mutex;
+        std::size_t m_capacity;
+        std::size_t m_hits {0};
+        std::size_t m_misses {0};
+    };
+}
+
+#endif
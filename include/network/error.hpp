@@ -16,6 +16,8 @@
 #ifndef NETWORK_ERROR_HPP
 #define NETWORK_ERROR_HPP
 
+#include "network/oserror.hpp"          // OsError
+
 #include <exception>    // std::exception
 #include <string>       // std::string
 #include <string_view>  // std::string_view
@@ -26,14 +28,22 @@ namespace Network
     {
     public:
         explicit Error(std::string_view t_sv) noexcept;
+
+        // Format the message of a failed system call once, here, so
+        // that what() only reads it.  A rethrown exception may be
+        // shared by several threads, as from a std::shared_future.
+        explicit Error(const OsError& t_error) noexcept;
+
         Error(const Error&) noexcept = default;
         Error(Error&&) noexcept = default;
         ~Error() noexcept override = default;
         auto operator=(const Error&) -> Error& = default;
         auto operator=(Error&&) noexcept -> Error& = default;
+        [[nodiscard]] auto os_error() const noexcept -> const OsError&;
         [[nodiscard]] const char* what() const noexcept override;  // NOLINT
 
     private:
+        OsError m_os_error;
         std::string m_str;
     };
 }
@@ -16,13 +16,14 @@
 #ifndef NETWORK_GET_NAME_HPP
 #define NETWORK_GET_NAME_HPP
 
-#include "network/bytestring.hpp"       // ByteString
 #include "network/namesymbol.hpp"       // NameSymbol
+#include "network/sockaddrstorage.hpp"  // SockAddrStorage
 #include "network/socketcore.hpp"       // SocketCore
 
 namespace Network
 {
-    extern auto get_name(const SocketCore& sc, NameSymbol symbol) -> ByteString;
+    extern auto get_name(const SocketCore& sc,
+                         NameSymbol symbol) -> SockAddrStorage;
 }
 
 #endif
@@ -16,14 +16,14 @@
 #ifndef NETWORK_GET_NAMERESULT_HPP
 #define NETWORK_GET_NAMERESULT_HPP
 
-#include "network/bytestringresult.hpp"         // ByteStringResult
 #include "network/namesymbol.hpp"               // NameSymbol
+#include "network/sockaddrresult.hpp"           // SockAddrResult
 #include "network/socketcore.hpp"               // SocketCore
 
 namespace Network
 {
     extern auto get_nameresult(const SocketCore& sc,
-                               NameSymbol symbol) -> ByteStringResult;
+                               NameSymbol symbol) -> SockAddrResult;
 }
 
 #endif
@@ -0,0 +1,33 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_GET_NUMERIC_ENDPOINT_HPP
+#define NETWORK_GET_NUMERIC_ENDPOINT_HPP
+
+#include "network/bytespan.hpp"         // ByteSpan
+#include "network/endpoint.hpp"         // Endpoint
+
+#include <optional>     // std::optional
+
+namespace Network
+{
+    // Format an IPv4 or IPv6 address and port as ::getnameinfo()
+    // does with NI_NUMERICHOST | NI_NUMERICSERV, without calling
+    // into the C library.  Returns no value for other families and
+    // for scoped IPv6 addresses.
+    extern auto get_numeric_endpoint(ByteSpan bs) -> std::optional<Endpoint>;
+}
+
+#endif
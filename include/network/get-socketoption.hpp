@@ -0,0 +1,57 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_GET_SOCKETOPTION_HPP
+#define NETWORK_GET_SOCKETOPTION_HPP
+
+#include "network/oserror.hpp"          // OsError
+#include "network/socketcore.hpp"       // SocketCore
+
+#include <expected>     // std::expected, std::unexpected
+#include <string_view>  // std::string_view
+#include <type_traits>  // std::is_same_v
+
+namespace Network
+{
+    extern auto get_option(const SocketCore& sc,
+                           int level,
+                           int name,
+                           std::string_view string) ->
+        std::expected<int, OsError>;
+
+    template <typename Option>
+    auto get_option(const SocketCore& sc) ->
+        std::expected<typename Option::value_type, OsError>
+    {
+        using value_type = typename Option::value_type;
+
+        const auto result {
+            get_option(sc, Option::level, Option::name, Option::string)
+        };
+
+        if (!result) {
+            return std::unexpected {result.error()};
+        }
+
+        if constexpr (std::is_same_v<value_type, bool>) {
+            return *result != 0;
+        }
+        else {
+            return static_cast<value_type>(*result);
+        }
+    }
+}
+
+#endif
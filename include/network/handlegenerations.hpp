@@ -0,0 +1,66 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_HANDLEGENERATIONS_HPP
+#define NETWORK_HANDLEGENERATIONS_HPP
+
+#include "network/handle-type.hpp"      // handle_type
+
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t
+
+namespace Network
+{
+    // Counts, for each socket descriptor, how many times it has been
+    // closed, so that state recorded for one connection is not
+    // mistaken for state of a later connection that reuses the same
+    // descriptor.  The counters are process-wide, like descriptors,
+    // and are read and advanced without locking.
+    class HandleGenerations
+    {
+    public:
+        using generation_type = std::uint64_t;
+
+        static constexpr std::size_t chunk_size {1024};
+        static constexpr std::size_t index_max {1UZ << 20U};
+
+        HandleGenerations() = delete;
+        HandleGenerations(const HandleGenerations&) = delete;
+        HandleGenerations(HandleGenerations&&) = delete;
+        ~HandleGenerations() = delete;
+        auto operator=(const HandleGenerations&) ->
+            HandleGenerations& = delete;
+        auto operator=(HandleGenerations&&) -> HandleGenerations& = delete;
+
+        // Record that a descriptor is being closed.
+        static auto advance(handle_type t_handle) noexcept -> void;
+
+        // Return a descriptor's current generation, or zero if it has
+        // never been reserved.
+        [[nodiscard]] static auto current(handle_type t_handle) noexcept ->
+            generation_type;
+
+        // Return the table index of a descriptor, or index_max if it
+        // is null or out of range.
+        [[nodiscard]] static auto index(handle_type t_handle) noexcept ->
+            std::size_t;
+
+        // Start counting for a descriptor and return its current
+        // generation.
+        static auto reserve(handle_type t_handle) -> generation_type;
+    };
+}
+
+#endif
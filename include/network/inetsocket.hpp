@@ -19,17 +19,25 @@
 #include "network/acceptdata.hpp"       // AcceptData
 #include "network/bytespan.hpp"         // ByteSpan
 #include "network/charspan.hpp"         // CharSpan
+#include "network/datagramdata.hpp"     // DatagramData
 #include "network/handle-type.hpp"      // handle_type
 #include "network/namesymbol.hpp"       // NameSymbol
 #include "network/opensymbol.hpp"       // OpenSymbol
+#include "network/os-features.hpp"      // HAVE_SENDFILE, HAVE_ZEROCOPY
 #include "network/oserror.hpp"          // OsError
+#include "network/pathname.hpp"         // Pathname
 #include "network/socket.hpp"           // Socket
 #include "network/socketcore.hpp"       // SocketCore
 #include "network/socketdata.hpp"       // SocketData
 #include "network/symbol.hpp"           // Symbol
+#ifdef HAVE_ZEROCOPY
+#include "network/zerocopycompletion.hpp" // ZeroCopyCompletion
+#endif
 
-#include <sys/types.h>      // ssize_t
+#include <sys/types.h>      // off_t, ssize_t
 
+#include <cstddef>      // std::size_t
+#include <span>         // std::span
 #include <string_view>  // std::string_view
 
 namespace Network
@@ -48,17 +56,45 @@ namespace Network
         explicit operator handle_type() const noexcept final;
 
         [[nodiscard]] auto accept() const -> AcceptData final;
+        [[nodiscard]] auto core() const noexcept -> const SocketCore& final;
         [[nodiscard]] auto get_name(Symbol t_symbol) const -> ByteSpan final;
         [[nodiscard]] auto listen(int t_backlog) const -> OsError final;
         [[nodiscard]] auto open(ByteSpan t_bs, OpenSymbol t_symbol) ->
             OsError override;
         [[nodiscard]] auto read(CharSpan t_cs) const -> ssize_t final;
+        [[nodiscard]] auto read(std::span<const CharSpan> t_css) const ->
+            ssize_t final;
+#ifdef HAVE_ZEROCOPY
+        [[nodiscard]] auto reap_zerocopy(std::span<ZeroCopyCompletion>
+                                         t_completions) const ->
+            std::size_t;
+#endif
+        [[nodiscard]] auto receive_from(CharSpan t_cs) const ->
+            DatagramData final;
+#ifdef HAVE_SENDFILE
+        [[nodiscard]] auto send_file(handle_type t_handle,
+                                     off_t t_offset,
+                                     std::size_t t_length) const ->
+            ssize_t final;
+        [[nodiscard]] auto send_file(const Pathname& t_path,
+                                     off_t t_offset,
+                                     std::size_t t_length) const ->
+            ssize_t final;
+#endif
+        [[nodiscard]] auto send_to(std::string_view t_sv,
+                                   ByteSpan t_bs) const -> ssize_t final;
+#ifdef HAVE_ZEROCOPY
+        [[nodiscard]] auto send_zerocopy(std::string_view t_sv) const ->
+            ssize_t;
+#endif
+        [[nodiscard]] auto set_nonblocking(bool t_is_nonblocking) const ->
+            OsError final;
         [[nodiscard]] auto shutdown(int t_how) const -> OsError final;
         [[nodiscard]] auto write(std::string_view t_sv) const -> ssize_t final;
+        [[nodiscard]] auto write(std::span<const std::string_view> t_svs)
+            const -> ssize_t final;
 
     protected:
-        [[nodiscard]] auto core() const noexcept -> const SocketCore&;
-
         static auto to_namesymbol(Symbol symbol) noexcept -> NameSymbol;
         static auto to_symbol(OpenSymbol symbol) noexcept -> Symbol;
 
@@ -19,11 +19,28 @@
 #include "network/insert-hostname.hpp"  // insert()
 #include "network/openinputs.hpp"       // OpenInputs
 #include "network/oserror.hpp"          // OsError
+#include "network/resolver.hpp"         // Resolver
+
+#include <algorithm>    // std::ranges::copy()
 
 namespace Network
 {
     auto insert(auto it, const OpenInputs& oi) -> OsError
     {
+        if (auto* resolver {oi.runtime()->resolver()}) {
+            const auto result {resolver->resolve(oi.endpoint().at(0),
+                                                 oi.endpoint().at(1),
+                                                 oi.hints(),
+                                                 oi.runtime())};
+
+            if (!result) {
+                return result.error();
+            }
+
+            std::ranges::copy(*result, it);
+            return {};
+        }
+
         return insert(it,
                       oi.endpoint().at(0),
                       oi.endpoint().at(1),
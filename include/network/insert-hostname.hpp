@@ -20,7 +20,7 @@
 #include "network/hostnameview.hpp"     // HostnameView
 #include "network/optionalhints.hpp"    // OptionalHints
 #include "network/oserror.hpp"          // OsError
-#include "network/run.hpp"              // run()
+#include "network/run.hpp"              // run_borrowed()
 #include "network/runtime.hpp"          // Runtime
 #include "network/serviceview.hpp"      // ServiceView
 
@@ -45,8 +45,7 @@ namespace Network
                 const OptionalHints& hints,
                 bool is_verbose) -> OsError
     {
-        const auto sr {run(is_verbose)};
-        return insert(it, hostname, service, hints, sr.get());
+        return insert(it, hostname, service, hints, run_borrowed(is_verbose));
     }
 }
 
@@ -0,0 +1,75 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_IOCOMPLETION_HPP
+#define NETWORK_IOCOMPLETION_HPP
+
+#include "network/oserror.hpp"          // OsError
+
+#include <sys/types.h>      // ssize_t
+
+#include <cstdint>      // std::uint64_t
+
+namespace Network
+{
+    struct IoCompletion
+    {
+        IoCompletion(std::uint64_t t_data,
+                     ssize_t t_result,
+                     const OsError& t_error,
+                     bool t_is_more) :
+            m_error(t_error),
+            m_data(t_data),
+            m_result(t_result),
+            m_is_more(t_is_more)
+        {
+        }
+
+        IoCompletion() = delete;
+        IoCompletion(const IoCompletion&) = default;
+        IoCompletion(IoCompletion&&) noexcept = default;
+        ~IoCompletion() = default;
+        auto operator=(const IoCompletion&) -> IoCompletion& = default;
+        auto operator=(IoCompletion&&) noexcept -> IoCompletion& = default;
+
+        [[nodiscard]] auto data() const noexcept -> std::uint64_t
+        {
+            return m_data;
+        }
+
+        [[nodiscard]] auto error() const noexcept -> const OsError&
+        {
+            return m_error;
+        }
+
+        [[nodiscard]] auto is_more() const noexcept -> bool
+        {
+            return m_is_more;
+        }
+
+        [[nodiscard]] auto result() const noexcept -> ssize_t
+        {
+            return m_result;
+        }
+
+    private:
+        OsError m_error;
+        std::uint64_t m_data {0};
+        ssize_t m_result {0};
+        bool m_is_more {false};
+    };
+}
+
+#endif
@@ -0,0 +1,41 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_IOCOUNTER_HPP
+#define NETWORK_IOCOUNTER_HPP
+
+#include <cstddef>      // std::size_t
+
+namespace Network
+{
+    enum class IoCounter : std::size_t {
+        accepts,
+        again,
+        bytes_read,
+        bytes_written,
+        closes,
+        connects,
+        errors,
+        resolve_errors,
+        resolves,
+        system_calls
+    };
+
+    constexpr std::size_t io_counter_size {
+        static_cast<std::size_t>(IoCounter::system_calls) + 1
+    };
+}
+
+#endif
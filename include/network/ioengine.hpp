@@ -0,0 +1,127 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_IOENGINE_HPP
+#define NETWORK_IOENGINE_HPP
+
+#include "network/charspan.hpp"         // CharSpan
+#include "network/iocompletion.hpp"     // IoCompletion
+#include "network/iomode.hpp"           // IoMode
+#include "network/os-features.hpp"      // HAVE_IO_URING
+#include "network/runtime.hpp"          // Runtime
+#include "network/socketcore.hpp"       // SocketCore
+
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t, std::uint8_t
+#include <memory>       // std::unique_ptr
+#include <span>         // std::span
+#include <string_view>  // std::string_view
+#include <vector>       // std::vector
+
+namespace Network
+{
+#ifdef HAVE_IO_URING
+    class IoUring;
+#endif
+
+    // Batches accepts, reads and writes, and submits them through an
+    // io_uring ring when the runtime's IoMode asks for one and the
+    // kernel allows it, or one system call at a time otherwise.  It
+    // is the only consumer of the IoMode setting.
+    class IoEngine
+    {
+    public:
+        using Data = std::uint64_t;
+
+        explicit IoEngine(const Runtime* t_rt, unsigned t_entries = 256);
+
+        IoEngine() = delete;
+        IoEngine(const IoEngine&) = delete;
+        IoEngine(IoEngine&&) = delete;
+        ~IoEngine() noexcept;
+        auto operator=(const IoEngine&) -> IoEngine& = delete;
+        auto operator=(IoEngine&&) -> IoEngine& = delete;
+
+        // Queue operations for the next submit().  Buffers must stay
+        // valid until the matching completion has been returned.  A
+        // multishot accept stays armed only in io_uring mode: in
+        // standard mode it accepts once, its completion reports no
+        // more to come, and it must be queued again.
+        auto accept(const SocketCore& t_sc,
+                    Data t_data,
+                    bool t_is_multishot = false) -> void;
+        auto read(const SocketCore& t_sc, CharSpan t_cs, Data t_data) -> void;
+        auto read(const SocketCore& t_sc,
+                  std::size_t t_index,
+                  Data t_data) -> void;
+        auto write(const SocketCore& t_sc,
+                   std::string_view t_sv,
+                   Data t_data) -> void;
+
+        auto register_buffers(const std::vector<CharSpan>& t_buffers) ->
+            OsError;
+        auto submit() -> std::span<const IoCompletion>;
+
+        [[nodiscard]] auto mode() const noexcept -> IoMode;
+        [[nodiscard]] auto pending() const noexcept -> std::size_t;
+        [[nodiscard]] auto runtime() const noexcept -> const Runtime*;
+
+    private:
+        enum class Operation : std::uint8_t {
+            accept,
+            read,
+            read_fixed,
+            write
+        };
+
+        struct Request
+        {
+            SocketCore m_sc;
+            CharSpan m_cs;
+            std::string_view m_sv;
+            Data m_data {0};
+            std::size_t m_index {0};
+            Operation m_operation {Operation::read};
+            bool m_is_multishot {false};
+        };
+
+        auto complete(const Request& t_request) -> void;
+        auto enqueue(const Request& t_request) -> void;
+#ifdef HAVE_IO_URING
+        auto drain(std::vector<IoCompletion>& t_completions) -> void;
+        auto enter(unsigned t_wait) -> void;
+        auto prepare(const Request& t_request, std::size_t t_slot) -> void;
+        auto reap(std::vector<IoCompletion>& t_completions) -> void;
+
+        static auto to_name(Operation t_operation) noexcept ->
+            std::string_view;
+#endif
+
+        std::vector<CharSpan> m_buffers;
+        std::vector<IoCompletion> m_completions;
+        std::vector<Request> m_queue;
+#ifdef HAVE_IO_URING
+        std::vector<IoCompletion> m_deferred;
+        std::vector<Request> m_slots;
+        std::vector<std::size_t> m_free;
+        std::unique_ptr<IoUring> m_ring;
+        std::size_t m_in_flight {0};
+        bool m_is_registered {false};
+#endif
+        const Runtime* m_rt;
+    };
+}
+
+#endif
@@ -0,0 +1,33 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_IOMODE_HPP
+#define NETWORK_IOMODE_HPP
+
+#include <cstdint>      // std::uint8_t
+
+namespace Network
+{
+    // Selects how an IoEngine performs the operations queued on it.
+    // The free functions and the Socket members make one system call
+    // per operation in either mode, as a single blocking call leaves
+    // nothing for a ring to batch.
+    enum class IoMode : std::uint8_t {
+        standard,
+        io_uring
+    };
+}
+
+#endif
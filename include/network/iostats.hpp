@@ -0,0 +1,81 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_IOSTATS_HPP
+#define NETWORK_IOSTATS_HPP
+
+#include "network/iocounter.hpp"        // IoCounter, io_counter_size
+#include "network/iolatency.hpp"        // IoLatency, io_latency_size
+#include "network/iostatssnapshot.hpp"  // IoStatsSnapshot
+#include "network/latencyhistogram.hpp" // LatencyHistogram
+#include "network/os-error-type.hpp"    // os_error_type
+
+#include <array>        // std::array
+#include <atomic>       // std::atomic
+#include <chrono>       // std::chrono::nanoseconds
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t
+
+namespace Network
+{
+    // Runtime-wide I/O counters.  Each thread increments its own
+    // cache-line-sized shard with relaxed atomic additions, so
+    // counting never contends between threads.  A snapshot sums the
+    // shards, and may be taken while other threads are counting.
+    // Latencies of slow calls are recorded in shared lock-free
+    // histograms, one per kind of call.
+    class IoStats
+    {
+    public:
+        static constexpr std::size_t cache_line_size {64};
+        static constexpr std::size_t shard_count {16};
+
+        IoStats() noexcept = default;
+        IoStats(const IoStats&) = delete;
+        IoStats(IoStats&&) = delete;
+        ~IoStats() noexcept = default;
+        auto operator=(const IoStats&) -> IoStats& = delete;
+        auto operator=(IoStats&&) -> IoStats& = delete;
+
+        auto add(IoCounter t_counter, std::uint64_t t_value = 1) noexcept ->
+            void;
+        auto add_error(os_error_type t_number) noexcept -> void;
+        auto record(IoLatency t_latency,
+                    std::chrono::nanoseconds t_duration) noexcept -> void;
+
+        [[nodiscard]] auto latency(IoLatency t_latency) const noexcept ->
+            const LatencyHistogram&;
+        [[nodiscard]] auto snapshot() const noexcept -> IoStatsSnapshot;
+
+    private:
+        using Counters = std::array<std::atomic<std::uint64_t>,
+                                    io_counter_size>;
+        using ErrorCounters = std::array<std::atomic<std::uint64_t>,
+                                         IoStatsSnapshot::error_number_max>;
+
+        struct alignas(cache_line_size) Shard
+        {
+            Counters m_counters {};
+        };
+
+        auto shard() noexcept -> Shard&;
+
+        std::array<Shard, shard_count> m_shards {};
+        ErrorCounters m_errors {};
+        std::array<LatencyHistogram, io_latency_size> m_latencies {};
+    };
+}
+
+#endif
@@ -0,0 +1,73 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_IOSTATSSNAPSHOT_HPP
+#define NETWORK_IOSTATSSNAPSHOT_HPP
+
+#include "network/iocounter.hpp"        // IoCounter
+#include "network/iolatency.hpp"        // io_latency_size
+#include "network/latencysummary.hpp"   // LatencySummary
+#include "network/os-error-type.hpp"    // os_error_type
+
+#include <array>        // std::array
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t
+#include <ostream>      // std::ostream
+
+namespace Network
+{
+    // A point-in-time copy of I/O statistics.  Errors are also
+    // counted by number, with numbers at or above error_number_max
+    // counted together in the last element.
+    struct IoStatsSnapshot
+    {
+        static constexpr std::size_t error_number_max {256};
+
+        using ErrorCounts = std::array<std::uint64_t, error_number_max>;
+        using Latencies = std::array<LatencySummary, io_latency_size>;
+
+        static constexpr auto error_index(os_error_type t_number) noexcept ->
+            std::size_t
+        {
+            const auto index {static_cast<std::size_t>(t_number)};
+            return index < error_number_max ? index : error_number_max - 1;
+        }
+
+        auto add(IoCounter t_counter, std::uint64_t t_value) noexcept ->
+            void;
+
+        std::uint64_t m_accepts {0};                            // NOLINT
+        std::uint64_t m_again {0};                              // NOLINT
+        std::uint64_t m_bytes_read {0};                         // NOLINT
+        std::uint64_t m_bytes_written {0};                      // NOLINT
+        std::uint64_t m_closes {0};                             // NOLINT
+        std::uint64_t m_connects {0};                           // NOLINT
+        std::uint64_t m_errors {0};                             // NOLINT
+        std::uint64_t m_resolve_errors {0};                     // NOLINT
+        std::uint64_t m_resolves {0};                           // NOLINT
+        std::uint64_t m_system_calls {0};                       // NOLINT
+        ErrorCounts m_errors_by_number {};                      // NOLINT
+        Latencies m_latencies {};                               // NOLINT
+    };
+
+    // Write one "name value" line per counter and per latency
+    // percentile, followed by an "error number count" line for each
+    // error number seen.
+    extern auto operator<<(std::ostream& os,
+                           const IoStatsSnapshot& snapshot) ->
+        std::ostream&;
+}
+
+#endif
@@ -0,0 +1,79 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_LATENCYHISTOGRAM_HPP
+#define NETWORK_LATENCYHISTOGRAM_HPP
+
+#include "network/latencysummary.hpp"   // LatencySummary
+
+#include <array>        // std::array
+#include <atomic>       // std::atomic
+#include <chrono>       // std::chrono::nanoseconds
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t
+
+namespace Network
+{
+    // A log-bucketed latency histogram in the style of HdrHistogram.
+    // Each power of two is split into eight linear sub-buckets, so a
+    // reported percentile is within 12.5% of the recorded value.
+    // Recording and merging use relaxed atomic additions and never
+    // lock, so one histogram may be shared by many threads, and
+    // histograms kept per thread may be merged into one.
+    class LatencyHistogram
+    {
+    public:
+        using Duration = std::chrono::nanoseconds;
+
+        static constexpr std::size_t sub_bucket_bits {3};
+        static constexpr std::size_t sub_bucket_count {
+            std::size_t {1} << sub_bucket_bits
+        };
+        static constexpr std::size_t bucket_count {
+            (64 - sub_bucket_bits + 1) * sub_bucket_count
+        };
+
+        LatencyHistogram() noexcept = default;
+        LatencyHistogram(const LatencyHistogram&) = delete;
+        LatencyHistogram(LatencyHistogram&&) = delete;
+        ~LatencyHistogram() noexcept = default;
+        auto operator=(const LatencyHistogram&) ->
+            LatencyHistogram& = delete;
+        auto operator=(LatencyHistogram&&) -> LatencyHistogram& = delete;
+
+        static auto to_index(std::uint64_t t_value) noexcept -> std::size_t;
+        static auto to_value(std::size_t t_index) noexcept -> std::uint64_t;
+
+        auto merge(const LatencyHistogram& t_histogram) noexcept -> void;
+        auto record(Duration t_duration) noexcept -> void;
+
+        [[nodiscard]] auto count() const noexcept -> std::uint64_t;
+        [[nodiscard]] auto max() const noexcept -> Duration;
+
+        // Return the smallest recorded latency, rounded up to the top
+        // of its bucket, that is at or above the given percentile.
+        [[nodiscard]] auto percentile(double t_percentile) const noexcept ->
+            Duration;
+        [[nodiscard]] auto summary() const noexcept -> LatencySummary;
+
+    private:
+        auto update_max(std::uint64_t t_value) noexcept -> void;
+
+        std::array<std::atomic<std::uint64_t>, bucket_count> m_buckets {};
+        std::atomic<std::uint64_t> m_max {0};
+    };
+}
+
+#endif
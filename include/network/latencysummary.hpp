@@ -0,0 +1,34 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_LATENCYSUMMARY_HPP
+#define NETWORK_LATENCYSUMMARY_HPP
+
+#include <cstdint>      // std::uint64_t
+
+namespace Network
+{
+    // Selected percentiles of a latency distribution, in nanoseconds.
+    struct LatencySummary
+    {
+        std::uint64_t m_count {0};                              // NOLINT
+        std::uint64_t m_p50 {0};                                // NOLINT
+        std::uint64_t m_p99 {0};                                // NOLINT
+        std::uint64_t m_p999 {0};                               // NOLINT
+        std::uint64_t m_max {0};                                // NOLINT
+    };
+}
+
+#endif
@@ -0,0 +1,53 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_NAMECACHE_HPP
+#define NETWORK_NAMECACHE_HPP
+
+#include "network/bytespan.hpp"         // ByteSpan
+#include "network/sockaddrstorage.hpp"  // SockAddrStorage
+#include "network/symbol.hpp"           // Symbol
+
+#include <array>        // std::array
+#include <cstddef>      // std::size_t
+
+namespace Network
+{
+    // Holds one socket address per Symbol in fixed inline storage,
+    // so that remembering a socket's names never allocates.
+    class NameCache
+    {
+    public:
+        static constexpr std::size_t slot_count {
+            static_cast<std::size_t>(Symbol::getsockname) + 1
+        };
+
+        NameCache() noexcept = default;
+        NameCache(const NameCache&) noexcept = default;
+        NameCache(NameCache&&) noexcept = default;
+        ~NameCache() noexcept = default;
+        auto operator=(const NameCache&) noexcept -> NameCache& = default;
+        auto operator=(NameCache&&) noexcept -> NameCache& = default;
+
+        auto set(Symbol t_symbol, ByteSpan t_bs) -> void;
+
+        [[nodiscard]] auto get(Symbol t_symbol) const noexcept -> ByteSpan;
+
+    private:
+        std::array<SockAddrStorage, slot_count> m_slots;
+    };
+}
+
+#endif
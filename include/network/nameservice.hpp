@@ -0,0 +1,45 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_NAMESERVICE_HPP
+#define NETWORK_NAMESERVICE_HPP
+
+#include "network/hostnameview.hpp"     // HostnameView
+#include "network/optionalhints.hpp"    // OptionalHints
+#include "network/resolveresult.hpp"    // ResolveResult
+#include "network/runtime.hpp"          // Runtime
+#include "network/serviceview.hpp"      // ServiceView
+
+namespace Network
+{
+    class NameService
+    {
+    public:
+        NameService() noexcept = default;
+        NameService(const NameService&) noexcept = delete;
+        NameService(NameService&&) noexcept = delete;
+        virtual ~NameService() noexcept = default;
+        auto operator=(const NameService&) noexcept -> NameService& = delete;
+        auto operator=(NameService&&) noexcept -> NameService& = delete;
+
+        [[nodiscard]] virtual auto lookup(const HostnameView& t_hostname,
+                                          const ServiceView& t_service,
+                                          const OptionalHints& t_hints,
+                                          const Runtime* t_rt) const ->
+            ResolveResult = 0;
+    };
+}
+
+#endif
@@ -16,22 +16,36 @@
 #ifndef NETWORK_NETWORK_HPP
 #define NETWORK_NETWORK_HPP
 
+#ifndef _WIN32
+#include "network/accept-batch.hpp"             // accept_batch()
+#endif
+#include "network/accept-result.hpp"            // accept_result()
 #include "network/accept.hpp"                   // accept()
+#ifndef _WIN32
+#include "network/acceptbatch.hpp"              // AcceptBatch
+#endif
+#include "network/acceptresult.hpp"             // AcceptResult
 #include "network/address.hpp"                  // Address
+#include "network/addrinfoservice.hpp"          // AddrinfoService
 #include "network/ai-error.hpp"                 // format_ai_error()
 #include "network/always-false.hpp"             // always_false_v
 #include "network/api-error.hpp"                // get_last_runtime_error()
                                                 // reset_last_runtime_error()
                                                 // set_last_runtime_error()
 #include "network/apioptions.hpp"               // ApiOptions
+#include "network/basicsocket.hpp"              // BasicSocket
 #include "network/binarybuffer.hpp"             // BinaryBuffer
 #include "network/bind.hpp"                     // bind()
 #include "network/buffer.hpp"                   // Buffer
+#include "network/bufferpool.hpp"               // BufferPool
 #include "network/bytespan.hpp"                 // ByteSpan
 #include "network/bytestring.hpp"               // ByteString
-#include "network/bytestringresult.hpp"         // ByteStringResult
 #include "network/close.hpp"                    // close()
 #include "network/connect.hpp"                  // connect()
+#include "network/connectiontable.hpp"          // ConnectionTable
+#ifndef _WIN32
+#include "network/connectoptions.hpp"           // ConnectOptions
+#endif
 #include "network/constants.hpp"                // handle_null,
                                                 // name_length_max,
                                                 // name_length_min,
@@ -71,16 +85,23 @@
 #include "network/create-socket-hints.hpp"      // create_socket()
 #include "network/create-socket.hpp"            // create_socket()
 #include "network/create-socketresult.hpp"      // create_result()
+#ifndef _WIN32
+#include "network/datagrambatch.hpp"            // DatagramBatch
+#endif
+#include "network/datagramdata.hpp"             // DatagramData
+#include "network/endpointcache.hpp"            // EndpointCache
 #include "network/error-strings.hpp"            // VISITOR_ERROR
 #include "network/exceptions.hpp"               // Error, LogicError,
                                                 // RuntimeError
 #include "network/failmode.hpp"                 // FailMode
 #include "network/get-endpoint.hpp"             // get_endpoint()
+#include "network/get-endpointresult-cache.hpp" // get_endpointresult()
 #include "network/get-endpointresult.hpp"       // get_endpointresult()
 #include "network/get-hostname.hpp"             // get_hostname()
 #include "network/get-hostnameresult.hpp"       // get_hostnameresult()
 #include "network/get-name.hpp"                 // get_name()
 #include "network/get-nameresult.hpp"           // get_nameresult()
+#include "network/get-numeric-endpoint.hpp"     // get_numeric_endpoint()
 #ifndef _WIN32
 #include "network/get-path-length.hpp"          // get_path_length()
 #endif
@@ -90,38 +111,114 @@
 #include "network/get-sa-pointer.hpp"           // get_sa_pointer()
 #include "network/get-sin-pointer.hpp"          // get_sin_pointer()
 #include "network/get-sin6-pointer.hpp"         // get_sin6_pointer()
+#include "network/get-socketoption.hpp"         // get_option()
 #ifndef _WIN32
 #include "network/get-sun-length.hpp"           // get_sun_length()
 #include "network/get-sun-pointer.hpp"          // get_sun_pointer()
 #endif
+#include "network/handlegenerations.hpp"        // HandleGenerations
 #include "network/insert.hpp"                   // insert()
+#include "network/iocompletion.hpp"             // IoCompletion
+#include "network/iocounter.hpp"                // IoCounter
+#include "network/ioengine.hpp"                 // IoEngine
+#include "network/iolatency.hpp"                // IoLatency
+#include "network/iomode.hpp"                   // IoMode
+#include "network/iostats.hpp"                  // IoStats
+#include "network/iostatssnapshot.hpp"          // IoStatsSnapshot
 #include "network/ipsockethints.hpp"            // IpSocketHints
+#include "network/is-again.hpp"                 // is_again()
+#include "network/latencyhistogram.hpp"         // LatencyHistogram
+#include "network/latencysummary.hpp"           // LatencySummary
 #include "network/listen.hpp"                   // listen()
+#ifndef _WIN32
+#include "network/messagedata.hpp"              // MessageData
+#endif
+#include "network/namecache.hpp"                // NameCache
+#include "network/nameservice.hpp"              // NameService
+#ifndef _WIN32
+#include "network/open-connectoptions.hpp"      // open()
+#endif
 #include "network/open-endpoint.hpp"            // open()
 #include "network/open-handle.hpp"              // open()
+#include "network/opensetup.hpp"                // OpenSetup
 #include "network/os-error.hpp"                 // format_os_error(),
                                                 // get_last_os_error(),
                                                 // reset_last_os_error()
 #include "network/overloaded.hpp"               // Overloaded
+#include "network/pooledbuffer.hpp"             // PooledBuffer
+#include "network/quote-charspans.hpp"          // quote()
+#include "network/quote-stringviews.hpp"        // quote()
 #include "network/quote.hpp"                    // quote()
+#include "network/read-charspans.hpp"           // read()
+#include "network/read-result.hpp"              // read_result()
 #include "network/read.hpp"                     // read()
+#ifndef _WIN32
+#include "network/reap-zerocopy.hpp"            // reap_zerocopy()
+#include "network/receive-batch.hpp"            // receive_batch()
+#endif
+#include "network/receive-from.hpp"             // receive_from()
+#ifndef _WIN32
+#include "network/receive-message.hpp"          // receive_message()
+#endif
+#include "network/resolver.hpp"                 // Resolver
+#include "network/resolveresult.hpp"            // ResolveResult
+#include "network/resolveroptions.hpp"          // ResolverOptions
+#include "network/ringtracer.hpp"               // RingTracer
 #include "network/run.hpp"                      // run()
 #include "network/runtime.hpp"                  // Runtime
+#ifndef _WIN32
+#include "network/send-batch.hpp"               // send_batch()
+#include "network/send-file-path.hpp"           // send_file()
+#include "network/send-file.hpp"                // send_file()
+#include "network/send-message.hpp"             // send_message()
+#endif
+#include "network/send-to.hpp"                  // send_to()
+#ifndef _WIN32
+#include "network/send-zerocopy.hpp"            // send_zerocopy()
+#endif
+#include "network/set-nonblocking.hpp"          // set_nonblocking()
+#include "network/set-socketoption.hpp"         // set_option()
+#ifndef _WIN32
+#include "network/shardedlistener.hpp"          // ShardedListener
+#endif
+#include "network/sharednameservice.hpp"        // SharedNameService
+#include "network/sharedresolver.hpp"           // SharedResolver
 #include "network/sharedruntime.hpp"            // SharedRuntime
+#include "network/sharedtracer.hpp"             // SharedTracer
 #include "network/shutdown.hpp"                 // shutdown()
+#include "network/sizeresult.hpp"               // SizeResult
+#include "network/smallvector.hpp"              // SmallVector
+#include "network/sockaddrresult.hpp"           // SockAddrResult
+#include "network/sockaddrstorage.hpp"          // SockAddrStorage
 #include "network/socket-error.hpp"             // socket_error
 #include "network/socket.hpp"                   // Socket
 #include "network/socketcore.hpp"               // SocketCore
+#include "network/socketdeleter.hpp"            // SocketDeleter
 #include "network/socketfamily.hpp"             // SocketFamily
 #include "network/socketflags.hpp"              // SocketFlags
 #include "network/sockethints.hpp"              // SocketHints
 #include "network/sockethost.hpp"               // SocketHost
 #include "network/socketlimits.hpp"             // SocketLimits
+#include "network/socketoption.hpp"             // SocketOption
+#include "network/socketoptions.hpp"            // BusyPoll, ReceiveBuffer,
+                                                // ReusePort, SendBuffer,
+                                                // SocketError, TcpCork,
+                                                // TcpFastOpen, TcpNoDelay,
+                                                // TcpQuickAck, ZeroCopy
 #include "network/socketprotocol.hpp"           // SocketProtocol
+#include "network/socketslab.hpp"               // SocketSlab
+#include "network/socketstats.hpp"              // SocketStats
 #include "network/sockettemplate.hpp"           // SocketTemplate
 #include "network/sockettype.hpp"               // SocketType
+#include "network/spawn.hpp"                    // spawn()
+#ifndef _WIN32
+#include "network/splicerelay.hpp"              // SpliceRelay
+#endif
+#include "network/streamtracer.hpp"             // StreamTracer
 #include "network/string-null.hpp"              // string_null
 #include "network/symbol.hpp"                   // Symbol
+#include "network/systemcall.hpp"               // SystemCall
+#include "network/task.hpp"                     // Task
 #include "network/textbuffer.hpp"               // TextBuffer
 #include "network/to-bytestring.hpp"            // to_bytestring()
 #include "network/to-handle-type.hpp"           // to_handle_type()
@@ -138,6 +235,8 @@
 #ifndef _WIN32
 #include "network/to-sun-length.hpp"            // to_sun_length()
 #endif
+#include "network/trace.hpp"                    // trace()
+#include "network/tracer.hpp"                   // Tracer
 #include "network/types.hpp"                    // Buffer, ByteString,
                                                 // Hostname,
                                                 // OptionalHostname,
@@ -171,6 +270,11 @@
 #ifdef _WIN32
 #include "network/windowsversion.hpp"           // WindowsVersion
 #endif
+#include "network/write-result.hpp"             // write_result()
+#include "network/write-stringviews.hpp"        // write()
 #include "network/write.hpp"                    // write()
+#ifndef _WIN32
+#include "network/zerocopycompletion.hpp"       // ZeroCopyCompletion
+#endif
 
 #endif
@@ -17,6 +17,7 @@
 #define NETWORK_OPEN_ENDPOINT_HPP
 
 #include "network/openinputs.hpp"               // OpenInputs
+#include "network/opensetup.hpp"                // OpenSetup
 #include "network/opensymbol.hpp"               // Symbol
 #include "network/socketresultvector.hpp"       // SocketResultVector
 
@@ -24,6 +25,9 @@ namespace Network
 {
     extern auto open(const OpenInputs& oi,
                      OpenSymbol symbol) -> SocketResultVector;
+    extern auto open(const OpenInputs& oi,
+                     OpenSymbol symbol,
+                     const OpenSetup& setup) -> SocketResultVector;
 }
 
 #endif
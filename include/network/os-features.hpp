@@ -22,4 +22,19 @@
 #define HAVE_SOCKADDR_SA_LEN
 #endif
 
+#ifdef __linux__
+#define HAVE_ACCEPT4
+#define HAVE_EPOLL
+#define HAVE_RECVMMSG
+#define HAVE_REUSEPORT
+#define HAVE_SENDFILE
+#define HAVE_SPLICE
+#if __has_include(<linux/io_uring.h>)
+#define HAVE_IO_URING
+#endif
+#if __has_include(<linux/errqueue.h>)
+#define HAVE_ZEROCOPY
+#endif
+#endif
+
 #endif
@@ -17,7 +17,10 @@
 #define NETWORK_OSERROR_HPP
 
 #include "network/os-error-type.hpp"    // os_error_type
+#include "network/sockaddrstorage.hpp"  // SockAddrStorage
+#include "network/systemcall.hpp"       // SystemCall
 
+#include <memory>       // std::shared_ptr
 #include <string>       // std::string
 #include <string_view>  // std::string_view
 
@@ -29,6 +32,15 @@ namespace Network
 
         OsError(os_error_type t_number, std::string_view t_string);
 
+        // Record a failed system call.  The message is formatted from
+        // the record on each call to string(), which leaves the error
+        // unchanged, so that threads may share it.  Any address is
+        // copied out of line, so that errors from calls without one
+        // stay small.
+        OsError(os_error_type t_number,
+                int t_api_error,
+                const SystemCall& t_call);
+
         OsError(const OsError&) = default;
         OsError(OsError&&) = default;
         ~OsError() = default;
@@ -36,12 +48,17 @@ namespace Network
         auto operator=(OsError&&) -> OsError& = default;
 
         operator bool() const noexcept;  // NOLINT
+        [[nodiscard]] auto api_error() const noexcept -> int;
+        [[nodiscard]] auto call() const noexcept -> const SystemCall&;
         [[nodiscard]] auto number() const noexcept -> os_error_type;
-        [[nodiscard]] auto string() const -> const std::string&;
+        [[nodiscard]] auto string() const -> std::string;
 
     private:
-        os_error_type m_number {0};
+        SystemCall m_call;
+        std::shared_ptr<const SockAddrStorage> m_address;
         std::string m_string;
+        os_error_type m_number {0};
+        int m_api_error {0};
     };
 }
 
@@ -0,0 +1,61 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_POOLEDBUFFER_HPP
+#define NETWORK_POOLEDBUFFER_HPP
+
+#include <cstddef>      // std::size_t
+#include <string_view>  // std::string_view
+
+namespace Network
+{
+    // An uninitialized, cache-line-aligned buffer borrowed from
+    // BufferPool and returned to it on destruction.  Unlike
+    // TextBuffer, it is never zero-filled, and received data is
+    // read in place through view().
+    class PooledBuffer
+    {
+    public:
+        using iterator = char*;
+        using size_type = std::size_t;
+        using value_type = char;
+
+        explicit PooledBuffer(size_type t_size);
+        PooledBuffer(PooledBuffer&& t_buffer) noexcept;
+
+        PooledBuffer() = delete;
+        PooledBuffer(const PooledBuffer&) = delete;
+        ~PooledBuffer() noexcept;
+        auto operator=(const PooledBuffer&) -> PooledBuffer& = delete;
+        auto operator=(PooledBuffer&& t_buffer) noexcept -> PooledBuffer&;
+
+        [[nodiscard]] auto begin() noexcept -> iterator;
+        [[nodiscard]] auto capacity() const noexcept -> size_type;
+        [[nodiscard]] auto data() noexcept -> value_type*;
+        [[nodiscard]] auto end() noexcept -> iterator;
+        [[nodiscard]] auto size() const noexcept -> size_type;
+        [[nodiscard]] auto view(size_type t_length) const noexcept ->
+            std::string_view;
+
+    private:
+        auto release() noexcept -> void;
+
+        char* m_data {nullptr};
+        size_type m_size {0};
+        size_type m_capacity {0};
+    };
+}
+
+#endif
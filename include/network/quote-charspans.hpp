@@ -0,0 +1,34 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_QUOTE_CHARSPANS_HPP
+#define NETWORK_QUOTE_CHARSPANS_HPP
+
+#include "network/charspan.hpp"         // CharSpan
+
+#include <cstddef>      // std::size_t
+#include <span>         // std::span
+#include <string>       // std::string
+
+namespace Network
+{
+    extern auto quote(std::span<const CharSpan> css) -> std::string;
+
+    // Quote only the first size bytes held in the spans.
+    extern auto quote(std::span<const CharSpan> css,
+                      std::size_t size) -> std::string;
+}
+
+#endif
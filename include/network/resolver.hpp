@@ -0,0 +1,135 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_RESOLVER_HPP
+#define NETWORK_RESOLVER_HPP
+
+#include "network/hostnameview.hpp"             // HostnameView
+#include "network/optionalhints.hpp"            // OptionalHints
+#include "network/optionalhostname.hpp"         // OptionalHostname
+#include "network/optionalservice.hpp"          // OptionalService
+#include "network/resolveresult.hpp"            // ResolveResult
+#include "network/resolveroptions.hpp"          // ResolverOptions
+#include "network/runtime.hpp"                  // Runtime
+#include "network/serviceview.hpp"              // ServiceView
+#include "network/sharednameservice.hpp"        // SharedNameService
+
+#include <chrono>       // std::chrono::steady_clock
+#include <compare>      // std::strong_ordering
+#include <condition_variable>   // std::condition_variable_any
+#include <cstddef>      // std::size_t
+#include <deque>        // std::deque
+#include <future>       // std::promise, std::shared_future
+#include <map>          // std::map, std::multimap
+#include <mutex>        // std::mutex
+#include <optional>     // std::optional
+#include <stop_token>   // std::stop_token
+#include <thread>       // std::jthread
+#include <tuple>        // std::tuple
+#include <vector>       // std::vector
+
+namespace Network
+{
+    // Resolves names on a pool of worker threads and caches both
+    // answers and errors.  Concurrent requests for the same key can
+    // share a single lookup.
+    class Resolver
+    {
+    public:
+        using Future = std::shared_future<ResolveResult>;
+
+        explicit Resolver(SharedNameService t_service,
+                          const ResolverOptions& t_options = {});
+
+        Resolver() = delete;
+        Resolver(const Resolver&) = delete;
+        Resolver(Resolver&&) = delete;
+        ~Resolver() noexcept;
+        auto operator=(const Resolver&) -> Resolver& = delete;
+        auto operator=(Resolver&&) -> Resolver& = delete;
+
+        auto clear() -> void;
+        [[nodiscard]] auto resolve(const HostnameView& t_hostname,
+                                   const ServiceView& t_service,
+                                   const OptionalHints& t_hints,
+                                   const Runtime* t_rt) -> ResolveResult;
+        [[nodiscard]] auto resolve_async(const HostnameView& t_hostname,
+                                         const ServiceView& t_service,
+                                         const OptionalHints& t_hints,
+                                         const Runtime* t_rt) -> Future;
+
+        [[nodiscard]] auto coalesced() const -> std::size_t;
+        [[nodiscard]] auto hits() const -> std::size_t;
+        [[nodiscard]] auto misses() const -> std::size_t;
+        [[nodiscard]] auto size() const -> std::size_t;
+
+    private:
+        using Clock = std::chrono::steady_clock;
+        using Hints = std::tuple<int, int, int, int>;
+
+        struct Key
+        {
+            auto operator<=>(const Key&) const = default;
+
+            OptionalHostname m_hostname;
+            OptionalService m_service;
+            std::optional<Hints> m_hints;
+        };
+
+        using Expiries = std::multimap<Clock::time_point, Key>;
+
+        struct Entry
+        {
+            Future m_future;
+            Expiries::iterator m_expiry;
+        };
+
+        using Cache = std::map<Key, Entry>;
+
+        struct Request
+        {
+            Key m_key;
+            OptionalHints m_hints;
+            std::promise<ResolveResult> m_promise;
+            Future m_future;
+            const Runtime* m_rt;
+        };
+
+        static auto to_key(const HostnameView& t_hostname,
+                           const ServiceView& t_service,
+                           const OptionalHints& t_hints) -> Key;
+        auto erase(Cache::iterator t_it) -> void;
+        auto insert(const Key& t_key,
+                    const Future& t_future,
+                    Clock::time_point t_expiry) -> void;
+        auto sweep(Clock::time_point t_now) -> void;
+        auto work(const std::stop_token& t_token) -> void;
+
+        SharedNameService m_service;
+        ResolverOptions m_options;
+        Cache m_cache;
+        Expiries m_expiries;
+        std::map<Key, Future> m_pending;
+        std::deque<Request> m_queue;
+        mutable std::mutex m_mutex;
+        std::condition_variable_any m_condition;
+        std::size_t m_coalesced {0};
+        std::size_t m_hits {0};
+        std::size_t m_misses {0};
+        std::vector<std::jthread> m_workers;
+    };
+}
+
+#endif
@@ -0,0 +1,41 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_RESOLVEROPTIONS_HPP
+#define NETWORK_RESOLVEROPTIONS_HPP
+
+#include <chrono>       // std::chrono::seconds,
+                        // std::chrono::steady_clock
+#include <cstddef>      // std::size_t
+
+namespace Network
+{
+    struct ResolverOptions
+    {
+        using duration = std::chrono::steady_clock::duration;
+
+        // ::getaddrinfo() does not report record TTLs, so answers
+        // are kept for a fixed time.  A zero TTL disables caching.
+        // Once the cache holds its capacity, expired entries are
+        // dropped first, then those closest to expiring.
+        duration m_positive_ttl {std::chrono::seconds {60}};    // NOLINT
+        duration m_negative_ttl {std::chrono::seconds {5}};     // NOLINT
+        std::size_t m_capacity {1024};                          // NOLINT
+        std::size_t m_worker_count {2};                         // NOLINT
+        bool m_is_coalescing {true};                            // NOLINT
+    };
+}
+
+#endif
@@ -0,0 +1,71 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_RINGTRACER_HPP
+#define NETWORK_RINGTRACER_HPP
+
+#include "network/tracer.hpp"           // Tracer
+
+#include <condition_variable>   // std::condition_variable,
+                                // std::condition_variable_any
+#include <cstddef>      // std::size_t
+#include <mutex>        // std::mutex
+#include <ostream>      // std::ostream
+#include <stop_token>   // std::stop_token
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <thread>       // std::jthread
+#include <vector>       // std::vector
+
+namespace Network
+{
+    // Queue lines in a fixed-capacity ring drained by a background
+    // thread, so that callers never wait on the stream.  Lines traced
+    // while the ring is full are counted and discarded.
+    class RingTracer final : public Tracer
+    {
+    public:
+        explicit RingTracer(std::ostream& t_os, std::size_t t_capacity = 4096);
+
+        RingTracer() = delete;
+        RingTracer(const RingTracer&) = delete;
+        RingTracer(RingTracer&&) = delete;
+        ~RingTracer() final = default;
+        auto operator=(const RingTracer&) -> RingTracer& = delete;
+        auto operator=(RingTracer&&) -> RingTracer& = delete;
+
+        auto flush() -> void final;
+        auto trace(std::string_view t_line) -> void final;
+
+        [[nodiscard]] auto capacity() const noexcept -> std::size_t;
+        [[nodiscard]] auto dropped() const -> std::size_t;
+
+    private:
+        auto drain(const std::stop_token& t_token) -> void;
+
+        std::vector<std::string> m_slots;
+        mutable std::mutex m_mutex;
+        std::condition_variable_any m_ready;
+        std::condition_variable m_written;
+        std::ostream* m_os;
+        std::size_t m_dropped {0};
+        std::size_t m_head {0};
+        std::size_t m_tail {0};
+        std::size_t m_total {0};
+        std::jthread m_thread;
+    };
+}
+
+#endif
@@ -17,6 +17,7 @@
 #define NETWORK_RUN_HPP
 
 #include "network/apioptions.hpp"       // ApiOptions
+#include "network/runtime.hpp"          // Runtime
 #include "network/runtimescope.hpp"     // RuntimeScope
 #include "network/sharedruntime.hpp"    // SharedRuntime
 
@@ -25,6 +26,12 @@ namespace Network
     extern auto run(ApiOptions ao, RuntimeScope rs) -> SharedRuntime;
     extern auto run(RuntimeScope rs, bool is_verbose) -> SharedRuntime;
     extern auto run(bool is_verbose = false) -> SharedRuntime;
+
+    // Return the global runtime, started if necessary, without
+    // copying a SharedRuntime.  The global runtime lives until the
+    // program exits, so the pointer may be kept and shared freely
+    // between threads.
+    extern auto run_borrowed(bool is_verbose = false) -> const Runtime*;
 }
 
 #endif
@@ -16,12 +16,17 @@
 #ifndef NETWORK_RUNTIME_HPP
 #define NETWORK_RUNTIME_HPP
 
+#include "network/iomode.hpp"           // IoMode
+#include "network/iostats.hpp"          // IoStats
+#include "network/tracer.hpp"           // Tracer
 #include "network/version.hpp"          // Version
 
 #include <string_view>  // std::string_view
 
 namespace Network
 {
+    class Resolver;
+
     class Runtime
     {
     public:
@@ -38,8 +43,13 @@ namespace Network
             std::string_view = 0;
         [[nodiscard]] virtual auto system_status() const noexcept ->
             std::string_view = 0;
+        [[nodiscard]] virtual auto io_mode() const noexcept -> IoMode = 0;
         [[nodiscard]] virtual auto is_running() const noexcept -> bool = 0;
         [[nodiscard]] virtual auto is_verbose() const noexcept -> bool = 0;
+        [[nodiscard]] virtual auto resolver() const noexcept ->
+            Resolver* = 0;
+        [[nodiscard]] virtual auto stats() const noexcept -> IoStats* = 0;
+        [[nodiscard]] virtual auto tracer() const noexcept -> Tracer* = 0;
 
         virtual auto start() -> void = 0;
         virtual auto stop() -> int = 0;
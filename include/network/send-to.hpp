@@ -0,0 +1,34 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_SEND_TO_HPP
+#define NETWORK_SEND_TO_HPP
+
+#include "network/bytespan.hpp"         // ByteSpan
+#include "network/socketcore.hpp"       // SocketCore
+
+#include <sys/types.h>      // ssize_t
+
+#include <string_view>  // std::string_view
+
+namespace Network
+{
+    extern auto send_to(const SocketCore& sc,
+                        std::string_view sv,
+                        ByteSpan bs,
+                        int flags = 0) -> ssize_t;
+}
+
+#endif
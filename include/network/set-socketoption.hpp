@@ -0,0 +1,41 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_SET_SOCKETOPTION_HPP
+#define NETWORK_SET_SOCKETOPTION_HPP
+
+#include "network/oserror.hpp"          // OsError
+#include "network/socketcore.hpp"       // SocketCore
+
+#include <string_view>  // std::string_view
+
+namespace Network
+{
+    extern auto set_option(const SocketCore& sc,
+                           int level,
+                           int name,
+                           std::string_view string,
+                           int value) -> OsError;
+
+    template <typename Option>
+    auto set_option(const SocketCore& sc,
+                    typename Option::value_type value) -> OsError
+    {
+        return set_option(sc, Option::level, Option::name, Option::string,
+                          static_cast<int>(value));
+    }
+}
+
+#endif
@@ -0,0 +1,61 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_SMALLVECTOR_HPP
+#define NETWORK_SMALLVECTOR_HPP
+
+#include <array>        // std::array
+#include <cstddef>      // std::size_t
+#include <span>         // std::span
+#include <vector>       // std::vector
+
+namespace Network
+{
+    // A fixed-length sequence stored inline when it holds no more
+    // than N elements and on the heap otherwise, so that the short
+    // iovec and WSABUF lists built for each vectored call do not
+    // allocate.
+    template <typename T, std::size_t N = 64>
+    class SmallVector
+    {
+    public:
+        explicit SmallVector(std::size_t t_size) :
+            m_size(t_size)
+        {
+            if (m_size > N) {
+                m_heap.resize(m_size);
+            }
+        }
+
+        SmallVector() = delete;
+        SmallVector(const SmallVector&) = delete;
+        SmallVector(SmallVector&&) = delete;
+        ~SmallVector() noexcept = default;
+        auto operator=(const SmallVector&) -> SmallVector& = delete;
+        auto operator=(SmallVector&&) -> SmallVector& = delete;
+
+        [[nodiscard]] auto span() noexcept -> std::span<T>
+        {
+            return {m_size > N ? m_heap.data() : m_array.data(), m_size};
+        }
+
+    private:
+        std::array<T, N> m_array;
+        std::vector<T> m_heap;
+        std::size_t m_size;
+    };
+}
+
+#endif
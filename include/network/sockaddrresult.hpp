@@ -13,17 +13,17 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
-#ifndef NETWORK_BYTESTRINGRESULT_HPP
-#define NETWORK_BYTESTRINGRESULT_HPP
+#ifndef NETWORK_SOCKADDRRESULT_HPP
+#define NETWORK_SOCKADDRRESULT_HPP
 
-#include "network/bytestring.hpp"       // ByteString
 #include "network/oserror.hpp"          // OsError
+#include "network/sockaddrstorage.hpp"  // SockAddrStorage
 
 #include <expected>     // std::expected
 
 namespace Network
 {
-    using ByteStringResult = std::expected<ByteString, OsError>;
+    using SockAddrResult = std::expected<SockAddrStorage, OsError>;
 }
 
 #endif
@@ -0,0 +1,84 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_SOCKADDRSTORAGE_HPP
+#define NETWORK_SOCKADDRSTORAGE_HPP
+
+#include "network/bytespan.hpp"         // ByteSpan
+#include "network/ss-sizes.hpp"         // ss_size
+
+#ifdef _WIN32
+#include <winsock2.h>       // sockaddr_storage
+#else
+#include <sys/socket.h>     // sockaddr_storage
+#endif
+
+#include <array>        // std::array
+#include <compare>      // std::strong_ordering
+#include <cstddef>      // std::byte, std::size_t
+
+namespace Network
+{
+    // A socket address held in fixed inline storage large enough for
+    // any address family, so that copying an address never
+    // allocates.  It converts implicitly to ByteSpan.
+    class SockAddrStorage
+    {
+    public:
+        using const_iterator = const std::byte*;
+        using iterator = std::byte*;
+        using size_type = std::size_t;
+        using value_type = std::byte;
+
+        static constexpr size_type capacity_max {ss_size};
+
+        explicit SockAddrStorage(ByteSpan t_bs);
+        SockAddrStorage(size_type t_size, value_type t_value);
+
+        SockAddrStorage() noexcept = default;
+        SockAddrStorage(const SockAddrStorage&) noexcept = default;
+        SockAddrStorage(SockAddrStorage&&) noexcept = default;
+        ~SockAddrStorage() noexcept = default;
+        auto operator=(const SockAddrStorage&) noexcept ->
+            SockAddrStorage& = default;
+        auto operator=(SockAddrStorage&&) noexcept ->
+            SockAddrStorage& = default;
+
+        auto operator==(const SockAddrStorage& t_storage) const noexcept ->
+            bool;
+        auto operator<=>(const SockAddrStorage& t_storage) const noexcept ->
+            std::strong_ordering;
+
+        auto assign(ByteSpan t_bs) -> void;
+        auto resize(size_type t_size) -> void;
+
+        [[nodiscard]] auto begin() noexcept -> iterator;
+        [[nodiscard]] auto begin() const noexcept -> const_iterator;
+        [[nodiscard]] auto capacity() const noexcept -> size_type;
+        [[nodiscard]] auto data() noexcept -> value_type*;
+        [[nodiscard]] auto data() const noexcept -> const value_type*;
+        [[nodiscard]] auto empty() const noexcept -> bool;
+        [[nodiscard]] auto end() noexcept -> iterator;
+        [[nodiscard]] auto end() const noexcept -> const_iterator;
+        [[nodiscard]] auto size() const noexcept -> size_type;
+
+    private:
+        alignas(sockaddr_storage) std::array<value_type, capacity_max>
+            m_data {};
+        size_type m_size {0};
+    };
+}
+
+#endif
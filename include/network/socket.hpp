@@ -19,15 +19,24 @@
 #include "network/acceptdata.hpp"       // AcceptData
 #include "network/bytespan.hpp"         // ByteSpan
 #include "network/charspan.hpp"         // CharSpan
+#include "network/datagramdata.hpp"     // DatagramData
+#include "network/get-socketoption.hpp" // get_option()
 #include "network/handle-type.hpp"      // handle_type
 #include "network/opensymbol.hpp"       // OpenSymbol
+#include "network/os-features.hpp"      // HAVE_SENDFILE
 #include "network/oserror.hpp"          // OsError
+#include "network/pathname.hpp"         // Pathname
+#include "network/set-socketoption.hpp" // set_option()
+#include "network/socketcore.hpp"       // SocketCore
 #include "network/symbol.hpp"           // Symbol
 #include "network/to-bytestring.hpp"    // to_bytestring()
 
-#include <sys/types.h>      // ssize_t
+#include <sys/types.h>      // off_t, ssize_t
 
+#include <cstddef>      // std::size_t
+#include <expected>     // std::expected
 #include <ostream>      // std::ostream
+#include <span>         // std::span
 #include <string_view>  // std::string_view
 
 namespace Network
@@ -45,15 +54,38 @@ namespace Network
         explicit virtual operator handle_type() const noexcept = 0;
 
         [[nodiscard]] virtual auto accept() const -> AcceptData = 0;
+        [[nodiscard]] virtual auto core() const noexcept ->
+            const SocketCore& = 0;
         [[nodiscard]] virtual auto get_name(Symbol t_symbol) const ->
             ByteSpan = 0;
         [[nodiscard]] virtual auto listen(int t_backlog) const -> OsError = 0;
         [[nodiscard]] virtual auto open(ByteSpan t_bs, OpenSymbol t_symbol) ->
             OsError = 0;
         [[nodiscard]] virtual auto read(CharSpan t_cs) const -> ssize_t = 0;
+        [[nodiscard]] virtual auto read(std::span<const CharSpan> t_css)
+            const -> ssize_t = 0;
+        [[nodiscard]] virtual auto receive_from(CharSpan t_cs) const ->
+            DatagramData = 0;
+#ifdef HAVE_SENDFILE
+        [[nodiscard]] virtual auto send_file(handle_type t_handle,
+                                             off_t t_offset,
+                                             std::size_t t_length) const ->
+            ssize_t = 0;
+        [[nodiscard]] virtual auto send_file(const Pathname& t_path,
+                                             off_t t_offset,
+                                             std::size_t t_length) const ->
+            ssize_t = 0;
+#endif
+        [[nodiscard]] virtual auto send_to(std::string_view t_sv,
+                                           ByteSpan t_bs) const ->
+            ssize_t = 0;
+        [[nodiscard]] virtual auto set_nonblocking(bool t_is_nonblocking)
+            const -> OsError = 0;
         [[nodiscard]] virtual auto shutdown(int t_how) const -> OsError = 0;
         [[nodiscard]] virtual auto write(std::string_view t_sv) const ->
             ssize_t = 0;
+        [[nodiscard]] virtual auto write(std::span<const std::string_view>
+                                         t_svs) const -> ssize_t = 0;
 
         [[nodiscard]] auto bind(auto t_peer) -> OsError
         {
@@ -75,6 +107,20 @@ namespace Network
             return get_name(Symbol::getsockname);
         }
 
+        template <typename Option>
+        [[nodiscard]] auto get_option() const ->
+            std::expected<typename Option::value_type, OsError>
+        {
+            return Network::get_option<Option>(core());
+        }
+
+        template <typename Option>
+        [[nodiscard]] auto set_option(typename Option::value_type t_value)
+            const -> OsError
+        {
+            return Network::set_option<Option>(core(), t_value);
+        }
+
     };
 
     extern auto operator<<(std::ostream& os, const Socket& s) -> std::ostream&;
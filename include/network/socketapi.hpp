@@ -18,13 +18,25 @@
 
 #include "network/apioptions.hpp"       // ApiOptions
 #include "network/apistate.hpp"         // ApiState
+#include "network/iomode.hpp"           // IoMode
+#include "network/iostats.hpp"          // IoStats
+#include "network/resolver.hpp"         // Resolver
 #include "network/runtime.hpp"          // Runtime
+#include "network/sharedtracer.hpp"     // SharedTracer
+#include "network/tracer.hpp"           // Tracer
 #include "network/version.hpp"          // Version
 
+#include <atomic>       // std::atomic
+#include <memory>       // std::unique_ptr
+#include <mutex>        // std::mutex
 #include <string_view>  // std::string_view
 
 namespace Network
 {
+    // The running state is cached in an atomic flag so that
+    // is_running() can be called from any thread without locking.
+    // Calls to start() and stop() are serialized by a mutex, and
+    // start() does nothing if the runtime is already running.
     class SocketApi final : public Runtime
     {
     public:
@@ -42,8 +54,12 @@ namespace Network
             std::string_view final;
         [[nodiscard]] auto system_status() const noexcept ->
             std::string_view final;
+        [[nodiscard]] auto io_mode() const noexcept -> IoMode final;
         [[nodiscard]] auto is_running() const noexcept -> bool final;
         [[nodiscard]] auto is_verbose() const noexcept -> bool final;
+        [[nodiscard]] auto resolver() const noexcept -> Resolver* final;
+        [[nodiscard]] auto stats() const noexcept -> IoStats* final;
+        [[nodiscard]] auto tracer() const noexcept -> Tracer* final;
 
         auto start() -> void final;
         auto stop() -> int final;
@@ -51,6 +67,10 @@ namespace Network
     private:
         ApiOptions m_ao;
         ApiState m_as;
+        SharedTracer m_tracer;
+        std::unique_ptr<IoStats> m_stats;
+        std::mutex m_mutex;
+        std::atomic<bool> m_is_running {false};
     };
 }
 
@@ -20,19 +20,35 @@
 #include "network/family-type.hpp"      // family_type
 #include "network/handle-null.hpp"      // handle_null
 #include "network/handle-type.hpp"      // handle_type
+#include "network/iocounter.hpp"        // IoCounter
+#include "network/iolatency.hpp"        // IoLatency
+#include "network/iostats.hpp"          // IoStats
+#include "network/os-error-type.hpp"    // os_error_type
 #include "network/runtime.hpp"          // Runtime
+#include "network/socketstats.hpp"      // SocketStats
+#include "network/tracer.hpp"           // Tracer
+
+#include <chrono>       // std::chrono::steady_clock
+#include <cstdint>      // std::uint64_t
 
 namespace Network
 {
     class SocketCore
     {
     public:
+        using Clock = std::chrono::steady_clock;
+
         SocketCore(handle_type t_handle,
                    family_type t_family,
                    const Runtime* t_rt);
         SocketCore(const SocketCore& t_sc,
                    handle_type t_handle);
 
+        // Copy a core with a caller-owned counter block attached, so
+        // that I/O through the copy is also counted per socket.
+        SocketCore(const SocketCore& t_sc,
+                   SocketStats* t_stats) noexcept;
+
         SocketCore() = delete;
         SocketCore(const SocketCore&) noexcept = default;
         SocketCore(SocketCore&&) noexcept = default;
@@ -43,9 +59,30 @@ namespace Network
         [[nodiscard]] auto family() const noexcept -> family_type;
         [[nodiscard]] auto handle() const noexcept -> handle_type;
         [[nodiscard]] auto runtime() const noexcept -> const Runtime*;
+        [[nodiscard]] auto socket_stats() const noexcept -> SocketStats*;
+        [[nodiscard]] auto tracer() const noexcept -> Tracer*;
+
+        // Count an event in the runtime and socket counters.
+        auto count(IoCounter t_counter,
+                   std::uint64_t t_value = 1) const noexcept -> void;
+
+        // Count a failed system call, including its error number.
+        auto count_error(os_error_type t_number) const noexcept -> void;
+
+        // Read the clock to time a call, unless latencies are not
+        // recorded, in which case the epoch is returned unread.
+        [[nodiscard]] auto now() const noexcept -> Clock::time_point;
+
+        // Record the latency of a call started at a time returned by
+        // now() in the runtime histograms.
+        auto record(IoLatency t_latency,
+                    Clock::time_point t_start) const noexcept -> void;
 
     private:
         const Runtime* m_rt;
+        Tracer* m_tracer {nullptr};
+        IoStats* m_stats {nullptr};
+        SocketStats* m_socket_stats {nullptr};
         handle_type m_handle {handle_null};
         family_type m_family {family_null};
     };
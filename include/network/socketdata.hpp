@@ -17,41 +17,49 @@
 #define NETWORK_SOCKETDATA_HPP
 
 #include "network/acceptdata.hpp"       // AcceptData
-#include "network/bytestring.hpp"       // ByteString
+#include "network/bytespan.hpp"         // ByteSpan
 #include "network/family-type.hpp"      // family_type
 #include "network/handle-type.hpp"      // handle_type
 #include "network/runtime.hpp"          // Runtime
+#include "network/sockaddrstorage.hpp"  // SockAddrStorage
 #include "network/socketcore.hpp"       // SocketCore
 #include "network/symbol.hpp"           // Symbol
 
-#include <map>          // std::map
+#include <memory>       // std::unique_ptr
 
 namespace Network
 {
+    class NameCache;
+
+    // Pairs a socket's core with the names it has been asked for.
+    // Every socket is accepted, bound or connected, and stores the
+    // address it was given, so the first such name is held inline.
+    // The others are rarely asked for, so their cache is allocated on
+    // first use.
     class SocketData
     {
     public:
-        using Name = ByteString;
-        using NameCache = std::map<Symbol, Name>;
-
         SocketData(handle_type t_handle,
                    family_type t_family,
                    const Runtime* t_rt);
         explicit SocketData(const AcceptData& t_ad);
 
         SocketData() = delete;
-        SocketData(const SocketData&) noexcept = default;
-        SocketData(SocketData&&) noexcept = default;
-        ~SocketData() noexcept = default;
-        auto operator=(const SocketData&) noexcept -> SocketData& = default;
-        auto operator=(SocketData&&) noexcept -> SocketData& = default;
+        SocketData(const SocketData& t_sd);
+        SocketData(SocketData&& t_sd) noexcept;
+        ~SocketData() noexcept;
+        auto operator=(const SocketData& t_sd) -> SocketData&;
+        auto operator=(SocketData&& t_sd) noexcept -> SocketData&;
 
         [[nodiscard]] auto core() const noexcept -> const SocketCore&;
-        [[nodiscard]] auto name(Symbol t_symbol) const noexcept -> Name&;
+        [[nodiscard]] auto name(Symbol t_symbol) const noexcept -> ByteSpan;
+        auto name(Symbol t_symbol, ByteSpan t_bs) const -> void;
 
     private:
         SocketCore m_sc;
-        mutable NameCache m_nc;
+        mutable SockAddrStorage m_open;
+        mutable Symbol m_open_symbol {Symbol::accept};
+        mutable std::unique_ptr<NameCache> m_nc;
     };
 }
 
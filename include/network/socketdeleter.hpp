@@ -0,0 +1,58 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_SOCKETDELETER_HPP
+#define NETWORK_SOCKETDELETER_HPP
+
+#include "network/socket.hpp"           // Socket
+
+#include <memory>       // std::default_delete
+#include <type_traits>  // std::is_convertible_v
+
+namespace Network
+{
+    class SocketSlab;
+
+    // Destroys a socket and releases its memory either to the heap
+    // or, when it was created in a SocketSlab, back to that slab.
+    class SocketDeleter
+    {
+    public:
+        SocketDeleter() noexcept = default;
+        explicit SocketDeleter(SocketSlab* t_slab) noexcept;
+
+        // Allow std::unique_ptr<T> to convert to UniqueSocket.
+        template <typename T>
+            requires std::is_convertible_v<T*, Socket*>
+        SocketDeleter(const std::default_delete<T>&) noexcept  // NOLINT
+        {
+        }
+
+        SocketDeleter(const SocketDeleter&) noexcept = default;
+        SocketDeleter(SocketDeleter&&) noexcept = default;
+        ~SocketDeleter() noexcept = default;
+        auto operator=(const SocketDeleter&) noexcept ->
+            SocketDeleter& = default;
+        auto operator=(SocketDeleter&&) noexcept -> SocketDeleter& = default;
+        auto operator()(Socket* t_socket) const noexcept -> void;
+
+        [[nodiscard]] auto slab() const noexcept -> SocketSlab*;
+
+    private:
+        SocketSlab* m_slab {nullptr};
+    };
+}
+
+#endif
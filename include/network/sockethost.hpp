@@ -17,8 +17,8 @@
 #define NETWORK_SOCKETHOST_HPP
 
 #include "network/bytespan.hpp"                 // ByteSpan
-#include "network/bytestring.hpp"               // ByteString
 #include "network/optionalhostname.hpp"         // OptionalHostname
+#include "network/sockaddrstorage.hpp"          // SockAddrStorage
 
 #ifdef _WIN32
 #include <ws2tcpip.h>       // addrinfo
@@ -46,12 +46,12 @@ namespace Network
             const OptionalHostname&;
 
     protected:
-        static auto to_bytestring(const addrinfo& t_ai) -> ByteString;
+        static auto to_bytestring(const addrinfo& t_ai) -> SockAddrStorage;
         static auto to_canonical_name(const addrinfo& t_ai) noexcept ->
             OptionalHostname;
 
     private:
-        ByteString m_addr;
+        SockAddrStorage m_addr;
         OptionalHostname m_name;
     };
 }
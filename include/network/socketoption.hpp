@@ -0,0 +1,34 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_SOCKETOPTION_HPP
+#define NETWORK_SOCKETOPTION_HPP
+
+namespace Network
+{
+    // Binds a socket option's value type to its protocol level and
+    // name, so that typed options can be passed to set_option() and
+    // get_option() without spelling out either at the call site.
+    template <typename T, int Level, int Name>
+    struct SocketOption
+    {
+        using value_type = T;
+
+        static constexpr int level {Level};
+        static constexpr int name {Name};
+    };
+}
+
+#endif
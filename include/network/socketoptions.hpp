@@ -0,0 +1,114 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_SOCKETOPTIONS_HPP
+#define NETWORK_SOCKETOPTIONS_HPP
+
+#include "network/socketoption.hpp"     // SocketOption
+
+#ifdef _WIN32
+#include <winsock2.h>       // IPPROTO_TCP, SOL_SOCKET, SO_ERROR,
+                            // SO_RCVBUF, SO_SNDBUF, TCP_NODELAY
+#include <ws2tcpip.h>       // TCP_FASTOPEN
+#else
+#include <netinet/in.h>     // IPPROTO_TCP
+#include <netinet/tcp.h>    // TCP_CORK, TCP_FASTOPEN, TCP_NODELAY,
+                            // TCP_QUICKACK
+#include <sys/socket.h>     // SOL_SOCKET, SO_BUSY_POLL, SO_ERROR,
+                            // SO_RCVBUF, SO_REUSEPORT, SO_SNDBUF,
+                            // SO_ZEROCOPY
+#endif
+
+#include <string_view>  // std::string_view
+
+namespace Network
+{
+    struct ReceiveBuffer : SocketOption<int, SOL_SOCKET, SO_RCVBUF>
+    {
+        static constexpr std::string_view string {"SOL_SOCKET, SO_RCVBUF"};
+    };
+
+    struct SendBuffer : SocketOption<int, SOL_SOCKET, SO_SNDBUF>
+    {
+        static constexpr std::string_view string {"SOL_SOCKET, SO_SNDBUF"};
+    };
+
+    // Pending error, which is cleared when read.
+    struct SocketError : SocketOption<int, SOL_SOCKET, SO_ERROR>
+    {
+        static constexpr std::string_view string {"SOL_SOCKET, SO_ERROR"};
+    };
+
+    struct TcpNoDelay : SocketOption<bool, IPPROTO_TCP, TCP_NODELAY>
+    {
+        static constexpr std::string_view string {
+            "IPPROTO_TCP, TCP_NODELAY"
+        };
+    };
+
+#ifdef SO_BUSY_POLL
+    // Microseconds to busy-poll the device queue on blocking reads.
+    struct BusyPoll : SocketOption<int, SOL_SOCKET, SO_BUSY_POLL>
+    {
+        static constexpr std::string_view string {
+            "SOL_SOCKET, SO_BUSY_POLL"
+        };
+    };
+#endif
+
+#ifdef SO_REUSEPORT
+    struct ReusePort : SocketOption<bool, SOL_SOCKET, SO_REUSEPORT>
+    {
+        static constexpr std::string_view string {
+            "SOL_SOCKET, SO_REUSEPORT"
+        };
+    };
+#endif
+
+#ifdef SO_ZEROCOPY
+    struct ZeroCopy : SocketOption<bool, SOL_SOCKET, SO_ZEROCOPY>
+    {
+        static constexpr std::string_view string {"SOL_SOCKET, SO_ZEROCOPY"};
+    };
+#endif
+
+#ifdef TCP_CORK
+    struct TcpCork : SocketOption<bool, IPPROTO_TCP, TCP_CORK>
+    {
+        static constexpr std::string_view string {"IPPROTO_TCP, TCP_CORK"};
+    };
+#endif
+
+#ifdef TCP_FASTOPEN
+    // Length of the queue of pending Fast Open requests on a listener.
+    struct TcpFastOpen : SocketOption<int, IPPROTO_TCP, TCP_FASTOPEN>
+    {
+        static constexpr std::string_view string {
+            "IPPROTO_TCP, TCP_FASTOPEN"
+        };
+    };
+#endif
+
+#ifdef TCP_QUICKACK
+    struct TcpQuickAck : SocketOption<bool, IPPROTO_TCP, TCP_QUICKACK>
+    {
+        static constexpr std::string_view string {
+            "IPPROTO_TCP, TCP_QUICKACK"
+        };
+    };
+#endif
+}
+
+#endif
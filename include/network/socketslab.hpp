@@ -0,0 +1,63 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_SOCKETSLAB_HPP
+#define NETWORK_SOCKETSLAB_HPP
+
+#include <cstddef>      // std::size_t
+#include <mutex>        // std::mutex
+#include <vector>       // std::vector
+
+namespace Network
+{
+    // Carves fixed-size slots for socket objects out of chunks that
+    // are kept until the slab is destroyed, so that sockets created
+    // and destroyed at a high rate reuse the same memory instead of
+    // fragmenting the heap.  The slab must outlive every socket
+    // created in it.
+    class SocketSlab
+    {
+    public:
+        static constexpr std::size_t chunk_slots {64};
+
+        SocketSlab() noexcept = default;
+        SocketSlab(const SocketSlab&) = delete;
+        SocketSlab(SocketSlab&&) = delete;
+        ~SocketSlab() noexcept;
+        auto operator=(const SocketSlab&) -> SocketSlab& = delete;
+        auto operator=(SocketSlab&&) -> SocketSlab& = delete;
+
+        // Return an uninitialized slot of slot_size() bytes.
+        auto allocate() -> void*;
+        auto deallocate(void* t_slot) noexcept -> void;
+
+        [[nodiscard]] auto capacity() const noexcept -> std::size_t;
+        [[nodiscard]] auto size() const noexcept -> std::size_t;
+        [[nodiscard]] static auto slot_size() noexcept -> std::size_t;
+
+    private:
+        struct FreeSlot
+        {
+            FreeSlot* m_next;
+        };
+
+        std::vector<void*> m_chunks;
+        mutable std::mutex m_mutex;
+        FreeSlot* m_free {nullptr};
+        std::size_t m_size {0};
+    };
+}
+
+#endif
@@ -0,0 +1,51 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_SOCKETSTATS_HPP
+#define NETWORK_SOCKETSTATS_HPP
+
+#include "network/iocounter.hpp"        // IoCounter, io_counter_size
+#include "network/iostatssnapshot.hpp"  // IoStatsSnapshot
+
+#include <array>        // std::array
+#include <atomic>       // std::atomic
+#include <cstdint>      // std::uint64_t
+
+namespace Network
+{
+    // Counters for a single socket, owned by the caller and attached
+    // to a SocketCore.  Errors are counted in total but not by
+    // number, which keeps each block small.
+    class SocketStats
+    {
+    public:
+        SocketStats() noexcept = default;
+        SocketStats(const SocketStats&) = delete;
+        SocketStats(SocketStats&&) = delete;
+        ~SocketStats() noexcept = default;
+        auto operator=(const SocketStats&) -> SocketStats& = delete;
+        auto operator=(SocketStats&&) -> SocketStats& = delete;
+
+        auto add(IoCounter t_counter, std::uint64_t t_value = 1) noexcept ->
+            void;
+        [[nodiscard]] auto snapshot() const noexcept -> IoStatsSnapshot;
+
+    private:
+        std::array<std::atomic<std::uint64_t>, io_counter_size>
+            m_counters {};
+    };
+}
+
+#endif
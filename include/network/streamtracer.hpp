@@ -0,0 +1,48 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_STREAMTRACER_HPP
+#define NETWORK_STREAMTRACER_HPP
+
+#include "network/tracer.hpp"           // Tracer
+
+#include <ostream>      // std::ostream
+#include <string_view>  // std::string_view
+
+namespace Network
+{
+    // Write each line synchronously, flushing the stream after every
+    // line.
+    class StreamTracer final : public Tracer
+    {
+    public:
+        explicit StreamTracer(std::ostream& t_os) noexcept;
+
+        StreamTracer() = delete;
+        StreamTracer(const StreamTracer&) = delete;
+        StreamTracer(StreamTracer&&) = delete;
+        ~StreamTracer() final = default;
+        auto operator=(const StreamTracer&) -> StreamTracer& = delete;
+        auto operator=(StreamTracer&&) -> StreamTracer& = delete;
+
+        auto flush() -> void final;
+        auto trace(std::string_view t_line) -> void final;
+
+    private:
+        std::ostream* m_os;
+    };
+}
+
+#endif
@@ -0,0 +1,50 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_SYSTEMCALL_HPP
+#define NETWORK_SYSTEMCALL_HPP
+
+#include "network/bytespan.hpp"         // ByteSpan
+#include "network/handle-type.hpp"      // handle_type
+
+#include <array>        // std::array
+#include <cstdint>      // std::int64_t
+#include <ostream>      // std::ostream
+#include <string_view>  // std::string_view
+
+namespace Network
+{
+    // The arguments of a failed system call, recorded without
+    // allocating so that a message is only formatted if requested.
+    // The name and any detail, such as the name of a socket option,
+    // must refer to static storage, and the argument writer is
+    // normally a captureless lambda at the call site.  The address
+    // need only outlive the construction of the OsError recording the
+    // call, which keeps its own copy.
+    struct SystemCall
+    {
+        using Arguments = auto (*)(std::ostream& os,
+                                   const SystemCall& call) -> void;
+
+        std::string_view m_name {};                     // NOLINT
+        Arguments m_arguments {nullptr};                // NOLINT
+        ByteSpan m_address {};                          // NOLINT
+        std::string_view m_detail {};                   // NOLINT
+        std::array<std::int64_t, 3> m_values {};        // NOLINT
+        handle_type m_handle {};                        // NOLINT
+    };
+}
+
+#endif
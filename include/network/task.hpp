@@ -0,0 +1,204 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_TASK_HPP
+#define NETWORK_TASK_HPP
+
+#include <coroutine>    // std::coroutine_handle, std::noop_coroutine(),
+                        // std::suspend_always
+#include <exception>    // std::current_exception(), std::exception_ptr,
+                        // std::rethrow_exception()
+#include <optional>     // std::optional
+#include <utility>      // std::exchange(), std::forward(), std::move()
+
+namespace Network
+{
+    template <typename T>
+    class Task;
+
+    class TaskPromiseBase
+    {
+    public:
+        struct FinalAwaiter
+        {
+            [[nodiscard]] auto await_ready() const noexcept -> bool
+            {
+                return false;
+            }
+
+            template <typename Promise>
+            [[nodiscard]] auto await_suspend(std::coroutine_handle<Promise>
+                                             t_handle) const noexcept ->
+                std::coroutine_handle<>
+            {
+                if (const auto continuation {
+                        t_handle.promise().m_continuation
+                    }) {
+                    return continuation;
+                }
+
+                return std::noop_coroutine();
+            }
+
+            auto await_resume() const noexcept -> void
+            {
+            }
+        };
+
+        TaskPromiseBase() noexcept = default;
+        TaskPromiseBase(const TaskPromiseBase&) = delete;
+        TaskPromiseBase(TaskPromiseBase&&) = delete;
+        ~TaskPromiseBase() noexcept = default;
+        auto operator=(const TaskPromiseBase&) -> TaskPromiseBase& = delete;
+        auto operator=(TaskPromiseBase&&) -> TaskPromiseBase& = delete;
+
+        [[nodiscard]] auto initial_suspend() const noexcept ->
+            std::suspend_always
+        {
+            return {};
+        }
+
+        [[nodiscard]] auto final_suspend() const noexcept -> FinalAwaiter
+        {
+            return {};
+        }
+
+        auto unhandled_exception() noexcept -> void
+        {
+            m_exception = std::current_exception();
+        }
+
+        auto set_continuation(std::coroutine_handle<> t_continuation)
+            noexcept -> void
+        {
+            m_continuation = t_continuation;
+        }
+
+    protected:
+        auto rethrow_if_exception() const -> void
+        {
+            if (m_exception) {
+                std::rethrow_exception(m_exception);
+            }
+        }
+
+    private:
+        std::coroutine_handle<> m_continuation;
+        std::exception_ptr m_exception;
+    };
+
+    template <typename T>
+    class TaskPromise : public TaskPromiseBase
+    {
+    public:
+        [[nodiscard]] auto get_return_object() noexcept -> Task<T>;
+
+        template <typename U>
+        auto return_value(U&& t_value) -> void
+        {
+            m_value.emplace(std::forward<U>(t_value));
+        }
+
+        [[nodiscard]] auto result() -> T
+        {
+            rethrow_if_exception();
+            return std::move(*m_value);
+        }
+
+    private:
+        std::optional<T> m_value;
+    };
+
+    template <>
+    class TaskPromise<void> : public TaskPromiseBase
+    {
+    public:
+        [[nodiscard]] auto get_return_object() noexcept -> Task<void>;
+
+        auto return_void() const noexcept -> void
+        {
+        }
+
+        auto result() const -> void
+        {
+            rethrow_if_exception();
+        }
+    };
+
+    template <typename T = void>
+    class [[nodiscard]] Task
+    {
+    public:
+        using promise_type = TaskPromise<T>;
+        using handle_type = std::coroutine_handle<promise_type>;
+
+        explicit Task(handle_type t_handle) noexcept :
+            m_handle(t_handle)
+        {
+        }
+
+        Task(Task&& t_task) noexcept :
+            m_handle(std::exchange(t_task.m_handle, {}))
+        {
+        }
+
+        Task() = delete;
+        Task(const Task&) = delete;
+
+        ~Task() noexcept
+        {
+            if (m_handle) {
+                m_handle.destroy();
+            }
+        }
+
+        auto operator=(const Task&) -> Task& = delete;
+        auto operator=(Task&&) -> Task& = delete;
+
+        [[nodiscard]] auto await_ready() const noexcept -> bool
+        {
+            return !m_handle || m_handle.done();
+        }
+
+        [[nodiscard]] auto await_suspend(std::coroutine_handle<>
+                                         t_continuation) const noexcept ->
+            std::coroutine_handle<>
+        {
+            m_handle.promise().set_continuation(t_continuation);
+            return m_handle;
+        }
+
+        auto await_resume() const -> T
+        {
+            return m_handle.promise().result();
+        }
+
+    private:
+        handle_type m_handle;
+    };
+
+    template <typename T>
+    auto TaskPromise<T>::get_return_object() noexcept -> Task<T>
+    {
+        return Task<T> {Task<T>::handle_type::from_promise(*this)};
+    }
+
+    inline auto TaskPromise<void>::get_return_object() noexcept -> Task<void>
+    {
+        return Task<void> {Task<void>::handle_type::from_promise(*this)};
+    }
+}
+
+#endif
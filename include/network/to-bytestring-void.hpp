@@ -16,13 +16,13 @@
 #ifndef NETWORK_TO_BYTESTRING_VOID_HPP
 #define NETWORK_TO_BYTESTRING_VOID_HPP
 
-#include "network/bytestring.hpp"       // ByteString
 #include "network/length-type.hpp"      // length_type
+#include "network/sockaddrstorage.hpp"  // SockAddrStorage
 
 namespace Network
 {
     extern auto to_bytestring(const void* data,
-                              length_type size) -> ByteString;
+                              length_type size) -> SockAddrStorage;
 }
 
 #endif
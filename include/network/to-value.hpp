@@ -18,6 +18,7 @@
 
 #include "network/valueerror.hpp"       // ValueError
 
+#include <string_view>  // std::string_view
 #include <type_traits>  // std::is_arithmetic_v
 #include <utility>      // std::cmp_greater(), std::cmp_less(),
                         // std::in_range()
@@ -27,7 +28,7 @@ namespace Network
     template <typename T, typename V>
     requires std::is_arithmetic_v<T>
     and std::is_arithmetic_v<V>
-    auto to_value(const std::string& value_type, V value) -> T
+    auto to_value(std::string_view value_type, V value) -> T
     {
         if (!std::in_range<T>(value)) {
             throw ValueError<T> {value_type, value};
@@ -39,7 +40,7 @@ namespace Network
     template <typename T, typename V>
     requires std::is_arithmetic_v<T>
     and std::is_arithmetic_v<V>
-    auto to_value(const std::string& value_type, V value, T min, T max) -> T
+    auto to_value(std::string_view value_type, V value, T min, T max) -> T
     {
         if (std::cmp_less(value, min) || std::cmp_greater(value, max)) {
             throw ValueError<T> {value_type, value, min, max};
@@ -0,0 +1,50 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_TRACE_HPP
+#define NETWORK_TRACE_HPP
+
+#include "network/tracer.hpp"           // Tracer
+
+#include <sstream>      // std::ostringstream
+
+namespace Network
+{
+#ifdef NETWORK_NO_TRACING
+    constexpr auto is_tracing {false};
+#else
+    constexpr auto is_tracing {true};
+#endif
+
+    // Format and submit a line only if a tracer is present.  When
+    // tracing is compiled out, calls reduce to nothing.
+    template <typename Formatter>
+    auto trace(Tracer* tracer, const Formatter& formatter) -> void
+    {
+        if constexpr (is_tracing) {
+            if (tracer != nullptr) {
+                std::ostringstream oss;
+                formatter(oss);
+                tracer->trace(oss.view());
+            }
+        }
+        else {
+            static_cast<void>(tracer);
+            static_cast<void>(formatter);
+        }
+    }
+}
+
+#endif
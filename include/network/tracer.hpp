@@ -0,0 +1,38 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef NETWORK_TRACER_HPP
+#define NETWORK_TRACER_HPP
+
+#include <string_view>  // std::string_view
+
+namespace Network
+{
+    class Tracer
+    {
+    public:
+        Tracer() noexcept = default;
+        Tracer(const Tracer&) = delete;
+        Tracer(Tracer&&) = delete;
+        virtual ~Tracer() = default;
+        auto operator=(const Tracer&) -> Tracer& = delete;
+        auto operator=(Tracer&&) -> Tracer& = delete;
+
+        virtual auto flush() -> void = 0;
+        virtual auto trace(std::string_view t_line) -> void = 0;
+    };
+}
+
+#endif
@@ -17,12 +17,13 @@
 #define NETWORK_UNIQUESOCKET_HPP
 
 #include "network/socket.hpp"           // Socket
+#include "network/socketdeleter.hpp"    // SocketDeleter
 
 #include <memory>       // std::unique_ptr
 
 namespace Network
 {
-    using UniqueSocket = std::unique_ptr<Socket>;
+    using UniqueSocket = std::unique_ptr<Socket, SocketDeleter>;
 }
 
 #endif
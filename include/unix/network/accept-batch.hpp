@@ -0,0 +1,39 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_ACCEPT_BATCH_HPP
+#define UNIX_NETWORK_ACCEPT_BATCH_HPP
+
+#include "network/os-features.hpp"      // HAVE_ACCEPT4
+
+#ifdef HAVE_ACCEPT4
+
+#include "network/acceptbatch.hpp"      // AcceptBatch
+#include "network/oserror.hpp"          // OsError
+#include "network/socketcore.hpp"       // SocketCore
+
+namespace Network
+{
+    // Drain the listen backlog into the batch.  The listening socket
+    // should be non-blocking, so that the call returns once the
+    // backlog is empty.  Connections accepted before an error remain
+    // in the batch.
+    extern auto accept_batch(const SocketCore& sc,
+                             AcceptBatch& batch) -> OsError;
+}
+
+#endif
+
+#endif
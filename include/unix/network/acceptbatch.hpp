@@ -0,0 +1,71 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_ACCEPTBATCH_HPP
+#define UNIX_NETWORK_ACCEPTBATCH_HPP
+
+#include "network/os-features.hpp"      // HAVE_ACCEPT4
+
+#ifdef HAVE_ACCEPT4
+
+#include "network/bytespan.hpp"         // ByteSpan
+#include "network/handle-type.hpp"      // handle_type
+
+#include <sys/socket.h>     // sockaddr, sockaddr_storage, socklen_t
+
+#include <cstddef>      // std::size_t
+#include <utility>      // std::pair
+#include <vector>       // std::vector
+
+namespace Network
+{
+    // A reusable set of slots for the handles and peer addresses of
+    // accepted connections.  All storage is allocated on
+    // construction.  The batch does not own the handles it holds:
+    // callers take over each handle and must close it.
+    class AcceptBatch
+    {
+    public:
+        using slot_type = std::pair<sockaddr*, socklen_t*>;
+
+        explicit AcceptBatch(std::size_t t_capacity);
+
+        AcceptBatch() = delete;
+        AcceptBatch(const AcceptBatch&) = delete;
+        AcceptBatch(AcceptBatch&&) = delete;
+        ~AcceptBatch() noexcept = default;
+        auto operator=(const AcceptBatch&) -> AcceptBatch& = delete;
+        auto operator=(AcceptBatch&&) -> AcceptBatch& = delete;
+
+        [[nodiscard]] auto capacity() const noexcept -> std::size_t;
+        [[nodiscard]] auto handle(std::size_t t_index) const -> handle_type;
+        [[nodiscard]] auto is_full() const noexcept -> bool;
+        [[nodiscard]] auto peer(std::size_t t_index) const -> ByteSpan;
+        [[nodiscard]] auto size() const noexcept -> std::size_t;
+        auto clear() noexcept -> void;
+        auto push(handle_type t_handle) -> void;
+        [[nodiscard]] auto slot() -> slot_type;
+
+    private:
+        std::vector<handle_type> m_handles;
+        std::vector<socklen_t> m_lengths;
+        std::vector<sockaddr_storage> m_names;
+        std::size_t m_size {0};
+    };
+}
+
+#endif
+
+#endif
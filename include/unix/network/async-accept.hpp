@@ -0,0 +1,38 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_ASYNC_ACCEPT_HPP
+#define UNIX_NETWORK_ASYNC_ACCEPT_HPP
+
+#include "network/os-features.hpp"      // HAVE_EPOLL
+
+#ifdef HAVE_EPOLL
+
+#include "network/acceptdata.hpp"       // AcceptData
+#include "network/eventloop.hpp"        // EventLoop
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/task.hpp"             // Task
+
+namespace Network
+{
+    // Accept from a non-blocking listening socket, suspending only
+    // while no connection is pending.
+    extern auto async_accept(EventLoop& loop,
+                             SocketCore sc) -> Task<AcceptData>;
+}
+
+#endif
+
+#endif
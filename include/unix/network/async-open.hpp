@@ -0,0 +1,40 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_ASYNC_OPEN_HPP
+#define UNIX_NETWORK_ASYNC_OPEN_HPP
+
+#include "network/os-features.hpp"      // HAVE_EPOLL
+
+#ifdef HAVE_EPOLL
+
+#include "network/bytespan.hpp"         // ByteSpan
+#include "network/eventloop.hpp"        // EventLoop
+#include "network/opensymbol.hpp"       // OpenSymbol
+#include "network/oserror.hpp"          // OsError
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/task.hpp"             // Task
+
+namespace Network
+{
+    extern auto async_open(EventLoop& loop,
+                           SocketCore sc,
+                           ByteSpan bs,
+                           OpenSymbol symbol) -> Task<OsError>;
+}
+
+#endif
+
+#endif
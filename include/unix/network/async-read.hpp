@@ -0,0 +1,41 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_ASYNC_READ_HPP
+#define UNIX_NETWORK_ASYNC_READ_HPP
+
+#include "network/os-features.hpp"      // HAVE_EPOLL
+
+#ifdef HAVE_EPOLL
+
+#include "network/charspan.hpp"         // CharSpan
+#include "network/eventloop.hpp"        // EventLoop
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/task.hpp"             // Task
+
+#include <sys/types.h>      // ssize_t
+
+namespace Network
+{
+    // Read from a non-blocking socket, suspending only while no data
+    // is available.
+    extern auto async_read(EventLoop& loop,
+                           SocketCore sc,
+                           CharSpan cs) -> Task<ssize_t>;
+}
+
+#endif
+
+#endif
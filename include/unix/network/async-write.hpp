@@ -0,0 +1,42 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_ASYNC_WRITE_HPP
+#define UNIX_NETWORK_ASYNC_WRITE_HPP
+
+#include "network/os-features.hpp"      // HAVE_EPOLL
+
+#ifdef HAVE_EPOLL
+
+#include "network/eventloop.hpp"        // EventLoop
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/task.hpp"             // Task
+
+#include <sys/types.h>      // ssize_t
+
+#include <string_view>  // std::string_view
+
+namespace Network
+{
+    // Write to a non-blocking socket, suspending only while its send
+    // buffer is full.
+    extern auto async_write(EventLoop& loop,
+                            SocketCore sc,
+                            std::string_view sv) -> Task<ssize_t>;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,28 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_ASYNC_HPP
+#define UNIX_NETWORK_ASYNC_HPP
+
+#include "network/async-accept.hpp"     // async_accept()
+#include "network/async-open.hpp"       // async_open()
+#include "network/async-read.hpp"       // async_read()
+#include "network/async-write.hpp"      // async_write()
+#include "network/eventawaiter.hpp"     // EventAwaiter
+#include "network/eventloop.hpp"        // EventLoop
+#include "network/spawn.hpp"            // spawn()
+#include "network/task.hpp"             // Task
+
+#endif
@@ -0,0 +1,43 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_CONNECTOPTIONS_HPP
+#define UNIX_NETWORK_CONNECTOPTIONS_HPP
+
+#include <chrono>       // std::chrono::milliseconds,
+                        // std::chrono::seconds,
+                        // std::chrono::steady_clock
+#include <string_view>  // std::string_view
+
+namespace Network
+{
+    struct ConnectOptions
+    {
+        using duration = std::chrono::steady_clock::duration;
+
+        // RFC 8305 recommends waiting 250 ms after starting one
+        // attempt before starting the next.
+        duration m_attempt_delay {std::chrono::milliseconds {250}};  // NOLINT
+        duration m_timeout {std::chrono::seconds {30}};             // NOLINT
+
+        // Data to send on the winning connection.  With TCP Fast
+        // Open it travels in the SYN of every attempt, so it must be
+        // safe for a server to receive more than once.
+        std::string_view m_data;                                    // NOLINT
+        bool m_is_fastopen {false};                                 // NOLINT
+    };
+}
+
+#endif
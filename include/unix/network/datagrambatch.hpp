@@ -0,0 +1,72 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_DATAGRAMBATCH_HPP
+#define UNIX_NETWORK_DATAGRAMBATCH_HPP
+
+#include "network/os-features.hpp"      // HAVE_RECVMMSG
+
+#ifdef HAVE_RECVMMSG
+
+#include "network/bytespan.hpp"         // ByteSpan
+#include "network/charspan.hpp"         // CharSpan
+
+#include <sys/socket.h>     // mmsghdr, sockaddr_storage
+#include <sys/uio.h>        // iovec
+
+#include <cstddef>      // std::size_t
+#include <span>         // std::span
+#include <string_view>  // std::string_view
+#include <vector>       // std::vector
+
+namespace Network
+{
+    // A reusable set of message headers for ::recvmmsg() and
+    // ::sendmmsg().  Each message refers to one caller-provided
+    // buffer and to an internal peer address slot, so no memory is
+    // allocated after construction.
+    class DatagramBatch
+    {
+    public:
+        explicit DatagramBatch(std::span<const CharSpan> t_buffers);
+
+        DatagramBatch() = delete;
+        DatagramBatch(const DatagramBatch&) = delete;
+        DatagramBatch(DatagramBatch&&) = delete;
+        ~DatagramBatch() noexcept = default;
+        auto operator=(const DatagramBatch&) -> DatagramBatch& = delete;
+        auto operator=(DatagramBatch&&) -> DatagramBatch& = delete;
+
+        [[nodiscard]] auto capacity() const noexcept -> std::size_t;
+        [[nodiscard]] auto data(std::size_t t_index) const ->
+            std::string_view;
+        [[nodiscard]] auto headers() noexcept -> std::span<mmsghdr>;
+        [[nodiscard]] auto peer(std::size_t t_index) const -> ByteSpan;
+        auto prepare(std::size_t t_index,
+                     std::size_t t_length,
+                     ByteSpan t_peer) -> void;
+        auto reset() noexcept -> void;
+
+    private:
+        std::vector<CharSpan> m_buffers;
+        std::vector<iovec> m_iov;
+        std::vector<sockaddr_storage> m_names;
+        std::vector<mmsghdr> m_headers;
+    };
+}
+
+#endif
+
+#endif
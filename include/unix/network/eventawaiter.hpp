@@ -0,0 +1,63 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_EVENTAWAITER_HPP
+#define UNIX_NETWORK_EVENTAWAITER_HPP
+
+#include "network/os-features.hpp"      // HAVE_EPOLL
+
+#ifdef HAVE_EPOLL
+
+#include "network/eventloop.hpp"        // EventLoop
+#include "network/handle-type.hpp"      // handle_type
+#include "network/oserror.hpp"          // OsError
+
+#include <coroutine>    // std::coroutine_handle
+
+namespace Network
+{
+    // Suspends a coroutine until a handle is ready.  The awaiting
+    // operation should first be tried without waiting, and should
+    // await this only if it failed with EAGAIN.
+    class EventAwaiter
+    {
+    public:
+        EventAwaiter(EventLoop& t_loop,
+                     handle_type t_handle,
+                     EventLoop::Events t_events) noexcept;
+
+        EventAwaiter() = delete;
+        EventAwaiter(const EventAwaiter&) = delete;
+        EventAwaiter(EventAwaiter&&) = delete;
+        ~EventAwaiter() noexcept = default;
+        auto operator=(const EventAwaiter&) -> EventAwaiter& = delete;
+        auto operator=(EventAwaiter&&) -> EventAwaiter& = delete;
+
+        [[nodiscard]] auto await_ready() const noexcept -> bool;
+        [[nodiscard]] auto await_suspend(std::coroutine_handle<> t_handle) ->
+            bool;
+        [[nodiscard]] auto await_resume() -> OsError;
+
+    private:
+        OsError m_error;
+        EventLoop& m_loop;
+        handle_type m_handle;
+        EventLoop::Events m_events;
+    };
+}
+
+#endif
+
+#endif
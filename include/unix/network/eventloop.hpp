@@ -0,0 +1,135 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_EVENTLOOP_HPP
+#define UNIX_NETWORK_EVENTLOOP_HPP
+
+#include "network/os-features.hpp"      // HAVE_EPOLL
+
+#ifdef HAVE_EPOLL
+
+#include "network/handle-null.hpp"      // handle_null
+#include "network/handle-type.hpp"      // handle_type
+#include "network/handlegenerations.hpp" // HandleGenerations
+#include "network/oserror.hpp"          // OsError
+#include "network/runtime.hpp"          // Runtime
+#include "network/uniquesocket.hpp"     // UniqueSocket
+
+#include <sys/epoll.h>      // EPOLLERR, EPOLLHUP, EPOLLIN, EPOLLOUT,
+                            // epoll_event
+
+#include <coroutine>    // std::coroutine_handle
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint32_t
+#include <functional>   // std::function
+#include <unordered_map>        // std::unordered_map
+#include <vector>       // std::vector
+
+namespace Network
+{
+    class EventLoop
+    {
+    public:
+        using Events = std::uint32_t;
+        using Callback = std::function<void(handle_type, Events)>;
+
+        static constexpr Events events_error {EPOLLERR | EPOLLHUP};
+        static constexpr Events events_read {EPOLLIN};
+        static constexpr Events events_write {EPOLLOUT};
+
+        explicit EventLoop(const Runtime* t_rt, int t_size = 256);
+
+        EventLoop() = delete;
+        EventLoop(const EventLoop&) = delete;
+        EventLoop(EventLoop&&) = delete;
+        ~EventLoop() noexcept;
+        auto operator=(const EventLoop&) -> EventLoop& = delete;
+        auto operator=(EventLoop&&) -> EventLoop& = delete;
+
+        // Register a handle owned by the caller.
+        auto add(handle_type t_handle,
+                 Events t_events,
+                 Callback t_callback) -> OsError;
+
+        // Register a socket owned by the loop until it is removed.
+        auto add(UniqueSocket t_socket,
+                 Events t_events,
+                 Callback t_callback) -> OsError;
+
+        auto modify(handle_type t_handle, Events t_events) -> OsError;
+        auto remove(handle_type t_handle) -> OsError;
+        auto run() -> OsError;
+        auto run_once(int t_timeout) -> OsError;
+        auto stop() noexcept -> void;
+
+        // Resume a coroutine once a handle becomes ready for reading
+        // or writing.  The handle is registered edge-triggered the
+        // first time it is awaited and stays registered until it is
+        // removed or closed, so later waits make no system calls.
+        // Callers should wait only after an operation has failed
+        // with EAGAIN, as an edge that came earlier is not replayed.
+        // Throws LogicError if the handle was registered by add().
+        auto wait(handle_type t_handle,
+                  Events t_events,
+                  std::coroutine_handle<> t_waiter) -> OsError;
+
+        // Return true if an awaited handle has reported a hang-up or
+        // error, after which an operation that would block will not
+        // become ready.
+        [[nodiscard]] auto is_hung_up(handle_type t_handle) const noexcept ->
+            bool;
+        [[nodiscard]] auto runtime() const noexcept -> const Runtime*;
+        [[nodiscard]] auto size() const noexcept -> std::size_t;
+
+    protected:
+        auto control(int t_operation,
+                     handle_type t_handle,
+                     Events t_events) const -> OsError;
+
+    private:
+        struct Entry
+        {
+            Callback m_callback;
+            UniqueSocket m_socket;
+        };
+
+        struct Waiters
+        {
+            std::coroutine_handle<> m_reader {};
+            std::coroutine_handle<> m_writer {};
+            HandleGenerations::generation_type m_generation {0};
+            bool m_is_hung_up {false};
+        };
+
+        using EntryMap = std::unordered_map<handle_type, Entry>;
+        using WaitersMap = std::unordered_map<handle_type, Waiters>;
+
+        auto resume(Waiters& t_waiters, Events t_events) -> void;
+
+        EntryMap m_entries;
+        WaitersMap m_waiters;
+        std::vector<EntryMap::node_type> m_retired;
+        std::vector<epoll_event> m_events;
+        const Runtime* m_rt;
+        std::size_t m_pending {0};
+        handle_type m_handle {handle_null};
+        bool m_is_dispatching {false};
+        bool m_is_stopping {false};
+    };
+}
+
+#endif
+
+#endif
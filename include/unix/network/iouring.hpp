@@ -0,0 +1,93 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_IOURING_HPP
+#define UNIX_NETWORK_IOURING_HPP
+
+#include "network/os-features.hpp"      // HAVE_IO_URING
+
+#ifdef HAVE_IO_URING
+
+#include "network/handle-null.hpp"      // handle_null
+#include "network/handle-type.hpp"      // handle_type
+#include "network/oserror.hpp"          // OsError
+#include "network/runtime.hpp"          // Runtime
+
+#include <linux/io_uring.h>     // io_uring_cqe, io_uring_sqe
+#include <sys/uio.h>            // iovec
+
+#include <cstddef>      // std::size_t
+#include <span>         // std::span
+
+namespace Network
+{
+    class IoUring
+    {
+    public:
+        IoUring(const Runtime* t_rt, unsigned t_entries);
+
+        IoUring() = delete;
+        IoUring(const IoUring&) = delete;
+        IoUring(IoUring&&) = delete;
+        ~IoUring() noexcept;
+        auto operator=(const IoUring&) -> IoUring& = delete;
+        auto operator=(IoUring&&) -> IoUring& = delete;
+
+        [[nodiscard]] auto get_sqe() noexcept -> io_uring_sqe*;
+        [[nodiscard]] auto is_overflowed() const noexcept -> bool;
+        [[nodiscard]] auto peek_cqe() const noexcept -> const io_uring_cqe*;
+        auto seen_cqe() noexcept -> void;
+        auto flush() -> OsError;
+        auto register_buffers(std::span<const iovec> t_iovecs) -> OsError;
+        auto submit(unsigned t_wait) -> OsError;
+
+    private:
+        struct Region
+        {
+            void* m_data {nullptr};
+            std::size_t m_size {0};
+        };
+
+        auto enter(unsigned t_count,
+                   unsigned t_wait,
+                   unsigned t_flags) -> OsError;
+        auto map(Region& t_region, std::size_t t_size,
+                 long long t_offset) -> void;
+        static auto unmap(Region& t_region) noexcept -> void;
+
+        Region m_sq;
+        Region m_cq;
+        Region m_sqes;
+        const Runtime* m_rt;
+        unsigned* m_sq_head {nullptr};
+        unsigned* m_sq_tail {nullptr};
+        unsigned* m_sq_array {nullptr};
+        unsigned* m_sq_flags {nullptr};
+        unsigned* m_cq_head {nullptr};
+        unsigned* m_cq_tail {nullptr};
+        io_uring_sqe* m_sqe_base {nullptr};
+        io_uring_cqe* m_cqe_base {nullptr};
+        unsigned m_sq_entries {0};
+        unsigned m_sq_mask {0};
+        unsigned m_cq_mask {0};
+        unsigned m_sqe_tail {0};
+        handle_type m_handle {handle_null};
+        bool m_has_buffers {false};
+    };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,37 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_MESSAGEDATA_HPP
+#define UNIX_NETWORK_MESSAGEDATA_HPP
+
+#ifndef _WIN32
+
+#include <sys/types.h>      // ssize_t
+
+#include <cstddef>      // std::size_t
+
+namespace Network
+{
+    struct MessageData
+    {
+        ssize_t m_size {0};                     // NOLINT
+        std::size_t m_control_length {0};       // NOLINT
+        int m_flags {0};                        // NOLINT
+    };
+}
+
+#endif
+
+#endif
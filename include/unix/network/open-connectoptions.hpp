@@ -0,0 +1,34 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_OPEN_CONNECTOPTIONS_HPP
+#define UNIX_NETWORK_OPEN_CONNECTOPTIONS_HPP
+
+#include "network/connectoptions.hpp"   // ConnectOptions
+#include "network/openinputs.hpp"       // OpenInputs
+#include "network/socketresult.hpp"     // SocketResult
+
+namespace Network
+{
+    // Race connection attempts to each resolved address, alternating
+    // between address families and staggering the starts as in RFC
+    // 8305 ("Happy Eyeballs"), and return the first socket to
+    // connect.  The losing attempts are closed.  A failed lookup is
+    // returned as an error, like a failed connect.
+    extern auto open(const OpenInputs& oi,
+                     const ConnectOptions& options) -> SocketResult;
+}
+
+#endif
@@ -0,0 +1,41 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_REAP_ZEROCOPY_HPP
+#define UNIX_NETWORK_REAP_ZEROCOPY_HPP
+
+#include "network/os-features.hpp"      // HAVE_ZEROCOPY
+
+#ifdef HAVE_ZEROCOPY
+
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/zerocopycompletion.hpp" // ZeroCopyCompletion
+
+#include <cstddef>      // std::size_t
+#include <span>         // std::span
+
+namespace Network
+{
+    // Drain pending completion notifications from the socket error
+    // queue without blocking, returning the number of entries
+    // stored.
+    extern auto reap_zerocopy(const SocketCore& sc,
+                              std::span<ZeroCopyCompletion> completions) ->
+        std::size_t;
+}
+
+#endif
+
+#endif
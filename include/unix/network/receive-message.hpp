@@ -0,0 +1,39 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_RECEIVE_MESSAGE_HPP
+#define UNIX_NETWORK_RECEIVE_MESSAGE_HPP
+
+#ifndef _WIN32
+
+#include "network/charspan.hpp"         // CharSpan
+#include "network/messagedata.hpp"      // MessageData
+#include "network/socketcore.hpp"       // SocketCore
+
+#include <cstddef>      // std::byte
+#include <span>         // std::span
+
+namespace Network
+{
+    // The control buffer must be suitably aligned for cmsghdr.
+    extern auto receive_message(const SocketCore& sc,
+                                std::span<const CharSpan> css,
+                                std::span<std::byte> control = {},
+                                int flags = 0) -> MessageData;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,43 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_SEND_FILE_HPP
+#define UNIX_NETWORK_SEND_FILE_HPP
+
+#include "network/os-features.hpp"      // HAVE_SENDFILE
+
+#ifdef HAVE_SENDFILE
+
+#include "network/handle-type.hpp"      // handle_type
+#include "network/socketcore.hpp"       // SocketCore
+
+#include <sys/types.h>      // off_t, ssize_t
+
+#include <cstddef>      // std::size_t
+
+namespace Network
+{
+    // Returns the number of bytes sent, which is short of the length
+    // requested at the end of file or if a later call fails.  Throws
+    // only if nothing could be sent.
+    extern auto send_file(const SocketCore& sc,
+                          handle_type handle,
+                          off_t offset,
+                          std::size_t length) -> ssize_t;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,41 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_SEND_ZEROCOPY_HPP
+#define UNIX_NETWORK_SEND_ZEROCOPY_HPP
+
+#include "network/os-features.hpp"      // HAVE_ZEROCOPY
+
+#ifdef HAVE_ZEROCOPY
+
+#include "network/socketcore.hpp"       // SocketCore
+
+#include <sys/types.h>      // ssize_t
+
+#include <string_view>  // std::string_view
+
+namespace Network
+{
+    // Send without copying the payload into the kernel.  The socket
+    // must have SO_ZEROCOPY enabled, and the caller must leave the
+    // buffer untouched until reap_zerocopy() reports the send done.
+    extern auto send_zerocopy(const SocketCore& sc,
+                              std::string_view sv,
+                              int flags = 0) -> ssize_t;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,108 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_SHARDEDLISTENER_HPP
+#define UNIX_NETWORK_SHARDEDLISTENER_HPP
+
+#include "network/os-features.hpp"      // HAVE_ACCEPT4, HAVE_REUSEPORT
+
+#if defined(HAVE_ACCEPT4) && defined(HAVE_REUSEPORT)
+
+#include "network/endpointview.hpp"     // EndpointView
+#include "network/oserror.hpp"          // OsError
+#include "network/runtime.hpp"          // Runtime
+#include "network/sockaddrstorage.hpp"  // SockAddrStorage
+#include "network/sockethints.hpp"      // SocketHints
+#include "network/uniquesocket.hpp"     // UniqueSocket
+
+#include <atomic>       // std::atomic
+#include <cstddef>      // std::size_t
+#include <functional>   // std::function
+#include <memory>       // std::unique_ptr
+#include <mutex>        // std::mutex
+#include <stop_token>   // std::stop_token
+#include <thread>       // std::jthread
+#include <vector>       // std::vector
+
+namespace Network
+{
+    // Listens on one endpoint with several sockets bound using
+    // SO_REUSEPORT, so that the kernel spreads incoming connections
+    // across them, and accepts on each socket in its own thread.
+    // The handler is called concurrently from every shard with each
+    // accepted socket, which is non-blocking.  A shard backs off and
+    // retries when accepting fails for lack of descriptors or memory.
+    // Any other failure, or an exception thrown by the handler, closes
+    // the shard's socket, so that the kernel stops routing connections
+    // to it, and stops the shard, whose error can then be read.  A
+    // closed shard is not restarted.
+    class ShardedListener
+    {
+    public:
+        using Handler = std::function<void(UniqueSocket, std::size_t)>;
+
+        static constexpr int backlog_default {1024};
+        static constexpr std::size_t batch_size {64};
+        static constexpr int poll_timeout {100};
+
+        // A shard count of zero means one shard per hardware thread.
+        ShardedListener(const EndpointView& t_endpoint,
+                        const SocketHints& t_hints,
+                        const Runtime* t_rt,
+                        std::size_t t_shard_count = 0,
+                        bool t_is_pinned = false,
+                        int t_backlog = backlog_default);
+
+        ShardedListener() = delete;
+        ShardedListener(const ShardedListener&) = delete;
+        ShardedListener(ShardedListener&&) = delete;
+        ~ShardedListener() noexcept;
+        auto operator=(const ShardedListener&) -> ShardedListener& = delete;
+        auto operator=(ShardedListener&&) -> ShardedListener& = delete;
+
+        auto start(Handler t_handler) -> void;
+        auto stop() noexcept -> void;
+
+        [[nodiscard]] auto accepted() const noexcept -> std::size_t;
+        [[nodiscard]] auto accepted(std::size_t t_shard) const ->
+            std::size_t;
+        [[nodiscard]] auto error(std::size_t t_shard) const -> OsError;
+        [[nodiscard]] auto name() const noexcept -> const SockAddrStorage&;
+        [[nodiscard]] auto shard_count() const noexcept -> std::size_t;
+
+    private:
+        struct Shard
+        {
+            UniqueSocket m_socket;
+            OsError m_error;
+            std::atomic<std::size_t> m_accepted {0};
+            mutable std::mutex m_mutex;
+        };
+
+        static auto fail(Shard& t_shard, const OsError& t_error) -> void;
+        auto run(std::stop_token t_token, std::size_t t_shard) -> void;
+
+        Handler m_handler;
+        std::vector<std::unique_ptr<Shard>> m_shards;
+        std::vector<std::jthread> m_threads;
+        SockAddrStorage m_name;
+        const Runtime* m_rt;
+        bool m_is_pinned;
+    };
+}
+
+#endif
+
+#endif
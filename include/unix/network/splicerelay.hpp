@@ -0,0 +1,74 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_SPLICERELAY_HPP
+#define UNIX_NETWORK_SPLICERELAY_HPP
+
+#include "network/os-features.hpp"      // HAVE_SPLICE
+
+#ifdef HAVE_SPLICE
+
+#include "network/handle-null.hpp"      // handle_null
+#include "network/handle-type.hpp"      // handle_type
+#include "network/runtime.hpp"          // Runtime
+#include "network/socketcore.hpp"       // SocketCore
+
+#include <array>        // std::array
+#include <cstddef>      // std::size_t
+
+namespace Network
+{
+    // Moves stream data from one socket to another through a pipe
+    // with ::splice(), so the payload never enters user space.  The
+    // pipe is created once and reused by every call to relay().  A
+    // failed call closes the pipe, discarding any bytes still in it,
+    // so that they cannot reach the output of a later call, which
+    // opens a new pipe.  A relay keeps state between calls and must
+    // not be used by more than one thread at a time.
+    class SpliceRelay
+    {
+    public:
+        explicit SpliceRelay(const Runtime* t_rt,
+                             std::size_t t_chunk_size = 65536);
+
+        SpliceRelay() = delete;
+        SpliceRelay(const SpliceRelay&) = delete;
+        SpliceRelay(SpliceRelay&&) = delete;
+        ~SpliceRelay() noexcept;
+        auto operator=(const SpliceRelay&) -> SpliceRelay& = delete;
+        auto operator=(SpliceRelay&&) -> SpliceRelay& = delete;
+
+        auto relay(const SocketCore& t_input,
+                   const SocketCore& t_output,
+                   std::size_t t_length) -> std::size_t;
+
+    protected:
+        auto close_pipe() noexcept -> void;
+        auto open_pipe() -> void;
+        auto splice(const SocketCore& t_sc,
+                    handle_type t_input,
+                    handle_type t_output,
+                    std::size_t t_length) const -> std::size_t;
+
+    private:
+        std::array<handle_type, 2> m_pipe {handle_null, handle_null};
+        const Runtime* m_rt;
+        std::size_t m_chunk_size;
+    };
+}
+
+#endif
+
+#endif
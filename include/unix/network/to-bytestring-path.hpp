@@ -18,13 +18,13 @@
 
 #ifndef _WIN32
 
-#include "network/bytestring.hpp"       // ByteString
+#include "network/sockaddrstorage.hpp"  // SockAddrStorage
 
 #include <string_view>  // std::string_view
 
 namespace Network
 {
-    extern auto to_bytestring(std::string_view path) -> ByteString;
+    extern auto to_bytestring(std::string_view path) -> SockAddrStorage;
 }
 
 #endif
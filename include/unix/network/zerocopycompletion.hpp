@@ -0,0 +1,47 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef UNIX_NETWORK_ZEROCOPYCOMPLETION_HPP
+#define UNIX_NETWORK_ZEROCOPYCOMPLETION_HPP
+
+#include "network/os-features.hpp"      // HAVE_ZEROCOPY
+
+#ifdef HAVE_ZEROCOPY
+
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint32_t
+
+namespace Network
+{
+    // A contiguous range of zero-copy sends, numbered from zero in
+    // the order they were issued on the socket, whose buffers the
+    // kernel has released.  When the kernel fell back to copying the
+    // data, the range is flagged as copied.
+    struct ZeroCopyCompletion
+    {
+        [[nodiscard]] auto size() const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(m_last - m_first) + 1;
+        }
+
+        std::uint32_t m_first {0};
+        std::uint32_t m_last {0};
+        bool m_is_copied {false};
+    };
+}
+
+#endif
+
+#endif
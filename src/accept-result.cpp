@@ -0,0 +1,149 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/accept-result.hpp"            // accept_result()
+#include "network/acceptdata.hpp"               // AcceptData
+#include "network/acceptresult.hpp"             // AcceptResult
+#include "network/binarybuffer.hpp"             // BinaryBuffer
+#include "network/get-api-error.hpp"            // get_api_error()
+#include "network/handle-null.hpp"              // handle_null
+#include "network/iocounter.hpp"                // IoCounter
+#include "network/iolatency.hpp"                // IoLatency
+#include "network/oserror.hpp"                  // OsError
+#include "network/reset-api-error.hpp"          // reset_api_error()
+#include "network/socketcore.hpp"               // SocketCore
+#include "network/systemcall.hpp"               // SystemCall
+#include "network/to-os-error.hpp"              // to_os_error()
+#include "network/to-string-bytespan.hpp"       // to_string()
+#include "network/trace.hpp"                    // trace()
+
+#ifdef _WIN32
+#include <winsock2.h>       // ::accept()
+#else
+#include <fcntl.h>          // F_GETFL, O_NONBLOCK, ::fcntl()
+#include <sys/socket.h>     // ::accept()
+#endif
+
+#include <cstdint>      // std::int64_t
+#include <expected>     // std::unexpected
+#include <ostream>      // std::ostream
+#include <span>         // std::span
+
+namespace
+{
+    using Network::IoCounter;
+    using Network::SocketCore;
+
+    // Read the clock to time an accept, or return the epoch if the
+    // call is not to be timed.  An accept on a blocking listener
+    // waits for a client, and that idle time is not the cost of the
+    // call, so only non-blocking listeners are timed.  Windows cannot
+    // report whether a socket blocks, so its accepts are not timed.
+    // Querying the mode is itself a system call, and is counted.
+    auto start_accept(const SocketCore& sc) noexcept ->
+        SocketCore::Clock::time_point
+    {
+        constexpr SocketCore::Clock::time_point epoch {};
+#ifdef _WIN32
+        static_cast<void>(sc);
+        return epoch;
+#else
+        if (sc.now() == epoch) {
+            return epoch;
+        }
+
+        sc.count(IoCounter::system_calls);
+
+        if ((::fcntl(sc.handle(), F_GETFL, 0) & O_NONBLOCK) == 0) {  // NOLINT
+            return epoch;
+        }
+
+        return sc.now();
+#endif
+    }
+}
+
+auto Network::accept_result(const SocketCore& sc) -> AcceptResult
+{
+    BinaryBuffer buffer;
+    const std::span bs {buffer};
+    auto [sa, sa_length] {buffer.span()};
+    const auto handle_1 {sc.handle()};
+    auto* const tracer {sc.tracer()};
+
+    trace(tracer, [&](std::ostream& os) {
+        // clang-format off
+        os << "Calling ::accept("
+           << handle_1
+           << ", "
+           << to_string(bs)
+           << ", "
+           << sa_length
+           << ')';
+        // clang-format on
+    });
+
+    sc.count(IoCounter::system_calls);
+    reset_api_error();
+    const auto start {start_accept(sc)};
+    const auto handle_2 {::accept(handle_1, sa, &sa_length)};
+
+    if (start != SocketCore::Clock::time_point {}) {
+        sc.record(IoLatency::accept, start);
+    }
+
+    if (handle_2 == handle_null) {
+        const auto api_error {get_api_error()};
+        const auto os_error {to_os_error(api_error)};
+        sc.count_error(os_error);
+        const SystemCall call {
+            .m_name = "::accept",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", "
+                   << to_string(t_call.m_address)
+                   << ", "
+                   << t_call.m_values[0];
+                // clang-format on
+            },
+            .m_address = bs,
+            .m_values = {static_cast<std::int64_t>(sa_length)},
+            .m_handle = handle_1,
+        };
+        return std::unexpected {OsError {os_error, api_error, call}};
+    }
+
+    sc.count(IoCounter::accepts);
+
+    trace(tracer, [&](std::ostream& os) {
+        const auto str {to_string(buffer)};
+        // clang-format off
+        os << "Call to ::accept("
+           << handle_1
+           << ", "
+           << str
+           << ", "
+           << sa_length
+           << ") returned data {"
+           << handle_2
+           << ", "
+           << str
+           << '}';
+        // clang-format on
+    });
+
+    return AcceptData {*buffer, sc, handle_2};
+}
@@ -16,9 +16,15 @@
 #include "network/accept-socket.hpp"            // accept()
 #include "network/create-socket-acceptdata.hpp" // create_socket()
 #include "network/socket.hpp"                   // Socket
+#include "network/socketslab.hpp"               // SocketSlab
 #include "network/uniquesocket.hpp"             // UniqueSocket
 
 auto Network::accept(const Socket& s) -> UniqueSocket
 {
     return create_socket(s.accept());
 }
+
+auto Network::accept(const Socket& s, SocketSlab& slab) -> UniqueSocket
+{
+    return create_socket(s.accept(), slab);
+}
@@ -14,11 +14,11 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "network/acceptdata.hpp"       // AcceptData
-#include "network/bytestring.hpp"       // ByteString
 #include "network/handle-type.hpp"      // handle_type
+#include "network/sockaddrstorage.hpp"  // SockAddrStorage
 #include "network/socketcore.hpp"       // SocketCore
 
-Network::AcceptData::AcceptData(const ByteString& t_nm,
+Network::AcceptData::AcceptData(const SockAddrStorage& t_nm,
                                 const SocketCore& t_sc,
                                 handle_type t_handle) :
     m_sc(t_sc, t_handle), m_nm(t_nm)
@@ -30,7 +30,7 @@ auto Network::AcceptData::core() const noexcept -> const SocketCore&
     return m_sc;
 }
 
-auto Network::AcceptData::name() const noexcept -> const ByteString&
+auto Network::AcceptData::name() const noexcept -> const SockAddrStorage&
 {
     return m_nm;
 }
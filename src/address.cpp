@@ -36,15 +36,13 @@
 #include <string>       // std::string
 
 Network::Address::Address(ByteSpan t_bs) :
-    m_addr(t_bs.begin(), t_bs.end()),
-    m_span(m_addr)
+    m_addr(t_bs)
 {
 }
 
 auto Network::Address::operator=(ByteSpan t_bs) -> Address&
 {
-    m_addr.assign(t_bs.begin(), t_bs.end());
-    m_span = m_addr;
+    m_addr.assign(t_bs);
     return *this;
 }
 
@@ -16,6 +16,9 @@
 #include "network/addresslist.hpp"      // AddressList
 #include "network/format-ai-error.hpp"  // format_ai_error()
 #include "network/hostnameview.hpp"     // HostnameView
+#include "network/iocounter.hpp"        // IoCounter
+#include "network/iolatency.hpp"        // IoLatency
+#include "network/iostats.hpp"          // IoStats
 #include "network/optionalhints.hpp"    // OptionalHints
 #include "network/oserror.hpp"          // OsError
 #include "network/runtime.hpp"          // Runtime
@@ -23,6 +26,7 @@
 #include "network/stream-addrinfo.hpp"  // operator<<()
 #include "network/string-null.hpp"      // string_null
 #include "network/to-os-error.hpp"      // to_os_error()
+#include "network/trace.hpp"            // trace()
 
 #ifdef _WIN32
 #include <ws2tcpip.h>       // addrinfo, ::freeaddrinfo(), ::getaddrinfo()
@@ -30,8 +34,9 @@
 #include <netdb.h>          // addrinfo, ::freeaddrinfo(), ::getaddrinfo()
 #endif
 
-#include <iostream>     // std::cout, std::endl
+#include <chrono>       // std::chrono::steady_clock
 #include <memory>       // std::make_unique, std::unique_ptr
+#include <ostream>      // std::ostream
 #include <sstream>      // std::ostringstream
 #include <string>       // std::string
 
@@ -86,25 +91,41 @@ Network::AddressList::AddressList(const HostnameView& t_hostname,
     const auto hints_str {to_string(t_hints)};
     const StringOrNull hostname {t_hostname};
     const StringOrNull service {t_service};
+    auto* const stats {t_rt->stats()};
 
-    if (t_rt->is_verbose()) {
+    trace(t_rt->tracer(), [&](std::ostream& os) {
         // clang-format off
-        std::cout << "Calling ::getaddrinfo("
-                  << hostname
-                  << ", "
-                  << service
-                  << ", "
-                  << hints_str
-                  << ", ...)"
-                  << std::endl;
+        os << "Calling ::getaddrinfo("
+           << hostname
+           << ", "
+           << service
+           << ", "
+           << hints_str
+           << ", ...)";
         // clang-format on
+    });
+
+    const auto start {stats != nullptr ?
+                      std::chrono::steady_clock::now() :
+                      std::chrono::steady_clock::time_point {}};
+    const auto error {::getaddrinfo(hostname.c_str(),
+                                    service.c_str(),
+                                    hints_ptr.get(),
+                                    &m_list)};
+
+    if (stats != nullptr) {
+        stats->add(IoCounter::resolves);
+        stats->record(IoLatency::getaddrinfo,
+                      std::chrono::steady_clock::now() - start);
     }
 
-    if (const auto error {::getaddrinfo(hostname.c_str(),
-                                        service.c_str(),
-                                        hints_ptr.get(),
-                                        &m_list)}) {
+    if (error != 0) {
         const auto os_error {to_os_error(error)};
+
+        if (stats != nullptr) {
+            stats->add(IoCounter::resolve_errors);
+        }
+
         std::ostringstream oss;
         // clang-format off
         oss << "Call to ::getaddrinfo("
@@ -120,9 +141,11 @@ Network::AddressList::AddressList(const HostnameView& t_hostname,
         // clang-format on
         m_os_error = {os_error, oss.str()};
     }
-    else if (t_rt->is_verbose()) {
+    else {
         for (const auto& node : *this) {
-            std::cout << node << std::endl;
+            trace(t_rt->tracer(), [&](std::ostream& os) {
+                os << node;
+            });
         }
     }
 }
@@ -0,0 +1,44 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/addrinfoservice.hpp"          // AddrinfoService
+#include "network/addresslist.hpp"              // AddressList
+#include "network/hostnameview.hpp"             // HostnameView
+#include "network/optionalhints.hpp"            // OptionalHints
+#include "network/resolveresult.hpp"            // ResolveResult
+#include "network/runtime.hpp"                  // Runtime
+#include "network/serviceview.hpp"              // ServiceView
+#include "network/sockettemplatevector.hpp"     // SocketTemplateVector
+
+#include <algorithm>    // std::copy()
+#include <expected>     // std::unexpected
+#include <iterator>     // std::back_inserter()
+
+auto Network::AddrinfoService::lookup(const HostnameView& t_hostname,
+                                      const ServiceView& t_service,
+                                      const OptionalHints& t_hints,
+                                      const Runtime* t_rt) const ->
+    ResolveResult
+{
+    const AddressList list {t_hostname, t_service, t_hints, t_rt};
+
+    if (const auto& error {list.error()}) {
+        return std::unexpected {error};
+    }
+
+    SocketTemplateVector stv;
+    std::copy(list.begin(), list.end(), std::back_inserter(stv));
+    return stv;
+}
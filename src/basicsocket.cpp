@@ -0,0 +1,324 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/basicsocket.hpp"              // BasicSocket
+#include "network/accept-socketcore.hpp"        // accept()
+#include "network/acceptdata.hpp"               // AcceptData
+#include "network/bytespan.hpp"                 // ByteSpan
+#include "network/charspan.hpp"                 // CharSpan
+#include "network/close.hpp"                    // close()
+#include "network/datagramdata.hpp"             // DatagramData
+#include "network/family-type.hpp"              // family_type
+#include "network/get-name.hpp"                 // get_name()
+#include "network/handle-type.hpp"              // handle_type
+#include "network/listen.hpp"                   // listen()
+#include "network/logicerror.hpp"               // LogicError
+#include "network/namesymbol.hpp"               // NameSymbol
+#include "network/open-handle.hpp"              // open()
+#include "network/opensymbol.hpp"               // OpenSymbol
+#include "network/os-features.hpp"              // HAVE_SENDFILE
+#include "network/oserror.hpp"                  // OsError
+#include "network/pathname.hpp"                 // Pathname
+#include "network/read-charspans.hpp"           // read()
+#include "network/read.hpp"                     // read()
+#include "network/receive-from.hpp"             // receive_from()
+#include "network/runtime.hpp"                  // Runtime
+#ifdef HAVE_SENDFILE
+#include "network/send-file-path.hpp"           // send_file()
+#include "network/send-file.hpp"                // send_file()
+#endif
+#include "network/send-to.hpp"                  // send_to()
+#include "network/set-nonblocking.hpp"          // set_nonblocking()
+#include "network/shutdown.hpp"                 // shutdown()
+#include "network/socketcore.hpp"               // SocketCore
+#include "network/socketdata.hpp"               // SocketData
+#include "network/symbol.hpp"                   // Symbol
+#ifndef _WIN32
+#include "network/to-path.hpp"                  // to_path()
+#include "network/trace.hpp"                    // trace()
+#endif
+#include "network/write-stringviews.hpp"        // write()
+#include "network/write.hpp"                    // write()
+
+#ifdef _WIN32
+#include <winsock2.h>       // AF_INET, AF_INET6
+#else
+#include <sys/socket.h>     // AF_INET, AF_INET6, AF_UNIX
+#endif
+#include <sys/types.h>      // off_t, ssize_t
+
+#include <cstddef>      // std::size_t
+#ifndef _WIN32
+#include <filesystem>   // std::filesystem
+#include <ostream>      // std::ostream
+#endif
+#include <span>         // std::span
+#include <string_view>  // std::string_view
+#ifndef _WIN32
+#include <system_error> // std::error_code
+#endif
+#include <utility>      // std::exchange(), std::unreachable()
+
+namespace
+{
+    using Network::LogicError;
+    using Network::NameSymbol;
+    using Network::OpenSymbol;
+    using Network::SocketData;
+    using Network::Symbol;
+    using Network::family_type;
+
+    auto to_namesymbol(Symbol symbol) noexcept -> NameSymbol
+    {
+        switch (symbol) {
+        case Symbol::getpeername:
+            return NameSymbol::getpeername;
+        case Symbol::getsockname:
+            return NameSymbol::getsockname;
+        default:
+            std::unreachable();
+        }
+    }
+
+    auto to_symbol(OpenSymbol symbol) noexcept -> Symbol
+    {
+        switch (symbol) {
+        case OpenSymbol::bind:
+            return Symbol::bind;
+        case OpenSymbol::connect:
+            return Symbol::connect;
+        default:
+            std::unreachable();
+        }
+    }
+
+    auto validate(const SocketData& sd, family_type family) -> SocketData
+    {
+        if (sd.core().family() != family) {
+            throw LogicError {"Socket domain/family mismatch"};
+        }
+
+        return sd;
+    }
+}
+
+template <Network::family_type Family>
+Network::BasicSocket<Family>::BasicSocket(handle_type t_handle,
+                                          const Runtime* t_rt) :
+    m_sd(SocketData {t_handle, Family, t_rt})
+{
+}
+
+template <Network::family_type Family>
+Network::BasicSocket<Family>::BasicSocket(const AcceptData& t_ad) :
+    m_sd(validate(SocketData {t_ad}, Family))
+{
+}
+
+template <Network::family_type Family>
+Network::BasicSocket<Family>::BasicSocket(const SocketData& t_sd) :
+    m_sd(validate(t_sd, Family))
+{
+}
+
+template <Network::family_type Family>
+Network::BasicSocket<Family>::BasicSocket(BasicSocket&& t_socket) noexcept :
+    m_sd(std::exchange(t_socket.m_sd, {})),
+    m_path(std::exchange(t_socket.m_path, {}))
+{
+}
+
+template <Network::family_type Family>
+Network::BasicSocket<Family>::~BasicSocket() noexcept
+{
+    static_cast<void>(close());
+}
+
+template <Network::family_type Family>
+auto Network::BasicSocket<Family>::operator=(BasicSocket&& t_socket)
+    noexcept -> BasicSocket&
+{
+    if (this != &t_socket) {
+        static_cast<void>(close());
+        m_sd = std::exchange(t_socket.m_sd, {});
+        m_path = std::exchange(t_socket.m_path, {});
+    }
+
+    return *this;
+}
+
+template <Network::family_type Family>
+auto Network::BasicSocket<Family>::accept() const -> AcceptData
+{
+    return Network::accept(core());
+}
+
+template <Network::family_type Family>
+auto Network::BasicSocket<Family>::close() noexcept -> OsError
+{
+    if (!m_sd) {
+        return {};
+    }
+
+    auto error {Network::close(m_sd->core())};
+
+#ifndef _WIN32
+    if constexpr (is_local) {
+        if (!m_path.empty()) {
+            trace(m_sd->core().tracer(), [&](std::ostream& os) {
+                os << "Calling std::filesystem::remove("
+                   << m_path
+                   << ')';
+            });
+            std::error_code code;
+            static_cast<void>(std::filesystem::remove(m_path, code));
+            m_path.clear();
+        }
+    }
+#endif
+
+    m_sd.reset();
+    return error;
+}
+
+template <Network::family_type Family>
+auto Network::BasicSocket<Family>::get_name(Symbol t_symbol) const ->
+    ByteSpan
+{
+    const auto& sc {core()};
+
+    if (const auto nm {m_sd->name(t_symbol)}; !nm.empty()) {
+        return nm;
+    }
+
+    m_sd->name(t_symbol, Network::get_name(sc, to_namesymbol(t_symbol)));
+    return m_sd->name(t_symbol);
+}
+
+template <Network::family_type Family>
+auto Network::BasicSocket<Family>::listen(int t_backlog) const -> OsError
+{
+    return Network::listen(core(), t_backlog);
+}
+
+template <Network::family_type Family>
+auto Network::BasicSocket<Family>::open(ByteSpan t_bs,
+                                        OpenSymbol t_symbol) -> OsError
+{
+    if (const auto error {Network::open(core(), t_bs, t_symbol)}) {
+        return error;
+    }
+
+    m_sd->name(to_symbol(t_symbol), t_bs);
+
+#ifndef _WIN32
+    if constexpr (is_local) {
+        if (t_symbol == OpenSymbol::bind) {
+            m_path = to_path(get_sockname());
+        }
+    }
+#endif
+
+    return {};
+}
+
+template <Network::family_type Family>
+auto Network::BasicSocket<Family>::read(CharSpan t_cs) const -> ssize_t
+{
+    return Network::read(core(), t_cs);
+}
+
+template <Network::family_type Family>
+auto Network::BasicSocket<Family>::read(std::span<const CharSpan> t_css)
+    const -> ssize_t
+{
+    return Network::read(core(), t_css);
+}
+
+template <Network::family_type Family>
+auto Network::BasicSocket<Family>::receive_from(CharSpan t_cs) const ->
+    DatagramData
+{
+    return Network::receive_from(core(), t_cs);
+}
+
+template <Network::family_type Family>
+auto Network::BasicSocket<Family>::release() noexcept -> handle_type
+{
+    const auto handle {static_cast<handle_type>(*this)};
+    m_sd.reset();
+    m_path = {};
+    return handle;
+}
+
+#ifdef HAVE_SENDFILE
+template <Network::family_type Family>
+auto Network::BasicSocket<Family>::send_file(handle_type t_handle,
+                                             off_t t_offset,
+                                             std::size_t t_length) const ->
+    ssize_t
+{
+    return Network::send_file(core(), t_handle, t_offset, t_length);
+}
+
+template <Network::family_type Family>
+auto Network::BasicSocket<Family>::send_file(const Pathname& t_path,
+                                             off_t t_offset,
+                                             std::size_t t_length) const ->
+    ssize_t
+{
+    return Network::send_file(core(), t_path, t_offset, t_length);
+}
+#endif
+
+template <Network::family_type Family>
+auto Network::BasicSocket<Family>::send_to(std::string_view t_sv,
+                                           ByteSpan t_bs) const -> ssize_t
+{
+    return Network::send_to(core(), t_sv, t_bs);
+}
+
+template <Network::family_type Family>
+auto Network::BasicSocket<Family>::set_nonblocking(bool t_is_nonblocking)
+    const -> OsError
+{
+    return Network::set_nonblocking(core(), t_is_nonblocking);
+}
+
+template <Network::family_type Family>
+auto Network::BasicSocket<Family>::shutdown(int t_how) const -> OsError
+{
+    return Network::shutdown(core(), t_how);
+}
+
+template <Network::family_type Family>
+auto Network::BasicSocket<Family>::write(std::string_view t_sv) const ->
+    ssize_t
+{
+    return Network::write(core(), t_sv);
+}
+
+template <Network::family_type Family>
+auto Network::BasicSocket<Family>::write(std::span<const std::string_view>
+                                         t_svs) const -> ssize_t
+{
+    return Network::write(core(), t_svs);
+}
+
+template class Network::BasicSocket<AF_INET>;
+template class Network::BasicSocket<AF_INET6>;
+#ifndef _WIN32
+template class Network::BasicSocket<AF_UNIX>;
+#endif
@@ -17,8 +17,9 @@
 #include "network/endpointview.hpp"             // EndpointView
 #include "network/open-endpoint.hpp"            // open()
 #include "network/openinputs.hpp"               // OpenInputs
+#include "network/opensetup.hpp"                // OpenSetup
 #include "network/opensymbol.hpp"               // OpenSymbol
-#include "network/run.hpp"                      // run()
+#include "network/run.hpp"                      // run_borrowed()
 #include "network/runtime.hpp"                  // Runtime
 #include "network/sockethints.hpp"              // SocketHints
 #include "network/socketresultvector.hpp"       // SocketResultVector
@@ -31,10 +32,18 @@ auto Network::bind(const EndpointView& endpoint,
     return open(oi, OpenSymbol::bind);
 }
 
+auto Network::bind(const EndpointView& endpoint,
+                   const SocketHints& hints,
+                   const Runtime* rt,
+                   const OpenSetup& setup) -> SocketResultVector
+{
+    const OpenInputs oi {endpoint, hints, rt};
+    return open(oi, OpenSymbol::bind, setup);
+}
+
 auto Network::bind(const EndpointView& endpoint,
                    const SocketHints& hints,
                    bool is_verbose) -> SocketResultVector
 {
-    const auto sr {run(is_verbose)};
-    return bind(endpoint, hints, sr.get());
+    return Network::bind(endpoint, hints, run_borrowed(is_verbose));
 }
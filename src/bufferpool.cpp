@@ -0,0 +1,170 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/bufferpool.hpp"       // BufferPool
+
+#include <array>        // std::array
+#include <bit>          // std::bit_ceil(), std::countr_zero()
+#include <cstddef>      // std::size_t
+#include <new>          // std::align_val_t
+#include <vector>       // std::vector
+
+namespace
+{
+    using Network::BufferPool;
+
+    constexpr auto class_min {std::countr_zero(BufferPool::capacity_min)};
+    constexpr auto class_max {std::countr_zero(BufferPool::capacity_max)};
+    constexpr std::size_t class_count {class_max - class_min + 1};
+
+    auto allocate_block(std::size_t size) -> char*
+    {
+        return static_cast<char*>(::operator new(size,
+                                                 std::align_val_t {
+                                                     BufferPool::alignment
+                                                 }));
+    }
+
+    auto deallocate_block(char* data) noexcept -> void
+    {
+        ::operator delete(data, std::align_val_t {BufferPool::alignment});
+    }
+
+    auto to_class(std::size_t capacity) noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(std::countr_zero(capacity) -
+                                        class_min);
+    }
+
+    class FreeLists
+    {
+    public:
+        FreeLists()
+        {
+            for (auto& list : m_lists) {
+                list.reserve(BufferPool::cache_max);
+            }
+        }
+
+        FreeLists(const FreeLists&) = delete;
+        FreeLists(FreeLists&&) = delete;
+
+        ~FreeLists() noexcept
+        {
+            clear();
+        }
+
+        auto operator=(const FreeLists&) -> FreeLists& = delete;
+        auto operator=(FreeLists&&) -> FreeLists& = delete;
+
+        auto clear() noexcept -> void
+        {
+            for (auto& list : m_lists) {
+                for (auto* const data : list) {
+                    deallocate_block(data);
+                }
+
+                list.clear();
+            }
+        }
+
+        [[nodiscard]] auto pop(std::size_t index) noexcept -> char*
+        {
+            auto& list {m_lists.at(index)};
+
+            if (list.empty()) {
+                return nullptr;
+            }
+
+            auto* const data {list.back()};
+            list.pop_back();
+            return data;
+        }
+
+        [[nodiscard]] auto push(std::size_t index, char* data) noexcept ->
+            bool
+        {
+            auto& list {m_lists.at(index)};
+
+            if (list.size() == BufferPool::cache_max) {
+                return false;
+            }
+
+            list.push_back(data);
+            return true;
+        }
+
+        [[nodiscard]] auto size() const noexcept -> std::size_t
+        {
+            std::size_t result {0};
+
+            for (const auto& list : m_lists) {
+                result += list.size();
+            }
+
+            return result;
+        }
+
+    private:
+        std::array<std::vector<char*>, class_count> m_lists;
+    };
+
+    auto get_free_lists() -> FreeLists&
+    {
+        thread_local FreeLists free_lists;
+        return free_lists;
+    }
+}
+
+auto Network::BufferPool::allocate(std::size_t t_size) -> allocation_type
+{
+    if (t_size > capacity_max) {
+        const auto capacity {(t_size + alignment - 1) / alignment * alignment};
+        return {allocate_block(capacity), capacity};
+    }
+
+    const auto capacity {std::bit_ceil(t_size < capacity_min ?
+                                       capacity_min :
+                                       t_size)};
+
+    if (auto* const data {get_free_lists().pop(to_class(capacity))}) {
+        return {data, capacity};
+    }
+
+    return {allocate_block(capacity), capacity};
+}
+
+auto Network::BufferPool::deallocate(char* t_data,
+                                     std::size_t t_capacity) noexcept -> void
+{
+    if (t_data == nullptr) {
+        return;
+    }
+
+    if (t_capacity > capacity_max ||
+        !get_free_lists().push(to_class(t_capacity), t_data)) {
+        deallocate_block(t_data);
+    }
+}
+
+auto Network::BufferPool::cached() noexcept -> std::size_t
+{
+    return get_free_lists().size();
+}
+
+auto Network::BufferPool::trim() noexcept -> void
+{
+    get_free_lists().clear();
+}
@@ -16,51 +16,54 @@
 #include "network/close.hpp"                    // close()
 #include "network/close-function-name.hpp"      // close_function_name
 #include "network/close-function-pointer.hpp"   // close_function_pointer
-#include "network/format-os-error.hpp"          // format_os_error()
 #include "network/get-api-error.hpp"            // get_api_error()
+#include "network/handlegenerations.hpp"        // HandleGenerations
+#include "network/iocounter.hpp"                // IoCounter
 #include "network/oserror.hpp"                  // OsError
 #include "network/reset-api-error.hpp"          // reset_api_error()
 #include "network/socket-error.hpp"             // socket_error
 #include "network/socketcore.hpp"               // SocketCore
+#include "network/systemcall.hpp"               // SystemCall
 #include "network/to-os-error.hpp"              // to_os_error()
+#include "network/trace.hpp"                    // trace()
 
-#include <iostream>     // std::cout, std::endl
-#include <sstream>      // std::ostringstream
+#include <ostream>      // std::ostream
 
 auto Network::close(const SocketCore& sc) -> OsError
 {
     const auto handle {sc.handle()};
 
-    if (sc.runtime()->is_verbose()) {
+    trace(sc.tracer(), [&](std::ostream& os) {
         // clang-format off
-        std::cout << "Calling "
-                  << close_function_name
-                  << '('
-                  << handle
-                  << ')'
-                  << std::endl;
+        os << "Calling "
+           << close_function_name
+           << '('
+           << handle
+           << ')';
         // clang-format on
-    }
+    });
 
+    // Invalidate any ConnectionTable entries for this descriptor
+    // before it can be reused.
+    HandleGenerations::advance(handle);
+    sc.count(IoCounter::system_calls);
     reset_api_error();
     const auto error {close_function_pointer(handle)};
 
     if (error == socket_error) {
         const auto api_error {get_api_error()};
         const auto os_error {to_os_error(api_error)};
-        std::ostringstream oss;
-        // clang-format off
-        oss << "Call to "
-            << close_function_name
-            << '('
-            << handle
-            << ") failed with error "
-            << api_error
-            << ": "
-            << format_os_error(os_error);
-        // clang-format on
-        return {os_error, oss.str()};
+        sc.count_error(os_error);
+        const SystemCall call {
+            .m_name = close_function_name,
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                os << t_call.m_handle;
+            },
+            .m_handle = handle,
+        };
+        return {os_error, api_error, call};
     }
 
+    sc.count(IoCounter::closes);
     return {};
 }
@@ -18,7 +18,7 @@
 #include "network/open-endpoint.hpp"            // open()
 #include "network/openinputs.hpp"               // OpenInputs
 #include "network/opensymbol.hpp"               // OpenSymbol
-#include "network/run.hpp"                      // run()
+#include "network/run.hpp"                      // run_borrowed()
 #include "network/runtime.hpp"                  // Runtime
 #include "network/sockethints.hpp"              // SocketHints
 #include "network/socketresultvector.hpp"       // SocketResultVector
@@ -35,6 +35,5 @@ auto Network::connect(const EndpointView& endpoint,
                       const SocketHints& hints,
                       bool is_verbose) -> SocketResultVector
 {
-    const auto sr {run(is_verbose)};
-    return connect(endpoint, hints, sr.get());
+    return connect(endpoint, hints, run_borrowed(is_verbose));
 }
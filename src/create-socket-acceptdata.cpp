@@ -17,9 +17,16 @@
 #include "network/acceptdata.hpp"               // AcceptData
 #include "network/create-socket-socketdata.hpp" // create_socket()
 #include "network/socketdata.hpp"               // SocketData
+#include "network/socketslab.hpp"               // SocketSlab
 #include "network/uniquesocket.hpp"             // UniqueSocket
 
 auto Network::create_socket(const AcceptData& ad) -> UniqueSocket
 {
     return create_socket(SocketData {ad});
 }
+
+auto Network::create_socket(const AcceptData& ad,
+                            SocketSlab& slab) -> UniqueSocket
+{
+    return create_socket(SocketData {ad}, slab);
+}
@@ -17,7 +17,7 @@
 #include "network/create-socket-socketdata.hpp" // create_socket()
 #include "network/family-type.hpp"              // family_type
 #include "network/handle-type.hpp"              // handle_type
-#include "network/run.hpp"                      // run()
+#include "network/run.hpp"                      // run_borrowed()
 #include "network/runtime.hpp"                  // Runtime
 #include "network/socketdata.hpp"               // SocketData
 
@@ -32,6 +32,5 @@ auto Network::create_socket(handle_type handle,
                             family_type family,
                             bool is_verbose) -> UniqueSocket
 {
-    const auto sr {run(is_verbose)};
-    return create_socket(handle, family, sr.get());
+    return create_socket(handle, family, run_borrowed(is_verbose));
 }
@@ -16,7 +16,7 @@
 #include "network/create-socket-hints.hpp"      // create_socket()
 #include "network/create-socketresult.hpp"      // create_socketresult()
 #include "network/error.hpp"                    // Error
-#include "network/run.hpp"                      // run()
+#include "network/run.hpp"                      // run_borrowed()
 #include "network/runtime.hpp"                  // Runtime
 #include "network/sockethints.hpp"              // SocketHints
 #include "network/uniquesocket.hpp"             // UniqueSocket
@@ -38,6 +38,5 @@ auto Network::create_socket(const SocketHints& hints,
 auto Network::create_socket(const SocketHints& hints,
                             bool is_verbose) -> UniqueSocket
 {
-    const auto sr {run(is_verbose)};
-    return create_socket(hints, sr.get());
+    return create_socket(hints, run_borrowed(is_verbose));
 }
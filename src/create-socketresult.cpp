@@ -15,19 +15,21 @@
 
 #include "network/create-socketresult.hpp"      // create_socketresult()
 #include "network/create-socket-handle.hpp"     // create_socket()
-#include "network/format-os-error.hpp"          // format_os_error()
 #include "network/format.hpp"                   // Format
 #include "network/get-api-error.hpp"            // get_api_error()
 #include "network/handle-null.hpp"              // handle_null
 #include "network/oserror.hpp"                  // OsError
 #include "network/reset-api-error.hpp"          // reset_api_error()
 #include "network/runtime.hpp"                  // Runtime
+#include "network/socket-hint-type.hpp"         // socket_hint_type
 #include "network/socketfamily.hpp"             // SocketFamily
 #include "network/sockethints.hpp"              // SocketHints
 #include "network/socketprotocol.hpp"           // SocketProtocol
 #include "network/socketresult.hpp"             // SocketResult
 #include "network/sockettype.hpp"               // SocketType
+#include "network/systemcall.hpp"               // SystemCall
 #include "network/to-os-error.hpp"              // to_os_error()
+#include "network/trace.hpp"                    // trace()
 
 #ifdef _WIN32
 #include <winsock2.h>       // ::socket()
@@ -36,8 +38,7 @@
 #endif
 
 #include <expected>     // std::unexpected
-#include <iostream>     // std::cout, std::endl
-#include <sstream>      // std::ostringstream
+#include <ostream>      // std::ostream
 
 auto Network::create_socketresult(const SocketHints& hints,
                                   const Runtime* rt) -> SocketResult
@@ -47,19 +48,18 @@ auto Network::create_socketresult(const SocketHints& hints,
 
     const auto family {hints.m_family};
 
-    if (rt->is_verbose()) {
+    trace(rt->tracer(), [&](std::ostream& os) {
         // clang-format off
-        std::cout << "Calling ::socket("
-                  << Format("domain")
-                  << SocketFamily(family)
-                  << Format(delim, tab, "type")
-                  << SocketType(hints.m_socktype)
-                  << Format(delim, tab, "protocol")
-                  << SocketProtocol(hints.m_protocol, family)
-                  << ')'
-                  << std::endl;
+        os << "Calling ::socket("
+           << Format("domain")
+           << SocketFamily(family)
+           << Format(delim, tab, "type")
+           << SocketType(hints.m_socktype)
+           << Format(delim, tab, "protocol")
+           << SocketProtocol(hints.m_protocol, family)
+           << ')';
         // clang-format on
-    }
+    });
 
     reset_api_error();
     const auto handle {::socket(family,
@@ -68,38 +68,43 @@ auto Network::create_socketresult(const SocketHints& hints,
 
     if (handle == handle_null) {
         const auto api_error {get_api_error()};
-        const auto os_error {to_os_error(api_error)};
-        std::ostringstream oss;
-        // clang-format off
-        oss << "Call to ::socket("
-            << Format("domain")
-            << SocketFamily(family)
-            << Format(delim, tab, "type")
-            << SocketType(hints.m_socktype)
-            << Format(delim, tab, "protocol")
-            << SocketProtocol(hints.m_protocol, family)
-            << ") failed with error "
-            << api_error
-            << ": "
-            << format_os_error(os_error);
-        // clang-format on
-        return std::unexpected {OsError {os_error, oss.str()}};
+        const SystemCall call {
+            .m_name = "::socket",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                const auto& values {t_call.m_values};
+                const auto family_value {
+                    static_cast<socket_hint_type>(values[0])
+                };
+                // clang-format off
+                os << Format("domain")
+                   << SocketFamily(family_value)
+                   << Format(delim, tab, "type")
+                   << SocketType(static_cast<socket_hint_type>(values[1]))
+                   << Format(delim, tab, "protocol")
+                   << SocketProtocol(static_cast<socket_hint_type>(values[2]),
+                                     family_value);
+                // clang-format on
+            },
+            .m_values = {family, hints.m_socktype, hints.m_protocol},
+        };
+        return std::unexpected {
+            OsError {to_os_error(api_error), api_error, call}
+        };
     }
 
-    if (rt->is_verbose()) {
+    trace(rt->tracer(), [&](std::ostream& os) {
         // clang-format off
-        std::cout << "Call to ::socket("
-                  << Format("domain")
-                  << SocketFamily(family)
-                  << Format(delim, tab, "type")
-                  << SocketType(hints.m_socktype)
-                  << Format(delim, tab, "protocol")
-                  << SocketProtocol(hints.m_protocol, family)
-                  << ") returned data "
-                  << handle
-                  << std::endl;
+        os << "Call to ::socket("
+           << Format("domain")
+           << SocketFamily(family)
+           << Format(delim, tab, "type")
+           << SocketType(hints.m_socktype)
+           << Format(delim, tab, "protocol")
+           << SocketProtocol(hints.m_protocol, family)
+           << ") returned data "
+           << handle;
         // clang-format on
-    }
+    });
 
-     return create_socket(handle, family, rt->is_verbose());
+    return create_socket(handle, family, rt);
 }
@@ -0,0 +1,107 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/endpointcache.hpp"    // EndpointCache
+#include "network/bytespan.hpp"         // ByteSpan
+#include "network/endpoint.hpp"         // Endpoint
+#include "network/logicerror.hpp"       // LogicError
+#include "network/sockaddrstorage.hpp"  // SockAddrStorage
+
+#include <cstddef>      // std::size_t
+#include <mutex>        // std::lock_guard
+#include <optional>     // std::nullopt, std::optional
+#include <utility>      // std::move()
+
+Network::EndpointCache::EndpointCache(std::size_t t_capacity) :
+    m_capacity(t_capacity)
+{
+    if (m_capacity == 0) {
+        throw LogicError {"Zero cache capacity"};
+    }
+}
+
+auto Network::EndpointCache::clear() -> void
+{
+    const std::lock_guard lock {m_mutex};
+    m_index.clear();
+    m_entries.clear();
+}
+
+auto Network::EndpointCache::find(ByteSpan t_bs,
+                                  int t_flags) -> std::optional<Endpoint>
+{
+    const auto key {to_key(t_bs, t_flags)};
+    const std::lock_guard lock {m_mutex};
+    const auto it {m_index.find(key)};
+
+    if (it == m_index.end()) {
+        ++m_misses;
+        return std::nullopt;
+    }
+
+    ++m_hits;
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return it->second->second;
+}
+
+auto Network::EndpointCache::insert(ByteSpan t_bs,
+                                    int t_flags,
+                                    const Endpoint& t_endpoint) -> void
+{
+    auto key {to_key(t_bs, t_flags)};
+    const std::lock_guard lock {m_mutex};
+
+    if (const auto it {m_index.find(key)}; it != m_index.end()) {
+        it->second->second = t_endpoint;
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return;
+    }
+
+    if (m_entries.size() == m_capacity) {
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+    }
+
+    m_entries.emplace_front(key, t_endpoint);
+    m_index.emplace(std::move(key), m_entries.begin());
+}
+
+auto Network::EndpointCache::capacity() const noexcept -> std::size_t
+{
+    return m_capacity;
+}
+
+auto Network::EndpointCache::hits() const -> std::size_t
+{
+    const std::lock_guard lock {m_mutex};
+    return m_hits;
+}
+
+auto Network::EndpointCache::misses() const -> std::size_t
+{
+    const std::lock_guard lock {m_mutex};
+    return m_misses;
+}
+
+auto Network::EndpointCache::size() const -> std::size_t
+{
+    const std::lock_guard lock {m_mutex};
+    return m_entries.size();
+}
+
+auto Network::EndpointCache::to_key(ByteSpan t_bs, int t_flags) -> Key
+{
+    return {SockAddrStorage {t_bs}, t_flags};
+}
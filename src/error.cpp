@@ -14,7 +14,9 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "network/error.hpp"            // Error
+#include "network/oserror.hpp"          // OsError
 
+#include <exception>    // std::exception
 #include <string_view>  // std::string_view
 
 Network::Error::Error(std::string_view t_sv) noexcept :
@@ -22,7 +24,27 @@ Network::Error::Error(std::string_view t_sv) noexcept :
 {
 }
 
+Network::Error::Error(const OsError& t_error) noexcept :
+    m_os_error(t_error)
+{
+    try {
+        m_str = m_os_error.string();
+    }
+    catch (const std::exception&) {
+        m_str.clear();
+    }
+}
+
+auto Network::Error::os_error() const noexcept -> const OsError&
+{
+    return m_os_error;
+}
+
 const char* Network::Error::what() const noexcept  // NOLINT
 {
+    if (m_str.empty() && m_os_error) {
+        return "Unable to format system call error";
+    }
+
     return m_str.c_str();
 }
@@ -18,7 +18,7 @@
 #include "network/endpoint.hpp"                 // Endpoint
 #include "network/error.hpp"                    // Error
 #include "network/get-endpointresult.hpp"       // get_endpointresult()
-#include "network/run.hpp"                      // run()
+#include "network/run.hpp"                      // run_borrowed()
 #include "network/runtime.hpp"                  // Runtime
 
 auto Network::get_endpoint(ByteSpan bs,
@@ -38,6 +38,5 @@ auto Network::get_endpoint(ByteSpan bs,
                            int flags,
                            bool is_verbose) -> Endpoint
 {
-    const auto sr {run(is_verbose)};
-    return get_endpoint(bs, flags, sr.get());
+    return get_endpoint(bs, flags, run_borrowed(is_verbose));
 }
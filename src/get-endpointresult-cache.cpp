@@ -0,0 +1,38 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/get-endpointresult-cache.hpp" // get_endpointresult()
+#include "network/bytespan.hpp"                 // ByteSpan
+#include "network/endpointcache.hpp"            // EndpointCache
+#include "network/endpointresult.hpp"           // EndpointResult
+#include "network/get-endpointresult.hpp"       // get_endpointresult()
+#include "network/runtime.hpp"                  // Runtime
+
+auto Network::get_endpointresult(ByteSpan bs, int flags,
+                                 const Runtime* rt,
+                                 EndpointCache& cache) -> EndpointResult
+{
+    if (auto endpoint {cache.find(bs, flags)}) {
+        return *endpoint;
+    }
+
+    auto result {get_endpointresult(bs, flags, rt)};
+
+    if (result) {
+        cache.insert(bs, flags, *result);
+    }
+
+    return result;
+}
@@ -19,8 +19,12 @@
 #include "network/endpoint.hpp"                 // Endpoint
 #include "network/endpointresult.hpp"           // EndpointResult
 #include "network/format-ai-error.hpp"          // format_ai_error()
+#include "network/get-numeric-endpoint.hpp"     // get_numeric_endpoint()
 #include "network/get-sa-span.hpp"              // get_sa_span()
 #include "network/hostname-length-limits.hpp"   // hostname_length_max
+#include "network/iocounter.hpp"                // IoCounter
+#include "network/iolatency.hpp"                // IoLatency
+#include "network/iostats.hpp"                  // IoStats
 #include "network/oserror.hpp"                  // OsError
 #include "network/quote.hpp"                    // quote()
 #include "network/runtime.hpp"                  // Runtime
@@ -28,18 +32,32 @@
 #include "network/textbuffer.hpp"               // TextBuffer
 #include "network/to-os-error.hpp"              // to_os_error()
 #include "network/to-string-bytespan.hpp"       // to_string()
+#include "network/trace.hpp"                    // trace()
 
 #ifdef _WIN32
-#include <ws2tcpip.h>       // ::getnameinfo()
+#include <ws2tcpip.h>       // NI_DGRAM, NI_NUMERICHOST,
+                            // NI_NUMERICSERV, ::getnameinfo()
 #else
-#include <netdb.h>          // ::getnameinfo()
+#include <netdb.h>          // NI_DGRAM, NI_NUMERICHOST,
+                            // NI_NUMERICSERV, ::getnameinfo()
 #endif
 
+#include <chrono>       // std::chrono::steady_clock
 #include <expected>     // std::unexpected
-#include <iostream>     // std::cout, std::endl
+#include <ostream>      // std::ostream
 #include <sstream>      // std::ostringstream
 #include <string_view>  // std::string_view
 
+namespace
+{
+    constexpr auto numeric_flags {NI_NUMERICHOST | NI_NUMERICSERV};
+
+    auto is_numeric(int flags) -> bool
+    {
+        return (flags & ~NI_DGRAM) == numeric_flags;
+    }
+}
+
 auto Network::get_endpointresult(CharSpan hostname,
                                  CharSpan service,
                                  ByteSpan bs, int flags,
@@ -48,36 +66,52 @@ auto Network::get_endpointresult(CharSpan hostname,
     const auto [sa, salen] {get_sa_span(bs)};
     const std::string_view hostname_sv {hostname.data(), hostname.size()};
     const std::string_view service_sv {service.data(), service.size()};
+    auto* const stats {rt->stats()};
 
-    if (rt->is_verbose()) {
+    trace(rt->tracer(), [&](std::ostream& os) {
         // clang-format off
-        std::cout << "Calling ::getnameinfo("
-                  << to_string(bs)
-                  << ", "
-                  << salen
-                  << ", "
-                  << quote(hostname_sv)
-                  << ", "
-                  << hostname_sv.size()
-                  << ", "
-                  << quote(service_sv)
-                  << ", "
-                  << service_sv.size()
-                  << ", "
-                  << flags
-                  << ')'
-                  << std::endl;
+        os << "Calling ::getnameinfo("
+           << to_string(bs)
+           << ", "
+           << salen
+           << ", "
+           << quote(hostname_sv)
+           << ", "
+           << hostname_sv.size()
+           << ", "
+           << quote(service_sv)
+           << ", "
+           << service_sv.size()
+           << ", "
+           << flags
+           << ')';
         // clang-format on
+    });
+
+    const auto start {stats != nullptr ?
+                      std::chrono::steady_clock::now() :
+                      std::chrono::steady_clock::time_point {}};
+    const auto api_error {::getnameinfo(sa,
+                                        salen,
+                                        hostname.data(),
+                                        hostname.size(),
+                                        service.data(),
+                                        service.size(),
+                                        flags)};
+
+    if (stats != nullptr) {
+        stats->add(IoCounter::resolves);
+        stats->record(IoLatency::getnameinfo,
+                      std::chrono::steady_clock::now() - start);
     }
 
-    if (const auto api_error {::getnameinfo(sa,
-                                            salen,
-                                            hostname.data(),
-                                            hostname.size(),
-                                            service.data(),
-                                            service.size(),
-                                            flags)}) {
+    if (api_error != 0) {
         const auto os_error {to_os_error(api_error)};
+
+        if (stats != nullptr) {
+            stats->add(IoCounter::resolve_errors);
+        }
+
         std::ostringstream oss;
         // clang-format off
         oss << "Call to ::getnameinfo("
@@ -103,30 +137,29 @@ auto Network::get_endpointresult(CharSpan hostname,
         return {os_error, oss.str()};
     }
 
-    if (rt->is_verbose()) {
+    trace(rt->tracer(), [&](std::ostream& os) {
         // clang-format off
-        std::cout << "Call to ::getnameinfo("
-                  << to_string(bs)
-                  << ", "
-                  << salen
-                  << ", "
-                  << quote(hostname_sv)
-                  << ", "
-                  << hostname_sv.size()
-                  << ", "
-                  << quote(service_sv)
-                  << ", "
-                  << service_sv.size()
-                  << ", "
-                  << flags
-                  << ") returned data {"
-                  << quote(hostname_sv)
-                  << ", "
-                  << quote(service_sv)
-                  << '}'
-                  << std::endl;
+        os << "Call to ::getnameinfo("
+           << to_string(bs)
+           << ", "
+           << salen
+           << ", "
+           << quote(hostname_sv)
+           << ", "
+           << hostname_sv.size()
+           << ", "
+           << quote(service_sv)
+           << ", "
+           << service_sv.size()
+           << ", "
+           << flags
+           << ") returned data {"
+           << quote(hostname_sv)
+           << ", "
+           << quote(service_sv)
+           << '}';
         // clang-format on
-    }
+    });
 
     return {};
 }
@@ -134,6 +167,12 @@ auto Network::get_endpointresult(CharSpan hostname,
 auto Network::get_endpointresult(ByteSpan bs, int flags,
                                  const Runtime* rt) -> EndpointResult
 {
+    if (is_numeric(flags)) {
+        if (auto endpoint {get_numeric_endpoint(bs)}) {
+            return *endpoint;
+        }
+    }
+
     TextBuffer hostname {hostname_length_max};
     TextBuffer service {service_length_max};
 
@@ -23,6 +23,7 @@
 #include "network/runtime.hpp"                  // Runtime
 #include "network/to-name-length.hpp"           // to_name_length()
 #include "network/to-os-error.hpp"              // to_os_error()
+#include "network/trace.hpp"                    // trace()
 
 #ifdef _WIN32
 #include <winsock2.h>   // ::gethostname()
@@ -30,7 +31,7 @@
 #include <unistd.h>     // ::gethostname()
 #endif
 
-#include <iostream>     // std::cout, std::endl
+#include <ostream>      // std::ostream
 #include <sstream>      // std::ostringstream
 #include <string_view>  // std::string_view
 
@@ -38,16 +39,15 @@ auto Network::get_hostname(CharSpan cs, const Runtime* rt) -> OsError
 {
     const std::string_view sv {cs.data(), cs.size()};
 
-    if (rt->is_verbose()) {
+    trace(rt->tracer(), [&](std::ostream& os) {
         // clang-format off
-        std::cout << "Calling ::gethostname("
-                  << quote(sv)
-                  << ", "
-                  << sv.size()
-                  << ')'
-                  << std::endl;
+        os << "Calling ::gethostname("
+           << quote(sv)
+           << ", "
+           << sv.size()
+           << ')';
         // clang-format on
-    }
+    });
 
     reset_api_error();
 
@@ -68,17 +68,16 @@ auto Network::get_hostname(CharSpan cs, const Runtime* rt) -> OsError
         return {os_error, oss.str()};
     }
 
-    if (rt->is_verbose()) {
+    trace(rt->tracer(), [&](std::ostream& os) {
         // clang-format off
-        std::cout << "Call to ::gethostname("
-                  << quote(sv)
-                  << ", "
-                  << sv.size()
-                  << ") returned data "
-                  << quote(sv)
-                  << std::endl;
+        os << "Call to ::gethostname("
+           << quote(sv)
+           << ", "
+           << sv.size()
+           << ") returned data "
+           << quote(sv);
         // clang-format on
-    }
+    });
 
     return {};
 }
@@ -17,7 +17,7 @@
 #include "network/error.hpp"                    // Error
 #include "network/get-hostnameresult.hpp"       // get_hostname()
 #include "network/hostname.hpp"                 // Hostname
-#include "network/run.hpp"                      // run()
+#include "network/run.hpp"                      // run_borrowed()
 #include "network/runtime.hpp"                  // Runtime
 
 auto Network::get_hostname(const Runtime* rt) -> Hostname
@@ -33,6 +33,5 @@ auto Network::get_hostname(const Runtime* rt) -> Hostname
 
 auto Network::get_hostname(bool is_verbose) -> Hostname
 {
-    const auto sr {run(is_verbose)};
-    return get_hostname(sr.get());
+    return get_hostname(run_borrowed(is_verbose));
 }
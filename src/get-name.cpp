@@ -14,13 +14,14 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "network/get-name.hpp"         // get_name()
-#include "network/bytestring.hpp"       // ByteString
 #include "network/error.hpp"            // Error
 #include "network/get-nameresult.hpp"   // get_nameresult()
 #include "network/namesymbol.hpp"       // NameSymbol
+#include "network/sockaddrstorage.hpp"  // SockAddrStorage
 #include "network/socketcore.hpp"       // SocketCore
 
-auto Network::get_name(const SocketCore& sc, NameSymbol symbol) -> ByteString
+auto Network::get_name(const SocketCore& sc,
+                       NameSymbol symbol) -> SockAddrStorage
 {
     const auto result {get_nameresult(sc, symbol)};
 
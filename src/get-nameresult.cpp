@@ -15,87 +15,87 @@
 
 #include "network/get-nameresult.hpp"           // get_nameresult()
 #include "network/binarybuffer.hpp"             // BinaryBuffer
-#include "network/bytestringresult.hpp"         // ByteStringResult
-#include "network/format-os-error.hpp"          // format_os_error()
 #include "network/get-api-error.hpp"            // get_api_error()
 #include "network/get-namehandler.hpp"          // get_namehandler()
 #include "network/namesymbol.hpp"               // NameSymbol
 #include "network/oserror.hpp"                  // OsError
 #include "network/reset-api-error.hpp"          // reset_api_error()
+#include "network/sockaddrresult.hpp"           // SockAddrResult
 #include "network/socket-error.hpp"             // socket_error
 #include "network/socketcore.hpp"               // SocketCore
+#include "network/systemcall.hpp"               // SystemCall
 #include "network/to-os-error.hpp"              // to_os_error()
 #include "network/to-string-bytespan.hpp"       // to_string()
+#include "network/trace.hpp"                    // trace()
 
+#include <cstdint>      // std::int64_t
 #include <expected>     // std::unexpected
-#include <iostream>     // std::cout, std::endl
+#include <ostream>      // std::ostream
 #include <span>         // std::span
-#include <sstream>      // std::ostringstream
 
 auto Network::get_nameresult(const SocketCore& sc,
-                             NameSymbol symbol) -> ByteStringResult
+                             NameSymbol symbol) -> SockAddrResult
 {
     BinaryBuffer buffer;
     const std::span bs {buffer};
     auto [sa, salen] {buffer.span()};
     const auto handle {sc.handle()};
-    const auto is_verbose {sc.runtime()->is_verbose()};
+    auto* const tracer {sc.tracer()};
     const auto nh {get_namehandler(symbol)};
 
-    if (is_verbose) {
+    trace(tracer, [&](std::ostream& os) {
         // clang-format off
-        std::cout << "Calling "
-                  << nh.string()
-                  << '('
-                  << handle
-                  << ", "
-                  << to_string(bs)
-                  << ", "
-                  << salen
-                  << ')'
-                  << std::endl;
+        os << "Calling "
+           << nh.string()
+           << '('
+           << handle
+           << ", "
+           << to_string(bs)
+           << ", "
+           << salen
+           << ')';
         // clang-format on
-    }
+    });
 
     reset_api_error();
 
     if (nh.function()(handle, sa, &salen) == socket_error) {
         const auto api_error {get_api_error()};
-        const auto os_error {to_os_error(api_error)};
-        std::ostringstream oss;
-        // clang-format off
-        oss << "Call to "
-            << nh.string()
-            << '('
-            << handle
-            << ", "
-            << to_string(bs)
-            << ", "
-            << salen
-            << ") failed with error "
-            << api_error
-            << ": "
-            << format_os_error(os_error);
-        // clang-format on
-        return std::unexpected {OsError {os_error, oss.str()}};
+        const SystemCall call {
+            .m_name = nh.string(),
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", "
+                   << to_string(t_call.m_address)
+                   << ", "
+                   << t_call.m_values[0];
+                // clang-format on
+            },
+            .m_address = bs,
+            .m_values = {static_cast<std::int64_t>(salen)},
+            .m_handle = handle,
+        };
+        return std::unexpected {
+            OsError {to_os_error(api_error), api_error, call}
+        };
     }
 
-    if (is_verbose) {
+    trace(tracer, [&](std::ostream& os) {
         const auto str {to_string(buffer)};
         // clang-format off
-        std::cout << "Call to "
-                  << nh.string()
-                  << '('
-                  << handle
-                  << ", "
-                  << str
-                  << ", "
-                  << salen
-                  << ") returned data "
-                  << str
-                  << std::endl;
+        os << "Call to "
+           << nh.string()
+           << '('
+           << handle
+           << ", "
+           << str
+           << ", "
+           << salen
+           << ") returned data "
+           << str;
         // clang-format on
-    }
+    });
 
     return *buffer;
 }
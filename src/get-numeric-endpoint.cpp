@@ -0,0 +1,168 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/get-numeric-endpoint.hpp"     // get_numeric_endpoint()
+#include "network/bytespan.hpp"                 // ByteSpan
+#include "network/endpoint.hpp"                 // Endpoint
+
+#ifdef _WIN32
+#include <winsock2.h>       // AF_INET, AF_INET6, ntohs(), sockaddr,
+                            // sockaddr_in
+#include <ws2tcpip.h>       // sockaddr_in6
+#else
+#include <netinet/in.h>     // ntohs(), sockaddr_in, sockaddr_in6
+#include <sys/socket.h>     // AF_INET, AF_INET6, sockaddr
+#endif
+
+#include <array>        // std::array
+#include <charconv>     // std::to_chars()
+#include <cstddef>      // std::size_t
+#include <cstring>      // std::memcpy()
+#include <optional>     // std::nullopt, std::optional
+#include <string>       // std::string
+
+namespace
+{
+    using Bytes = std::array<unsigned char, 16>;
+
+    auto append(std::string& str, unsigned value, int base = 10) -> void
+    {
+        std::array<char, 8> buffer {};
+        auto* const first {buffer.data()};
+        const auto [last, ec] {std::to_chars(first,
+                                             first + buffer.size(),
+                                             value,
+                                             base)};
+        static_cast<void>(ec);
+        str.append(first, last);
+    }
+
+    auto append_inet(std::string& str,
+                     const unsigned char* bytes) -> void
+    {
+        for (std::size_t i {0}; i < 4; ++i) {
+            if (i != 0) {
+                str += '.';
+            }
+
+            append(str, bytes[i]);  // NOLINT
+        }
+    }
+
+    // Follow the rules of the GNU C library's ::inet_ntop(): compress
+    // the first longest run of two or more zero words, and print the
+    // last 32 bits of compatible and mapped addresses in dotted-quad
+    // notation.
+    auto append_inet6(std::string& str, const Bytes& bytes) -> void
+    {
+        std::array<unsigned, 8> words {};
+        std::size_t best_base {words.size()};
+        std::size_t best_length {0};
+        std::size_t base {words.size()};
+        std::size_t length {0};
+
+        for (std::size_t i {0}; i < words.size(); ++i) {
+            words[i] = (static_cast<unsigned>(bytes[2 * i]) << 8U) |
+                bytes[2 * i + 1];
+
+            if (words[i] == 0) {
+                if (length == 0) {
+                    base = i;
+                }
+
+                ++length;
+
+                if (length > best_length) {
+                    best_base = base;
+                    best_length = length;
+                }
+            }
+            else {
+                length = 0;
+            }
+        }
+
+        if (best_length < 2) {
+            best_base = words.size();
+            best_length = 0;
+        }
+
+        for (std::size_t i {0}; i < words.size(); ++i) {
+            if (i >= best_base && i < best_base + best_length) {
+                if (i == best_base) {
+                    str += ':';
+                }
+
+                continue;
+            }
+
+            if (i != 0) {
+                str += ':';
+            }
+
+            if (i == 6 && best_base == 0 &&
+                (best_length == 6 ||
+                 (best_length == 5 && words[5] == 0xffffU))) {
+                append_inet(str, bytes.data() + 12);  // NOLINT
+                return;
+            }
+
+            append(str, words[i], 16);
+        }
+
+        if (best_length != 0 && best_base + best_length == words.size()) {
+            str += ':';
+        }
+    }
+}
+
+auto Network::get_numeric_endpoint(ByteSpan bs) -> std::optional<Endpoint>
+{
+    sockaddr sa {};
+
+    if (bs.size() < sizeof sa) {
+        return std::nullopt;
+    }
+
+    std::memcpy(&sa, bs.data(), sizeof sa);
+    Endpoint endpoint;
+
+    if (sa.sa_family == AF_INET && bs.size() >= sizeof(sockaddr_in)) {
+        sockaddr_in sin {};
+        std::memcpy(&sin, bs.data(), sizeof sin);
+        Bytes bytes {};
+        std::memcpy(bytes.data(), &sin.sin_addr, sizeof sin.sin_addr);
+        append_inet(endpoint[0], bytes.data());
+        append(endpoint[1], ntohs(sin.sin_port));
+        return endpoint;
+    }
+
+    if (sa.sa_family == AF_INET6 && bs.size() >= sizeof(sockaddr_in6)) {
+        sockaddr_in6 sin6 {};
+        std::memcpy(&sin6, bs.data(), sizeof sin6);
+
+        if (sin6.sin6_scope_id != 0) {
+            return std::nullopt;
+        }
+
+        Bytes bytes {};
+        std::memcpy(bytes.data(), &sin6.sin6_addr, sizeof sin6.sin6_addr);
+        append_inet6(endpoint[0], bytes);
+        append(endpoint[1], ntohs(sin6.sin6_port));
+        return endpoint;
+    }
+
+    return std::nullopt;
+}
@@ -0,0 +1,117 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/handlegenerations.hpp"        // HandleGenerations
+#include "network/handle-null.hpp"              // handle_null
+#include "network/handle-type.hpp"              // handle_type
+
+#include <array>        // std::array
+#include <atomic>       // std::atomic
+#include <cstddef>      // std::size_t
+
+namespace
+{
+    using Network::HandleGenerations;
+
+    using Chunk = std::array<std::atomic<HandleGenerations::generation_type>,
+                             HandleGenerations::chunk_size>;
+
+    constexpr auto chunk_count {HandleGenerations::index_max /
+                                HandleGenerations::chunk_size};
+
+    // The chunks are never freed, as descriptors may be closed during
+    // static destruction.
+    std::array<std::atomic<Chunk*>, chunk_count> chunks {};  // NOLINT
+
+    auto find_counter(std::size_t index) noexcept ->
+        std::atomic<HandleGenerations::generation_type>*
+    {
+        auto* const chunk {
+            chunks.at(index / HandleGenerations::chunk_size).load(
+                std::memory_order_acquire)
+        };
+
+        if (chunk == nullptr) {
+            return nullptr;
+        }
+
+        return &chunk->at(index % HandleGenerations::chunk_size);
+    }
+}
+
+auto Network::HandleGenerations::advance(handle_type t_handle) noexcept ->
+    void
+{
+    const auto i {index(t_handle)};
+
+    if (i == index_max) {
+        return;
+    }
+
+    if (auto* const counter {find_counter(i)}) {
+        counter->fetch_add(1, std::memory_order_acq_rel);
+    }
+}
+
+auto Network::HandleGenerations::current(handle_type t_handle) noexcept ->
+    generation_type
+{
+    const auto i {index(t_handle)};
+
+    if (i == index_max) {
+        return 0;
+    }
+
+    if (const auto* const counter {find_counter(i)}) {
+        return counter->load(std::memory_order_acquire);
+    }
+
+    return 0;
+}
+
+auto Network::HandleGenerations::index(handle_type t_handle) noexcept ->
+    std::size_t
+{
+    if (t_handle == handle_null) {
+        return index_max;
+    }
+
+    const auto i {static_cast<std::size_t>(t_handle)};
+    return i < index_max ? i : index_max;
+}
+
+auto Network::HandleGenerations::reserve(handle_type t_handle) ->
+    generation_type
+{
+    const auto i {index(t_handle)};
+
+    if (i == index_max) {
+        return 0;
+    }
+
+    auto& slot {chunks.at(i / chunk_size)};
+
+    if (slot.load(std::memory_order_acquire) == nullptr) {
+        auto* const chunk {new Chunk {}};
+        Chunk* expected {nullptr};
+
+        if (!slot.compare_exchange_strong(expected, chunk,
+                                          std::memory_order_acq_rel)) {
+            delete chunk;  // NOLINT
+        }
+    }
+
+    return current(t_handle);
+}
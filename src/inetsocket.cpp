@@ -19,22 +19,46 @@
 #include "network/bytespan.hpp"                 // ByteSpan
 #include "network/charspan.hpp"                 // CharSpan
 #include "network/close.hpp"                    // close()
+#include "network/datagramdata.hpp"             // DatagramData
 #include "network/get-name.hpp"                 // get_name()
 #include "network/handle-type.hpp"              // handle_type
 #include "network/listen.hpp"                   // listen()
 #include "network/namesymbol.hpp"               // NameSymbol
 #include "network/open-handle.hpp"              // open()
 #include "network/opensymbol.hpp"               // OpenSymbol
+#include "network/os-features.hpp"              // HAVE_SENDFILE,
+                                                // HAVE_ZEROCOPY
 #include "network/oserror.hpp"                  // OsError
+#include "network/pathname.hpp"                 // Pathname
+#include "network/read-charspans.hpp"           // read()
 #include "network/read.hpp"                     // read()
+#ifdef HAVE_ZEROCOPY
+#include "network/reap-zerocopy.hpp"            // reap_zerocopy()
+#endif
+#include "network/receive-from.hpp"             // receive_from()
+#ifdef HAVE_SENDFILE
+#include "network/send-file-path.hpp"           // send_file()
+#include "network/send-file.hpp"                // send_file()
+#endif
+#include "network/send-to.hpp"                  // send_to()
+#ifdef HAVE_ZEROCOPY
+#include "network/send-zerocopy.hpp"            // send_zerocopy()
+#endif
+#include "network/set-nonblocking.hpp"          // set_nonblocking()
 #include "network/shutdown.hpp"                 // shutdown()
 #include "network/socketcore.hpp"               // SocketCore
 #include "network/socketdata.hpp"               // SocketData
 #include "network/symbol.hpp"                   // Symbol
+#include "network/write-stringviews.hpp"        // write()
 #include "network/write.hpp"                    // write()
+#ifdef HAVE_ZEROCOPY
+#include "network/zerocopycompletion.hpp"       // ZeroCopyCompletion
+#endif
 
-#include <sys/types.h>      // ssize_t
+#include <sys/types.h>      // off_t, ssize_t
 
+#include <cstddef>      // std::size_t
+#include <span>         // std::span
 #include <string_view>  // std::string_view
 #include <utility>      // std::unreachable()
 
@@ -57,16 +81,19 @@ auto Network::InetSocket::accept() const -> AcceptData
     return Network::accept(core());
 }
 
-auto Network::InetSocket::get_name(Symbol t_symbol) const -> ByteSpan
+auto Network::InetSocket::core() const noexcept -> const SocketCore&
 {
-    auto& nm {m_sd.name(t_symbol)};
+    return m_sd.core();
+}
 
-    if (!nm.empty()) {
+auto Network::InetSocket::get_name(Symbol t_symbol) const -> ByteSpan
+{
+    if (const auto nm {m_sd.name(t_symbol)}; !nm.empty()) {
         return nm;
     }
 
-    nm = Network::get_name(core(), to_namesymbol(t_symbol));
-    return nm;
+    m_sd.name(t_symbol, Network::get_name(core(), to_namesymbol(t_symbol)));
+    return m_sd.name(t_symbol);
 }
 
 auto Network::InetSocket::listen(int t_backlog) const -> OsError
@@ -80,7 +107,7 @@ auto Network::InetSocket::open(ByteSpan t_bs, OpenSymbol t_symbol) -> OsError
         return error;
     }
 
-    m_sd.name(to_symbol(t_symbol)).assign(t_bs.begin(), t_bs.end());
+    m_sd.name(to_symbol(t_symbol), t_bs);
     return {};
 }
 
@@ -89,6 +116,61 @@ auto Network::InetSocket::read(CharSpan t_cs) const -> ssize_t
     return Network::read(core(), t_cs);
 }
 
+auto Network::InetSocket::read(std::span<const CharSpan> t_css) const ->
+    ssize_t
+{
+    return Network::read(core(), t_css);
+}
+
+#ifdef HAVE_ZEROCOPY
+auto Network::InetSocket::reap_zerocopy(std::span<ZeroCopyCompletion>
+                                        t_completions) const -> std::size_t
+{
+    return Network::reap_zerocopy(core(), t_completions);
+}
+#endif
+
+auto Network::InetSocket::receive_from(CharSpan t_cs) const -> DatagramData
+{
+    return Network::receive_from(core(), t_cs);
+}
+
+#ifdef HAVE_SENDFILE
+auto Network::InetSocket::send_file(handle_type t_handle,
+                                    off_t t_offset,
+                                    std::size_t t_length) const -> ssize_t
+{
+    return Network::send_file(core(), t_handle, t_offset, t_length);
+}
+
+auto Network::InetSocket::send_file(const Pathname& t_path,
+                                    off_t t_offset,
+                                    std::size_t t_length) const -> ssize_t
+{
+    return Network::send_file(core(), t_path, t_offset, t_length);
+}
+#endif
+
+auto Network::InetSocket::send_to(std::string_view t_sv, ByteSpan t_bs) const ->
+    ssize_t
+{
+    return Network::send_to(core(), t_sv, t_bs);
+}
+
+#ifdef HAVE_ZEROCOPY
+auto Network::InetSocket::send_zerocopy(std::string_view t_sv) const ->
+    ssize_t
+{
+    return Network::send_zerocopy(core(), t_sv);
+}
+#endif
+
+auto Network::InetSocket::set_nonblocking(bool t_is_nonblocking) const ->
+    OsError
+{
+    return Network::set_nonblocking(core(), t_is_nonblocking);
+}
+
 auto Network::InetSocket::shutdown(int t_how) const -> OsError
 {
     return Network::shutdown(core(), t_how);
@@ -99,9 +181,10 @@ auto Network::InetSocket::write(std::string_view t_sv) const -> ssize_t
     return Network::write(core(), t_sv);
 }
 
-auto Network::InetSocket::core() const noexcept -> const SocketCore&
+auto Network::InetSocket::write(std::span<const std::string_view> t_svs)
+    const -> ssize_t
 {
-    return m_sd.core();
+    return Network::write(core(), t_svs);
 }
 
 auto Network::InetSocket::to_namesymbol(Symbol symbol) noexcept -> NameSymbol
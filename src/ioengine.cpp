@@ -0,0 +1,398 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/ioengine.hpp"                 // IoEngine
+#include "network/accept-result.hpp"            // accept_result()
+#include "network/charspan.hpp"                 // CharSpan
+#include "network/error.hpp"                    // Error
+#include "network/iocompletion.hpp"             // IoCompletion
+#include "network/iomode.hpp"                   // IoMode
+#include "network/logicerror.hpp"               // LogicError
+#include "network/os-features.hpp"              // HAVE_IO_URING
+#include "network/oserror.hpp"                  // OsError
+#include "network/read-result.hpp"              // read_result()
+#include "network/runtime.hpp"                  // Runtime
+#include "network/sizeresult.hpp"               // SizeResult
+#include "network/socket-error.hpp"             // socket_error
+#include "network/socketcore.hpp"               // SocketCore
+#include "network/to-os-error.hpp"              // to_os_error()
+#include "network/trace.hpp"                    // trace()
+#include "network/valueerror.hpp"               // ValueError
+#include "network/write-result.hpp"             // write_result()
+
+#ifdef HAVE_IO_URING
+#include "network/iouring.hpp"                  // IoUring
+#include "network/systemcall.hpp"               // SystemCall
+#endif
+
+#ifdef HAVE_IO_URING
+#include <linux/io_uring.h>     // IORING_ACCEPT_MULTISHOT,
+                                // IORING_CQE_F_MORE,
+                                // IORING_OP_ACCEPT,
+                                // IORING_OP_READ,
+                                // IORING_OP_READ_FIXED,
+                                // IORING_OP_WRITE, io_uring_sqe
+#include <sys/uio.h>            // iovec
+#endif
+
+#include <sys/types.h>      // ssize_t
+
+#include <cstddef>      // std::size_t
+#include <expected>     // std::unexpected
+#include <memory>       // std::make_unique()
+#include <ostream>      // std::ostream
+#include <span>         // std::span
+#include <string_view>  // std::string_view
+#include <utility>      // std::exchange()
+#include <vector>       // std::vector
+
+#ifdef HAVE_IO_URING
+#include <cerrno>       // EBUSY
+#endif
+
+Network::IoEngine::IoEngine(const Runtime* t_rt, unsigned t_entries) :
+    m_rt(t_rt)
+{
+    if (m_rt == nullptr) {
+        throw LogicError {"Null runtime pointer"};
+    }
+
+#ifdef HAVE_IO_URING
+    if (m_rt->io_mode() == IoMode::io_uring) {
+        try {
+            m_ring = std::make_unique<IoUring>(m_rt, t_entries);
+        }
+        catch (const Error& error) {
+            // Fall back to one system call per operation when the
+            // kernel lacks io_uring or a sandbox forbids it.
+            trace(m_rt->tracer(), [&](std::ostream& os) {
+                os << error.what();
+            });
+        }
+    }
+#else
+    static_cast<void>(t_entries);
+#endif
+}
+
+Network::IoEngine::~IoEngine() noexcept = default;
+
+auto Network::IoEngine::accept(const SocketCore& t_sc,
+                               Data t_data,
+                               bool t_is_multishot) -> void
+{
+    enqueue({t_sc, {}, {}, t_data, 0, Operation::accept, t_is_multishot});
+}
+
+auto Network::IoEngine::read(const SocketCore& t_sc,
+                             CharSpan t_cs,
+                             Data t_data) -> void
+{
+    enqueue({t_sc, t_cs, {}, t_data, 0, Operation::read, false});
+}
+
+auto Network::IoEngine::read(const SocketCore& t_sc,
+                             std::size_t t_index,
+                             Data t_data) -> void
+{
+    if (t_index >= m_buffers.size()) {
+        throw ValueError<std::size_t> {
+            "std::size_t",
+            t_index,
+            0,
+            m_buffers.empty() ? 0 : m_buffers.size() - 1
+        };
+    }
+
+    enqueue({t_sc, m_buffers[t_index], {}, t_data, t_index,
+             Operation::read_fixed, false});
+}
+
+auto Network::IoEngine::write(const SocketCore& t_sc,
+                              std::string_view t_sv,
+                              Data t_data) -> void
+{
+    enqueue({t_sc, {}, t_sv, t_data, 0, Operation::write, false});
+}
+
+auto Network::IoEngine::register_buffers(const std::vector<CharSpan>&
+                                         t_buffers) -> OsError
+{
+    m_buffers = t_buffers;
+
+#ifdef HAVE_IO_URING
+    if (m_ring) {
+        std::vector<iovec> iovecs;
+        iovecs.reserve(m_buffers.size());
+
+        for (const auto& buffer : m_buffers) {
+            iovecs.push_back({buffer.data(), buffer.size()});
+        }
+
+        // Reads into unregistered buffers still work, just without
+        // the saving of pinning the pages once.
+        auto error {m_ring->register_buffers(iovecs)};
+        m_is_registered = !error && !iovecs.empty();
+        return error;
+    }
+#endif
+
+    return {};
+}
+
+auto Network::IoEngine::submit() -> std::span<const IoCompletion>
+{
+    m_completions.clear();
+
+#ifdef HAVE_IO_URING
+    if (m_ring) {
+        // Completions reaped while queueing are returned first, and
+        // spare the wait for another.
+        enter(m_in_flight > 0 && m_deferred.empty() ? 1 : 0);
+        m_completions.swap(m_deferred);
+        reap(m_completions);
+        return m_completions;
+    }
+#endif
+
+    for (const auto& request : std::exchange(m_queue, {})) {
+        complete(request);
+    }
+
+    return m_completions;
+}
+
+auto Network::IoEngine::mode() const noexcept -> IoMode
+{
+#ifdef HAVE_IO_URING
+    if (m_ring) {
+        return IoMode::io_uring;
+    }
+#endif
+
+    return IoMode::standard;
+}
+
+auto Network::IoEngine::pending() const noexcept -> std::size_t
+{
+#ifdef HAVE_IO_URING
+    return m_queue.size() + m_in_flight;
+#else
+    return m_queue.size();
+#endif
+}
+
+auto Network::IoEngine::runtime() const noexcept -> const Runtime*
+{
+    return m_rt;
+}
+
+auto Network::IoEngine::complete(const Request& t_request) -> void
+{
+    SizeResult result;
+
+    switch (t_request.m_operation) {
+    case Operation::accept:
+        if (const auto accepted {accept_result(t_request.m_sc)}) {
+            result = static_cast<ssize_t>(accepted->core().handle());
+        }
+        else {
+            result = std::unexpected {accepted.error()};
+        }
+        break;
+    case Operation::read:
+    case Operation::read_fixed:
+        result = read_result(t_request.m_sc, t_request.m_cs);
+        break;
+    case Operation::write:
+        result = write_result(t_request.m_sc, t_request.m_sv);
+        break;
+    }
+
+    if (!result) {
+        m_completions.emplace_back(t_request.m_data, socket_error,
+                                   result.error(), false);
+        return;
+    }
+
+    // Without a ring a multishot accept completes like a single one,
+    // as queueing it again would block every later submit() on an
+    // idle listener.
+    m_completions.emplace_back(t_request.m_data, *result, OsError {},
+                               false);
+}
+
+auto Network::IoEngine::enqueue(const Request& t_request) -> void
+{
+#ifdef HAVE_IO_URING
+    if (m_ring) {
+        std::size_t slot {m_slots.size()};
+
+        if (m_free.empty()) {
+            m_slots.push_back(t_request);
+        }
+        else {
+            slot = m_free.back();
+            m_free.pop_back();
+            m_slots[slot] = t_request;
+        }
+
+        prepare(t_request, slot);
+        ++m_in_flight;
+        return;
+    }
+#endif
+
+    m_queue.push_back(t_request);
+}
+
+#ifdef HAVE_IO_URING
+
+auto Network::IoEngine::to_name(Operation t_operation) noexcept ->
+    std::string_view
+{
+    switch (t_operation) {
+    case Operation::accept:
+        return "IORING_OP_ACCEPT";
+    case Operation::write:
+        return "IORING_OP_WRITE";
+    default:
+        return "IORING_OP_READ";
+    }
+}
+
+auto Network::IoEngine::enter(unsigned t_wait) -> void
+{
+    while (const auto error {m_ring->submit(t_wait)}) {
+        if (error.number() != EBUSY) {
+            throw Error {error};
+        }
+
+        // The kernel is holding completions back until the completion
+        // queue has room for them: reap some before trying again.
+        reap(m_deferred);
+        t_wait = 0;
+    }
+}
+
+auto Network::IoEngine::prepare(const Request& t_request,
+                                std::size_t t_slot) -> void
+{
+    auto* sqe {m_ring->get_sqe()};
+
+    if (sqe == nullptr) {
+        // The submission queue is full: hand it to the kernel now
+        // without waiting for any of it to complete.
+        enter(0);
+        sqe = m_ring->get_sqe();
+
+        if (sqe == nullptr) {
+            throw LogicError {"Submission queue is full"};
+        }
+    }
+
+    sqe->fd = t_request.m_sc.handle();
+    sqe->user_data = t_slot;
+
+    switch (t_request.m_operation) {
+    case Operation::accept:
+        sqe->opcode = IORING_OP_ACCEPT;
+
+        if (t_request.m_is_multishot) {
+            sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+        }
+
+        break;
+    case Operation::read_fixed:
+        if (m_is_registered) {
+            sqe->opcode = IORING_OP_READ_FIXED;
+            sqe->buf_index = static_cast<__u16>(t_request.m_index);
+        }
+        else {
+            sqe->opcode = IORING_OP_READ;
+        }
+
+        sqe->addr = reinterpret_cast<__u64>(t_request.m_cs.data());  // NOLINT
+        sqe->len = static_cast<__u32>(t_request.m_cs.size());
+        break;
+    case Operation::read:
+        sqe->opcode = IORING_OP_READ;
+        sqe->addr = reinterpret_cast<__u64>(t_request.m_cs.data());  // NOLINT
+        sqe->len = static_cast<__u32>(t_request.m_cs.size());
+        break;
+    case Operation::write:
+        sqe->opcode = IORING_OP_WRITE;
+        sqe->addr = reinterpret_cast<__u64>(t_request.m_sv.data());  // NOLINT
+        sqe->len = static_cast<__u32>(t_request.m_sv.size());
+        break;
+    }
+}
+
+auto Network::IoEngine::reap(std::vector<IoCompletion>& t_completions) ->
+    void
+{
+    for (;;) {
+        drain(t_completions);
+
+        if (!m_ring->is_overflowed()) {
+            break;
+        }
+
+        // Completions that did not fit in the completion queue are
+        // moved into it by the kernel on the next enter.
+        if (const auto error {m_ring->flush()}) {
+            throw Error {error};
+        }
+    }
+}
+
+auto Network::IoEngine::drain(std::vector<IoCompletion>& t_completions) ->
+    void
+{
+    while (const auto* cqe {m_ring->peek_cqe()}) {
+        const auto slot {static_cast<std::size_t>(cqe->user_data)};
+        const auto& request {m_slots[slot]};
+        const auto is_more {(cqe->flags & IORING_CQE_F_MORE) != 0};
+
+        if (cqe->res < 0) {
+            const auto api_error {-cqe->res};
+            const SystemCall call {
+                .m_name = to_name(request.m_operation),
+                .m_arguments = [](std::ostream& os,
+                                  const SystemCall& t_call) {
+                    os << t_call.m_handle;
+                },
+                .m_handle = request.m_sc.handle(),
+            };
+            t_completions.emplace_back(request.m_data, socket_error,
+                                       OsError {to_os_error(api_error),
+                                                api_error, call},
+                                       is_more);
+        }
+        else {
+            t_completions.emplace_back(request.m_data, cqe->res, OsError {},
+                                       is_more);
+        }
+
+        if (!is_more) {
+            m_free.push_back(slot);
+            --m_in_flight;
+        }
+
+        m_ring->seen_cqe();
+    }
+}
+
+#endif
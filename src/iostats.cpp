@@ -0,0 +1,95 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/iostats.hpp"          // IoStats
+#include "network/iocounter.hpp"        // IoCounter, io_counter_size
+#include "network/iolatency.hpp"        // IoLatency, io_latency_size
+#include "network/iostatssnapshot.hpp"  // IoStatsSnapshot
+#include "network/latencyhistogram.hpp" // LatencyHistogram
+#include "network/os-error-type.hpp"    // os_error_type
+
+#include <atomic>       // std::atomic, std::memory_order_relaxed
+#include <chrono>       // std::chrono::nanoseconds
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t
+
+namespace
+{
+    auto get_shard_index() noexcept -> std::size_t
+    {
+        static std::atomic<std::size_t> next_index {0};
+        thread_local const auto index {
+            next_index.fetch_add(1, std::memory_order_relaxed)
+        };
+        return index % Network::IoStats::shard_count;
+    }
+}
+
+auto Network::IoStats::add(IoCounter t_counter,
+                           std::uint64_t t_value) noexcept -> void
+{
+    const auto index {static_cast<std::size_t>(t_counter)};
+    shard().m_counters[index].fetch_add(t_value, std::memory_order_relaxed);
+}
+
+auto Network::IoStats::add_error(os_error_type t_number) noexcept -> void
+{
+    // Errors are rare enough that counting them by number does not
+    // need sharding.
+    add(IoCounter::errors);
+    const auto index {IoStatsSnapshot::error_index(t_number)};
+    m_errors[index].fetch_add(1, std::memory_order_relaxed);
+}
+
+auto Network::IoStats::record(IoLatency t_latency,
+                              std::chrono::nanoseconds t_duration) noexcept ->
+    void
+{
+    m_latencies[static_cast<std::size_t>(t_latency)].record(t_duration);
+}
+
+auto Network::IoStats::latency(IoLatency t_latency) const noexcept ->
+    const LatencyHistogram&
+{
+    return m_latencies[static_cast<std::size_t>(t_latency)];
+}
+
+auto Network::IoStats::snapshot() const noexcept -> IoStatsSnapshot
+{
+    IoStatsSnapshot result;
+
+    for (const auto& shard : m_shards) {
+        for (std::size_t i {0}; i < io_counter_size; ++i) {
+            result.add(static_cast<IoCounter>(i),
+                       shard.m_counters[i].load(std::memory_order_relaxed));
+        }
+    }
+
+    for (std::size_t i {0}; i < m_errors.size(); ++i) {
+        result.m_errors_by_number[i] =
+            m_errors[i].load(std::memory_order_relaxed);
+    }
+
+    for (std::size_t i {0}; i < io_latency_size; ++i) {
+        result.m_latencies[i] = m_latencies[i].summary();
+    }
+
+    return result;
+}
+
+auto Network::IoStats::shard() noexcept -> Shard&
+{
+    return m_shards[get_shard_index()];
+}
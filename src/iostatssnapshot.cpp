@@ -0,0 +1,56 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/iostatssnapshot.hpp"  // IoStatsSnapshot
+#include "network/iocounter.hpp"        // IoCounter
+
+#include <cstdint>      // std::uint64_t
+
+auto Network::IoStatsSnapshot::add(IoCounter t_counter,
+                                   std::uint64_t t_value) noexcept -> void
+{
+    switch (t_counter) {
+    case IoCounter::accepts:
+        m_accepts += t_value;
+        break;
+    case IoCounter::again:
+        m_again += t_value;
+        break;
+    case IoCounter::bytes_read:
+        m_bytes_read += t_value;
+        break;
+    case IoCounter::bytes_written:
+        m_bytes_written += t_value;
+        break;
+    case IoCounter::closes:
+        m_closes += t_value;
+        break;
+    case IoCounter::connects:
+        m_connects += t_value;
+        break;
+    case IoCounter::errors:
+        m_errors += t_value;
+        break;
+    case IoCounter::resolve_errors:
+        m_resolve_errors += t_value;
+        break;
+    case IoCounter::resolves:
+        m_resolves += t_value;
+        break;
+    case IoCounter::system_calls:
+        m_system_calls += t_value;
+        break;
+    }
+}
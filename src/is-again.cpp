@@ -0,0 +1,32 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/is-again.hpp"         // is_again()
+#include "network/os-error-type.hpp"    // os_error_type
+
+#ifdef _WIN32
+#include <winsock2.h>       // WSAEWOULDBLOCK
+#else
+#include <cerrno>           // EAGAIN, EWOULDBLOCK
+#endif
+
+auto Network::is_again(os_error_type number) noexcept -> bool
+{
+#ifdef _WIN32
+    return number == WSAEWOULDBLOCK;
+#else
+    return number == EAGAIN || number == EWOULDBLOCK;
+#endif
+}
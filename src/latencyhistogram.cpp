@@ -0,0 +1,157 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/latencyhistogram.hpp" // LatencyHistogram
+#include "network/latencysummary.hpp"   // LatencySummary
+
+#include <algorithm>    // std::clamp(), std::max(), std::min()
+#include <atomic>       // std::memory_order_relaxed
+#include <bit>          // std::bit_width()
+#include <cmath>        // std::ceil()
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t
+
+auto Network::LatencyHistogram::to_index(std::uint64_t t_value) noexcept ->
+    std::size_t
+{
+    if (t_value < sub_bucket_count) {
+        return static_cast<std::size_t>(t_value);
+    }
+
+    const auto width {static_cast<std::size_t>(std::bit_width(t_value))};
+    const auto shift {width - 1 - sub_bucket_bits};
+    const auto sub_bucket {
+        static_cast<std::size_t>(t_value >> shift) - sub_bucket_count
+    };
+    return (shift + 1) * sub_bucket_count + sub_bucket;
+}
+
+auto Network::LatencyHistogram::to_value(std::size_t t_index) noexcept ->
+    std::uint64_t
+{
+    // Return the largest value that maps to the bucket.
+    if (t_index < sub_bucket_count) {
+        return t_index;
+    }
+
+    const auto shift {t_index / sub_bucket_count - 1};
+    const auto sub_bucket {t_index % sub_bucket_count};
+    const auto lowest {
+        std::uint64_t {sub_bucket_count + sub_bucket} << shift
+    };
+    return lowest + ((std::uint64_t {1} << shift) - 1);
+}
+
+auto Network::LatencyHistogram::merge(const LatencyHistogram& t_histogram)
+    noexcept -> void
+{
+    for (std::size_t i {0}; i < bucket_count; ++i) {
+        const auto count {
+            t_histogram.m_buckets[i].load(std::memory_order_relaxed)
+        };
+
+        if (count != 0) {
+            m_buckets[i].fetch_add(count, std::memory_order_relaxed);
+        }
+    }
+
+    update_max(t_histogram.m_max.load(std::memory_order_relaxed));
+}
+
+auto Network::LatencyHistogram::record(Duration t_duration) noexcept -> void
+{
+    const auto value {
+        static_cast<std::uint64_t>(std::max(t_duration.count(),
+                                            Duration::rep {0}))
+    };
+    m_buckets[to_index(value)].fetch_add(1, std::memory_order_relaxed);
+    update_max(value);
+}
+
+auto Network::LatencyHistogram::count() const noexcept -> std::uint64_t
+{
+    std::uint64_t result {0};
+
+    for (const auto& bucket : m_buckets) {
+        result += bucket.load(std::memory_order_relaxed);
+    }
+
+    return result;
+}
+
+auto Network::LatencyHistogram::max() const noexcept -> Duration
+{
+    return Duration {
+        static_cast<Duration::rep>(m_max.load(std::memory_order_relaxed))
+    };
+}
+
+auto Network::LatencyHistogram::percentile(double t_percentile) const
+    noexcept -> Duration
+{
+    std::array<std::uint64_t, bucket_count> counts {};
+    std::uint64_t total {0};
+
+    for (std::size_t i {0}; i < bucket_count; ++i) {
+        counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+
+    if (total == 0) {
+        return Duration {0};
+    }
+
+    const auto fraction {std::clamp(t_percentile, 0.0, 100.0) / 100.0};
+    const auto rank {
+        std::max(static_cast<std::uint64_t>(
+                     std::ceil(fraction * static_cast<double>(total))),
+                 std::uint64_t {1})
+    };
+    const auto max_value {m_max.load(std::memory_order_relaxed)};
+    std::uint64_t cumulative {0};
+
+    for (std::size_t i {0}; i < bucket_count; ++i) {
+        cumulative += counts[i];
+
+        if (cumulative >= rank) {
+            const auto value {std::min(to_value(i), max_value)};
+            return Duration {static_cast<Duration::rep>(value)};
+        }
+    }
+
+    return max();
+}
+
+auto Network::LatencyHistogram::summary() const noexcept -> LatencySummary
+{
+    return {
+        count(),
+        static_cast<std::uint64_t>(percentile(50.0).count()),
+        static_cast<std::uint64_t>(percentile(99.0).count()),
+        static_cast<std::uint64_t>(percentile(99.9).count()),
+        static_cast<std::uint64_t>(max().count())
+    };
+}
+
+auto Network::LatencyHistogram::update_max(std::uint64_t t_value) noexcept ->
+    void
+{
+    auto current {m_max.load(std::memory_order_relaxed)};
+
+    while (current < t_value &&
+           !m_max.compare_exchange_weak(current, t_value,
+                                        std::memory_order_relaxed)) {
+    }
+}
@@ -21,6 +21,7 @@
 #include "network/socket-error.hpp"     // socket_error
 #include "network/socketcore.hpp"       // SocketCore
 #include "network/to-os-error.hpp"      // to_os_error()
+#include "network/trace.hpp"            // trace()
 
 #ifdef _WIN32
 #include <winsock2.h>       // ::listen()
@@ -28,23 +29,22 @@
 #include <sys/socket.h>     // ::listen()
 #endif
 
-#include <iostream>     // std::cout, std::endl
+#include <ostream>      // std::ostream
 #include <sstream>      // std::ostringstream
 
 auto Network::listen(const SocketCore& sc, int backlog) -> OsError
 {
     const auto handle {sc.handle()};
 
-    if (sc.runtime()->is_verbose()) {
+    trace(sc.tracer(), [&](std::ostream& os) {
         // clang-format off
-        std::cout << "Calling ::listen("
-                  << handle
-                  << ", "
-                  << backlog
-                  << ')'
-                  << std::endl;
+        os << "Calling ::listen("
+           << handle
+           << ", "
+           << backlog
+           << ')';
         // clang-format on
-    }
+    });
 
     reset_api_error();
     const auto error {::listen(handle, backlog)};
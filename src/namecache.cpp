@@ -0,0 +1,30 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/namecache.hpp"        // NameCache
+#include "network/bytespan.hpp"         // ByteSpan
+#include "network/symbol.hpp"           // Symbol
+
+#include <cstddef>      // std::size_t
+
+auto Network::NameCache::set(Symbol t_symbol, ByteSpan t_bs) -> void
+{
+    m_slots[static_cast<std::size_t>(t_symbol)].assign(t_bs);
+}
+
+auto Network::NameCache::get(Symbol t_symbol) const noexcept -> ByteSpan
+{
+    return m_slots[static_cast<std::size_t>(t_symbol)];
+}
@@ -16,9 +16,12 @@
 #include "network/open-endpoint.hpp"            // open()
 #include "network/create-socketresult.hpp"      // create_socketresult()
 #include "network/error.hpp"                    // Error()
+#include "network/handle-type.hpp"              // handle_type
 #include "network/insert-endpoint.hpp"          // insert()
 #include "network/openinputs.hpp"               // OpenInputs
+#include "network/opensetup.hpp"                // OpenSetup
 #include "network/opensymbol.hpp"               // OpenSymbol
+#include "network/socketcore.hpp"               // SocketCore
 #include "network/socketresult.hpp"             // SocketResult
 #include "network/socketresultvector.hpp"       // SocketResultVector
 #include "network/sockettemplate.hpp"           // SocketTemplate
@@ -29,6 +32,13 @@
 
 auto Network::open(const OpenInputs& oi,
                    OpenSymbol symbol) -> SocketResultVector
+{
+    return open(oi, symbol, {});
+}
+
+auto Network::open(const OpenInputs& oi,
+                   OpenSymbol symbol,
+                   const OpenSetup& setup) -> SocketResultVector
 {
     SocketTemplateVector stv;
 
@@ -44,6 +54,16 @@ auto Network::open(const OpenInputs& oi,
             const auto& bs {st.address()};
             const auto& ps {*result};
 
+            if (setup) {
+                const SocketCore sc {static_cast<handle_type>(*ps),
+                                     st.hints().m_family,
+                                     oi.runtime()};
+
+                if (const auto error {setup(sc)}) {
+                    return std::unexpected {error};
+                }
+            }
+
             if (const auto error {ps->open(bs, symbol)}) {
                 return std::unexpected {error};
             }
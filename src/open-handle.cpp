@@ -16,23 +16,44 @@
 #include "network/open-handle.hpp"              // open()
 #include "network/addresserror.hpp"             // AddressError
 #include "network/bytespan.hpp"                 // ByteSpan
-#include "network/format-os-error.hpp"          // format_os_error()
 #include "network/get-api-error.hpp"            // get_api_error()
 #include "network/get-openhandler.hpp"          // get_openhandler()
 #include "network/get-sa-span.hpp"              // get_sa_span()
+#include "network/iocounter.hpp"                // IoCounter
+#include "network/iolatency.hpp"                // IoLatency
 #include "network/opensymbol.hpp"               // OpenSymbol
 #include "network/oserror.hpp"                  // OsError
 #include "network/reset-api-error.hpp"          // reset_api_error()
 #include "network/sa-length-limits.hpp"         // sa_length_min
 #include "network/socket-error.hpp"             // socket_error
 #include "network/socketcore.hpp"               // SocketCore
+#include "network/systemcall.hpp"               // SystemCall
 #include "network/to-os-error.hpp"              // to_os_error()
 #include "network/to-string-bytespan.hpp"       // to_string()
+#include "network/trace.hpp"                    // trace()
 
-#include <iostream>     // std::cout, std::endl
-#include <sstream>      // std::ostringstream
+#ifdef _WIN32
+#include <winsock2.h>       // WSAEWOULDBLOCK
+#else
+#include <cerrno>           // EINPROGRESS
+#endif
+
+#include <cstdint>      // std::int64_t
+#include <ostream>      // std::ostream
 #include <utility>      // std::cmp_equal()
 
+namespace
+{
+    auto is_in_progress(int api_error) noexcept -> bool
+    {
+#ifdef _WIN32
+        return api_error == WSAEWOULDBLOCK;
+#else
+        return api_error == EINPROGRESS;
+#endif
+    }
+}
+
 auto Network::open(const SocketCore& sc, ByteSpan bs, OpenSymbol symbol) -> OsError
 {
     const auto [sa, salen] {get_sa_span(bs)};
@@ -44,42 +65,56 @@ auto Network::open(const SocketCore& sc, ByteSpan bs, OpenSymbol symbol) -> OsEr
                             to_string(bs)};
     }
 
-    if (sc.runtime()->is_verbose()) {
+    trace(sc.tracer(), [&](std::ostream& os) {
         // clang-format off
-        std::cout << "Calling "
-                  << oh.string()
-                  << '('
-                  << handle
-                  << ", "
-                  << to_string(bs)
-                  << ", "
-                  << salen
-                  << ')'
-                  << std::endl;
+        os << "Calling "
+           << oh.string()
+           << '('
+           << handle
+           << ", "
+           << to_string(bs)
+           << ", "
+           << salen
+           << ')';
         // clang-format on
-    }
+    });
 
+    sc.count(IoCounter::system_calls);
     reset_api_error();
 
-    if (oh.function()(handle, sa, salen) == socket_error) {
-        const auto api_error {get_api_error()};
+    const auto start {sc.now()};
+    const auto result {oh.function()(handle, sa, salen)};
+    const auto api_error {result == socket_error ? get_api_error() : 0};
+
+    // A non-blocking connect in progress is timed by its caller once
+    // it completes.
+    if (symbol == OpenSymbol::connect && !is_in_progress(api_error)) {
+        sc.record(IoLatency::connect, start);
+    }
+
+    if (result == socket_error) {
         const auto os_error {to_os_error(api_error)};
-        std::ostringstream oss;
-        // clang-format off
-        oss << "Call to "
-            << oh.string()
-            << '('
-            << handle
-            << ", "
-            << to_string(bs)
-            << ", "
-            << salen
-            << ") failed with error "
-            << api_error
-            << ": "
-            << format_os_error(os_error);
-        // clang-format on
-        return {os_error, oss.str()};
+        sc.count_error(os_error);
+        const SystemCall call {
+            .m_name = oh.string(),
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", "
+                   << to_string(t_call.m_address)
+                   << ", "
+                   << t_call.m_values[0];
+                // clang-format on
+            },
+            .m_address = bs,
+            .m_values = {static_cast<std::int64_t>(salen)},
+            .m_handle = handle,
+        };
+        return {os_error, api_error, call};
+    }
+
+    if (symbol == OpenSymbol::connect) {
+        sc.count(IoCounter::connects);
     }
 
     return {};
@@ -14,21 +14,52 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "network/oserror.hpp"          // OsError
+#include "network/format-os-error.hpp"  // format_os_error()
 #include "network/os-error-type.hpp"    // os_error_type
+#include "network/sockaddrstorage.hpp"  // SockAddrStorage
+#include "network/systemcall.hpp"       // SystemCall
 
+#include <memory>       // std::make_shared()
+#include <sstream>      // std::ostringstream
 #include <string>       // std::string
 #include <string_view>  // std::string_view
 
 Network::OsError::OsError(os_error_type t_number,
                           std::string_view t_string) :
+    m_string(t_string),
+    m_number(t_number)
+{
+}
+
+Network::OsError::OsError(os_error_type t_number,
+                          int t_api_error,
+                          const SystemCall& t_call) :
+    m_call(t_call),
     m_number(t_number),
-    m_string(t_string)
+    m_api_error(t_api_error)
 {
+    if (!m_call.m_address.empty()) {
+        // Copies of this error share the copy, so the view stays
+        // valid in each of them.
+        m_address = std::make_shared<const SockAddrStorage>
+            (m_call.m_address);
+        m_call.m_address = *m_address;
+    }
 }
 
 Network::OsError::operator bool() const noexcept
 {
-    return m_number != 0 || !m_string.empty();
+    return m_number != 0 || !m_string.empty() || !m_call.m_name.empty();
+}
+
+auto Network::OsError::api_error() const noexcept -> int
+{
+    return m_api_error;
+}
+
+auto Network::OsError::call() const noexcept -> const SystemCall&
+{
+    return m_call;
 }
 
 auto Network::OsError::number() const noexcept -> os_error_type
@@ -36,7 +67,28 @@ auto Network::OsError::number() const noexcept -> os_error_type
     return m_number;
 }
 
-auto Network::OsError::string() const -> const std::string&
+auto Network::OsError::string() const -> std::string
 {
-    return m_string;
+    if (!m_string.empty() || m_call.m_name.empty()) {
+        return m_string;
+    }
+
+    std::ostringstream oss;
+    // clang-format off
+    oss << "Call to "
+        << m_call.m_name
+        << '(';
+    // clang-format on
+
+    if (m_call.m_arguments != nullptr) {
+        m_call.m_arguments(oss, m_call);
+    }
+
+    // clang-format off
+    oss << ") failed with error "
+        << m_api_error
+        << ": "
+        << format_os_error(m_number);
+    // clang-format on
+    return oss.str();
 }
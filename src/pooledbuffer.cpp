@@ -0,0 +1,90 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/pooledbuffer.hpp"     // PooledBuffer
+#include "network/bufferpool.hpp"       // BufferPool
+
+#include <algorithm>    // std::min()
+#include <string_view>  // std::string_view
+#include <utility>      // std::exchange()
+
+Network::PooledBuffer::PooledBuffer(size_type t_size) :
+    m_size(t_size)
+{
+    const auto [data, capacity] {BufferPool::allocate(t_size)};
+    m_data = data;
+    m_capacity = capacity;
+}
+
+Network::PooledBuffer::PooledBuffer(PooledBuffer&& t_buffer) noexcept :
+    m_data(std::exchange(t_buffer.m_data, nullptr)),
+    m_size(std::exchange(t_buffer.m_size, 0)),
+    m_capacity(std::exchange(t_buffer.m_capacity, 0))
+{
+}
+
+Network::PooledBuffer::~PooledBuffer() noexcept
+{
+    release();
+}
+
+auto Network::PooledBuffer::operator=(PooledBuffer&& t_buffer) noexcept ->
+    PooledBuffer&
+{
+    if (this != &t_buffer) {
+        release();
+        m_data = std::exchange(t_buffer.m_data, nullptr);
+        m_size = std::exchange(t_buffer.m_size, 0);
+        m_capacity = std::exchange(t_buffer.m_capacity, 0);
+    }
+
+    return *this;
+}
+
+auto Network::PooledBuffer::begin() noexcept -> iterator
+{
+    return m_data;
+}
+
+auto Network::PooledBuffer::capacity() const noexcept -> size_type
+{
+    return m_capacity;
+}
+
+auto Network::PooledBuffer::data() noexcept -> value_type*
+{
+    return m_data;
+}
+
+auto Network::PooledBuffer::end() noexcept -> iterator
+{
+    return m_data + m_size;  // NOLINT
+}
+
+auto Network::PooledBuffer::size() const noexcept -> size_type
+{
+    return m_size;
+}
+
+auto Network::PooledBuffer::view(size_type t_length) const noexcept ->
+    std::string_view
+{
+    return {m_data, std::min(t_length, m_size)};
+}
+
+auto Network::PooledBuffer::release() noexcept -> void
+{
+    BufferPool::deallocate(std::exchange(m_data, nullptr), m_capacity);
+}
@@ -0,0 +1,56 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/quote-charspans.hpp"  // quote()
+#include "network/charspan.hpp"         // CharSpan
+#include "network/quote.hpp"            // quote()
+
+#include <algorithm>    // std::min()
+#include <cstddef>      // std::size_t
+#include <span>         // std::span
+#include <sstream>      // std::ostringstream
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+
+auto Network::quote(std::span<const CharSpan> css) -> std::string
+{
+    std::ostringstream oss;
+    oss << '{';
+
+    for (auto delim {""}; const auto& cs : css) {
+        oss << delim << quote(std::string_view {cs.data(), cs.size()});
+        delim = ", ";
+    }
+
+    oss << '}';
+    return oss.str();
+}
+
+auto Network::quote(std::span<const CharSpan> css,
+                    std::size_t size) -> std::string
+{
+    std::ostringstream oss;
+    oss << '{';
+
+    for (auto delim {""}; const auto& cs : css) {
+        const auto length {std::min(cs.size(), size)};
+        oss << delim << quote(std::string_view {cs.data(), length});
+        delim = ", ";
+        size -= length;
+    }
+
+    oss << '}';
+    return oss.str();
+}
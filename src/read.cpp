@@ -0,0 +1,33 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/read.hpp"             // read()
+#include "network/charspan.hpp"         // CharSpan
+#include "network/error.hpp"            // Error
+#include "network/read-result.hpp"      // read_result()
+#include "network/socketcore.hpp"       // SocketCore
+
+#include <sys/types.h>      // ssize_t
+
+auto Network::read(const SocketCore& sc, CharSpan cs) -> ssize_t
+{
+    const auto result {read_result(sc, cs)};
+
+    if (!result) {
+        throw Error {result.error()};
+    }
+
+    return *result;
+}
@@ -0,0 +1,270 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/resolver.hpp"                 // Resolver
+#include "network/hostname.hpp"                 // Hostname
+#include "network/hostnameview.hpp"             // HostnameView
+#include "network/logicerror.hpp"               // LogicError
+#include "network/optionalhints.hpp"            // OptionalHints
+#include "network/resolveresult.hpp"            // ResolveResult
+#include "network/resolveroptions.hpp"          // ResolverOptions
+#include "network/runtime.hpp"                  // Runtime
+#include "network/service.hpp"                  // Service
+#include "network/serviceview.hpp"              // ServiceView
+#include "network/sharednameservice.hpp"        // SharedNameService
+
+#include <cstddef>      // std::size_t
+#include <exception>    // std::current_exception()
+#include <future>       // std::promise
+#include <mutex>        // std::lock_guard, std::unique_lock
+#include <stop_token>   // std::stop_token
+#include <optional>     // std::nullopt, std::optional
+#include <string_view>  // std::string_view
+#include <utility>      // std::move()
+
+namespace
+{
+    template <typename T>
+    auto to_optional(std::string_view sv) -> std::optional<T>
+    {
+        if (sv.data() == nullptr) {
+            return std::nullopt;
+        }
+
+        return T {sv};
+    }
+
+    template <typename T>
+    auto to_view(const std::optional<T>& value) -> std::string_view
+    {
+        return value ? std::string_view {*value} : std::string_view {};
+    }
+}
+
+Network::Resolver::Resolver(SharedNameService t_service,
+                            const ResolverOptions& t_options) :
+    m_service(std::move(t_service)),
+    m_options(t_options)
+{
+    if (m_service == nullptr) {
+        throw LogicError {"Null name service pointer"};
+    }
+
+    if (m_options.m_worker_count == 0) {
+        throw LogicError {"Zero worker count"};
+    }
+
+    for (std::size_t i {0}; i < m_options.m_worker_count; ++i) {
+        m_workers.emplace_back([this](const std::stop_token& token) {
+            work(token);
+        });
+    }
+}
+
+Network::Resolver::~Resolver() noexcept
+{
+    for (auto& worker : m_workers) {
+        worker.request_stop();
+    }
+
+    m_workers.clear();
+}
+
+auto Network::Resolver::clear() -> void
+{
+    const std::lock_guard lock {m_mutex};
+    m_cache.clear();
+    m_expiries.clear();
+}
+
+auto Network::Resolver::resolve(const HostnameView& t_hostname,
+                                const ServiceView& t_service,
+                                const OptionalHints& t_hints,
+                                const Runtime* t_rt) -> ResolveResult
+{
+    return resolve_async(t_hostname, t_service, t_hints, t_rt).get();
+}
+
+auto Network::Resolver::resolve_async(const HostnameView& t_hostname,
+                                      const ServiceView& t_service,
+                                      const OptionalHints& t_hints,
+                                      const Runtime* t_rt) -> Future
+{
+    auto key {to_key(t_hostname, t_service, t_hints)};
+    const std::lock_guard lock {m_mutex};
+
+    if (const auto it {m_cache.find(key)}; it != m_cache.end()) {
+        if (Clock::now() < it->second.m_expiry->first) {
+            ++m_hits;
+            return it->second.m_future;
+        }
+
+        erase(it);
+    }
+
+    if (m_options.m_is_coalescing) {
+        if (const auto it {m_pending.find(key)}; it != m_pending.end()) {
+            ++m_coalesced;
+            return it->second;
+        }
+    }
+
+    ++m_misses;
+    std::promise<ResolveResult> promise;
+    auto future {promise.get_future().share()};
+
+    if (m_options.m_is_coalescing) {
+        m_pending.insert_or_assign(key, future);
+    }
+
+    m_queue.push_back({std::move(key), t_hints, std::move(promise), future,
+                       t_rt});
+    m_condition.notify_one();
+    return future;
+}
+
+auto Network::Resolver::coalesced() const -> std::size_t
+{
+    const std::lock_guard lock {m_mutex};
+    return m_coalesced;
+}
+
+auto Network::Resolver::hits() const -> std::size_t
+{
+    const std::lock_guard lock {m_mutex};
+    return m_hits;
+}
+
+auto Network::Resolver::misses() const -> std::size_t
+{
+    const std::lock_guard lock {m_mutex};
+    return m_misses;
+}
+
+auto Network::Resolver::size() const -> std::size_t
+{
+    const std::lock_guard lock {m_mutex};
+    return m_cache.size();
+}
+
+auto Network::Resolver::to_key(const HostnameView& t_hostname,
+                               const ServiceView& t_service,
+                               const OptionalHints& t_hints) -> Key
+{
+    Key key {
+        to_optional<Hostname>(t_hostname),
+        to_optional<Service>(t_service),
+        std::nullopt
+    };
+
+    if (t_hints) {
+        key.m_hints = Hints {
+            t_hints->m_family,
+            t_hints->m_socktype,
+            t_hints->m_protocol,
+            t_hints->m_flags
+        };
+    }
+
+    return key;
+}
+
+auto Network::Resolver::erase(Cache::iterator t_it) -> void
+{
+    m_expiries.erase(t_it->second.m_expiry);
+    m_cache.erase(t_it);
+}
+
+auto Network::Resolver::insert(const Key& t_key,
+                               const Future& t_future,
+                               Clock::time_point t_expiry) -> void
+{
+    if (const auto it {m_cache.find(t_key)}; it != m_cache.end()) {
+        erase(it);
+    }
+
+    sweep(Clock::now());
+
+    while (!m_expiries.empty() && m_cache.size() >= m_options.m_capacity) {
+        erase(m_cache.find(m_expiries.begin()->second));
+    }
+
+    if (m_options.m_capacity == 0) {
+        return;
+    }
+
+    const auto expiry {m_expiries.emplace(t_expiry, t_key)};
+
+    try {
+        m_cache.emplace(t_key, Entry {t_future, expiry});
+    }
+    catch (...) {
+        m_expiries.erase(expiry);
+        throw;
+    }
+}
+
+auto Network::Resolver::sweep(Clock::time_point t_now) -> void
+{
+    while (!m_expiries.empty() && m_expiries.begin()->first <= t_now) {
+        erase(m_cache.find(m_expiries.begin()->second));
+    }
+}
+
+auto Network::Resolver::work(const std::stop_token& t_token) -> void
+{
+    std::unique_lock lock {m_mutex};
+
+    while (m_condition.wait(lock, t_token, [&] {return !m_queue.empty();})) {
+        auto request {std::move(m_queue.front())};
+        m_queue.pop_front();
+        lock.unlock();
+
+        try {
+            auto result {m_service->lookup(to_view(request.m_key.m_hostname),
+                                           to_view(request.m_key.m_service),
+                                           request.m_hints,
+                                           request.m_rt)};
+            const auto ttl {result ?
+                            m_options.m_positive_ttl :
+                            m_options.m_negative_ttl};
+
+            {
+                // Scoped so that a throwing insert releases the lock
+                // before the handler below takes it again.
+                const std::lock_guard guard {m_mutex};
+
+                if (ttl > ResolverOptions::duration::zero()) {
+                    insert(request.m_key, request.m_future,
+                           Clock::now() + ttl);
+                }
+
+                m_pending.erase(request.m_key);
+            }
+
+            request.m_promise.set_value(std::move(result));
+        }
+        catch (...) {
+            {
+                const std::lock_guard guard {m_mutex};
+                m_pending.erase(request.m_key);
+            }
+
+            request.m_promise.set_exception(std::current_exception());
+        }
+
+        lock.lock();
+    }
+}
@@ -0,0 +1,102 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/ringtracer.hpp"       // RingTracer
+#include "network/logicerror.hpp"       // LogicError
+
+#include <cstddef>      // std::size_t
+#include <mutex>        // std::lock_guard, std::unique_lock
+#include <ostream>      // std::ostream
+#include <stop_token>   // std::stop_token
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <vector>       // std::vector
+
+Network::RingTracer::RingTracer(std::ostream& t_os, std::size_t t_capacity) :
+    m_slots(t_capacity),
+    m_os(&t_os)
+{
+    if (t_capacity == 0) {
+        throw LogicError {"Zero ring capacity"};
+    }
+
+    m_thread = std::jthread {[this](const std::stop_token& token) {
+        drain(token);
+    }};
+}
+
+auto Network::RingTracer::flush() -> void
+{
+    std::unique_lock lock {m_mutex};
+    const auto tail {m_tail};
+    m_written.wait(lock, [&] {
+        return m_total >= tail;
+    });
+}
+
+auto Network::RingTracer::trace(std::string_view t_line) -> void
+{
+    {
+        const std::lock_guard lock {m_mutex};
+
+        if (m_tail - m_head == m_slots.size()) {
+            ++m_dropped;
+            return;
+        }
+
+        // Assigning into the slot reuses its previous allocation.
+        m_slots[m_tail++ % m_slots.size()].assign(t_line);
+    }
+
+    m_ready.notify_one();
+}
+
+auto Network::RingTracer::capacity() const noexcept -> std::size_t
+{
+    return m_slots.size();
+}
+
+auto Network::RingTracer::dropped() const -> std::size_t
+{
+    const std::lock_guard lock {m_mutex};
+    return m_dropped;
+}
+
+auto Network::RingTracer::drain(const std::stop_token& t_token) -> void
+{
+    std::vector<std::string> lines;
+    std::unique_lock lock {m_mutex};
+
+    while (m_ready.wait(lock, t_token, [&] {
+        return m_head != m_tail;
+    })) {
+        lines.resize(m_tail - m_head);
+
+        for (auto& line : lines) {
+            line.swap(m_slots[m_head++ % m_slots.size()]);
+        }
+
+        lock.unlock();
+
+        for (const auto& line : lines) {
+            *m_os << line << '\n';
+        }
+
+        m_os->flush();
+        lock.lock();
+        m_total += lines.size();
+        m_written.notify_all();
+    }
+}
@@ -16,12 +16,14 @@
 #include "network/run.hpp"                      // run()
 #include "network/apioptions.hpp"               // ApiOptions
 #include "network/get-runtime.hpp"              // get_runtime()
+#include "network/runtime.hpp"                  // Runtime
 #include "network/runtimeerror.hpp"             // RuntimeError
 #include "network/runtimescope.hpp"             // RuntimeScope
 #include "network/sharedruntime.hpp"            // SharedRuntime
 #include "network/to-string-runtime.hpp"        // to_string()
+#include "network/trace.hpp"                    // trace()
 
-#include <iostream>     // std::cout, std::endl
+#include <ostream>      // std::ostream
 
 auto Network::run(ApiOptions ao, RuntimeScope rs) -> SharedRuntime
 {
@@ -38,9 +40,9 @@ auto Network::run(ApiOptions ao, RuntimeScope rs) -> SharedRuntime
         throw RuntimeError {to_string(rt)};
     }
 
-    if (rt.is_verbose()) {
-        std::cout << to_string(rt) << std::endl;
-    }
+    trace(rt.tracer(), [&](std::ostream& os) {
+        os << to_string(rt);
+    });
 
     return sr;
 }
@@ -54,3 +56,14 @@ auto Network::run(bool is_verbose) -> SharedRuntime
 {
     return run(RuntimeScope::global, is_verbose);
 }
+
+auto Network::run_borrowed(bool is_verbose) -> const Runtime*
+{
+    static const auto* const rt {get_runtime(ApiOptions {is_verbose}).get()};
+
+    if (!rt->is_running()) {
+        static_cast<void>(run(RuntimeScope::global, is_verbose));
+    }
+
+    return rt;
+}
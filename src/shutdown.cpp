@@ -21,6 +21,7 @@
 #include "network/socket-error.hpp"     // socket_error
 #include "network/socketcore.hpp"       // SocketCore
 #include "network/to-os-error.hpp"      // to_os_error()
+#include "network/trace.hpp"            // trace()
 
 #ifdef _WIN32
 #include <winsock2.h>       // ::shutdown()
@@ -28,23 +29,22 @@
 #include <sys/socket.h>     // ::shutdown()
 #endif
 
-#include <iostream>     // std::cout, std::endl
+#include <ostream>      // std::ostream
 #include <sstream>      // std::ostringstream
 
 auto Network::shutdown(const SocketCore& sc, int how) -> OsError
 {
     const auto handle {sc.handle()};
 
-    if (sc.runtime()->is_verbose()) {
+    trace(sc.tracer(), [&](std::ostream& os) {
         // clang-format off
-        std::cout << "Calling ::shutdown("
-                  << handle
-                  << ", "
-                  << how
-                  << ')'
-                  << std::endl;
+        os << "Calling ::shutdown("
+           << handle
+           << ", "
+           << how
+           << ')';
         // clang-format on
-    }
+    });
 
     reset_api_error();
     const auto error {::shutdown(handle, how)};
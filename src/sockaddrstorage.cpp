@@ -0,0 +1,110 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/sockaddrstorage.hpp"  // SockAddrStorage
+#include "network/bytespan.hpp"         // ByteSpan
+#include "network/logicerror.hpp"       // LogicError
+
+#include <algorithm>    // std::equal(),
+                        // std::lexicographical_compare_three_way(),
+                        // std::ranges::copy(), std::ranges::fill()
+#include <compare>      // std::strong_ordering
+#include <cstddef>      // std::byte, std::size_t
+
+Network::SockAddrStorage::SockAddrStorage(ByteSpan t_bs)
+{
+    assign(t_bs);
+}
+
+Network::SockAddrStorage::SockAddrStorage(size_type t_size,
+                                          value_type t_value)
+{
+    resize(t_size);
+    std::ranges::fill(*this, t_value);
+}
+
+auto Network::SockAddrStorage::operator==(const SockAddrStorage& t_storage)
+    const noexcept -> bool
+{
+    return std::equal(begin(), end(), t_storage.begin(), t_storage.end());
+}
+
+auto Network::SockAddrStorage::operator<=>(const SockAddrStorage& t_storage)
+    const noexcept -> std::strong_ordering
+{
+    return std::lexicographical_compare_three_way(begin(), end(),
+                                                  t_storage.begin(),
+                                                  t_storage.end());
+}
+
+auto Network::SockAddrStorage::assign(ByteSpan t_bs) -> void
+{
+    resize(t_bs.size());
+    std::ranges::copy(t_bs, m_data.begin());
+}
+
+auto Network::SockAddrStorage::resize(size_type t_size) -> void
+{
+    if (t_size > capacity_max) {
+        throw LogicError {"Socket address too large for storage"};
+    }
+
+    m_size = t_size;
+}
+
+auto Network::SockAddrStorage::begin() noexcept -> iterator
+{
+    return m_data.data();
+}
+
+auto Network::SockAddrStorage::begin() const noexcept -> const_iterator
+{
+    return m_data.data();
+}
+
+auto Network::SockAddrStorage::capacity() const noexcept -> size_type
+{
+    return capacity_max;
+}
+
+auto Network::SockAddrStorage::data() noexcept -> value_type*
+{
+    return m_data.data();
+}
+
+auto Network::SockAddrStorage::data() const noexcept -> const value_type*
+{
+    return m_data.data();
+}
+
+auto Network::SockAddrStorage::empty() const noexcept -> bool
+{
+    return m_size == 0;
+}
+
+auto Network::SockAddrStorage::end() noexcept -> iterator
+{
+    return m_data.data() + m_size;  // NOLINT
+}
+
+auto Network::SockAddrStorage::end() const noexcept -> const_iterator
+{
+    return m_data.data() + m_size;  // NOLINT
+}
+
+auto Network::SockAddrStorage::size() const noexcept -> size_type
+{
+    return m_size;
+}
@@ -15,13 +15,43 @@
 
 #include "network/socketapi.hpp"        // SocketApi
 #include "network/apioptions.hpp"       // ApiOptions
+#include "network/iomode.hpp"           // IoMode
+#include "network/iostats.hpp"          // IoStats
+#include "network/resolver.hpp"         // Resolver
+#include "network/sharedtracer.hpp"     // SharedTracer
 #include "network/start.hpp"            // start()
 #include "network/stop.hpp"             // stop()
+#include "network/streamtracer.hpp"     // StreamTracer
+#include "network/tracer.hpp"           // Tracer
 #include "network/version.hpp"          // Version
 
+#include <atomic>       // std::memory_order_acquire,
+                        // std::memory_order_release
+#include <iostream>     // std::cout
+#include <memory>       // std::make_shared(), std::make_unique()
+#include <mutex>        // std::lock_guard
 #include <string_view>  // std::string_view
 
-Network::SocketApi::SocketApi(ApiOptions t_ao) : m_ao(t_ao)
+namespace
+{
+    auto get_tracer(const Network::ApiOptions& ao) -> Network::SharedTracer
+    {
+        if (auto tracer {ao.tracer()}) {
+            return tracer;
+        }
+
+        if (ao.is_verbose()) {
+            return std::make_shared<Network::StreamTracer>(std::cout);
+        }
+
+        return {};
+    }
+}
+
+Network::SocketApi::SocketApi(ApiOptions t_ao) :
+    m_ao(t_ao),
+    m_tracer(get_tracer(m_ao)),
+    m_stats(std::make_unique<IoStats>())
 {
 }
 
@@ -50,26 +80,56 @@ auto Network::SocketApi::system_status() const noexcept -> std::string_view
     return m_as.system_status();
 }
 
+auto Network::SocketApi::io_mode() const noexcept -> IoMode
+{
+    return m_ao.io_mode();
+}
+
 auto Network::SocketApi::is_running() const noexcept -> bool
 {
-    return m_as.system_status() == "Running";
+    return m_is_running.load(std::memory_order_acquire);
 }
 
 auto Network::SocketApi::is_verbose() const noexcept -> bool
 {
-    return m_ao.is_verbose();
+    return m_tracer != nullptr;
+}
+
+auto Network::SocketApi::resolver() const noexcept -> Resolver*
+{
+    return m_ao.resolver().get();
+}
+
+auto Network::SocketApi::stats() const noexcept -> IoStats*
+{
+    return m_stats.get();
+}
+
+auto Network::SocketApi::tracer() const noexcept -> Tracer*
+{
+    return m_tracer.get();
 }
 
 auto Network::SocketApi::start() -> void
 {
+    const std::lock_guard lock {m_mutex};
+
+    if (m_is_running.load(std::memory_order_relaxed)) {
+        return;
+    }
+
     m_as = Network::start(m_ao);
+    m_is_running.store(m_as.system_status() == "Running",
+                       std::memory_order_release);
 }
 
 auto Network::SocketApi::stop() -> int
 {
+    const std::lock_guard lock {m_mutex};
     const auto error_code = Network::stop(m_ao);
 
     if (error_code == 0) {
+        m_is_running.store(false, std::memory_order_release);
         m_as = {};
     }
 
@@ -18,9 +18,18 @@
 #include "network/family-type.hpp"      // family_type
 #include "network/handle-null.hpp"      // handle_null
 #include "network/handle-type.hpp"      // handle_type
+#include "network/iocounter.hpp"        // IoCounter
+#include "network/iolatency.hpp"        // IoLatency
+#include "network/iostats.hpp"          // IoStats
+#include "network/is-again.hpp"         // is_again()
 #include "network/logicerror.hpp"       // LogicError
+#include "network/os-error-type.hpp"    // os_error_type
 #include "network/runtime.hpp"          // Runtime
+#include "network/socketstats.hpp"      // SocketStats
+#include "network/tracer.hpp"           // Tracer
 
+#include <chrono>       // std::chrono::steady_clock
+#include <cstdint>      // std::uint64_t
 #include <string_view>  // std::string_view
 
 Network::SocketCore::SocketCore(handle_type t_handle,
@@ -45,6 +54,9 @@ Network::SocketCore::SocketCore(handle_type t_handle,
     if (!error.empty()) {
         throw LogicError {error};
     }
+
+    m_tracer = m_rt->tracer();
+    m_stats = m_rt->stats();
 }
 
 Network::SocketCore::SocketCore(const SocketCore& t_sc, handle_type t_handle) :
@@ -52,6 +64,13 @@ Network::SocketCore::SocketCore(const SocketCore& t_sc, handle_type t_handle) :
 {
 }
 
+Network::SocketCore::SocketCore(const SocketCore& t_sc,
+                                SocketStats* t_stats) noexcept :
+    SocketCore(t_sc)
+{
+    m_socket_stats = t_stats;
+}
+
 auto Network::SocketCore::family() const noexcept -> family_type
 {
     return m_family;
@@ -66,3 +85,55 @@ auto Network::SocketCore::runtime() const noexcept -> const Runtime*
 {
     return m_rt;
 }
+
+auto Network::SocketCore::socket_stats() const noexcept -> SocketStats*
+{
+    return m_socket_stats;
+}
+
+auto Network::SocketCore::tracer() const noexcept -> Tracer*
+{
+    return m_tracer;
+}
+
+auto Network::SocketCore::count(IoCounter t_counter,
+                                std::uint64_t t_value) const noexcept -> void
+{
+    if (m_stats != nullptr) {
+        m_stats->add(t_counter, t_value);
+    }
+
+    if (m_socket_stats != nullptr) {
+        m_socket_stats->add(t_counter, t_value);
+    }
+}
+
+auto Network::SocketCore::count_error(os_error_type t_number) const noexcept ->
+    void
+{
+    if (is_again(t_number)) {
+        count(IoCounter::again);
+    }
+
+    if (m_stats != nullptr) {
+        m_stats->add_error(t_number);
+    }
+
+    if (m_socket_stats != nullptr) {
+        m_socket_stats->add(IoCounter::errors);
+    }
+}
+
+auto Network::SocketCore::now() const noexcept -> Clock::time_point
+{
+    return m_stats != nullptr ? Clock::now() : Clock::time_point {};
+}
+
+auto Network::SocketCore::record(IoLatency t_latency,
+                                 Clock::time_point t_start) const noexcept ->
+    void
+{
+    if (m_stats != nullptr) {
+        m_stats->record(t_latency, Clock::now() - t_start);
+    }
+}
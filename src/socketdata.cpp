@@ -15,12 +15,34 @@
 
 #include "network/socketdata.hpp"       // SocketData
 #include "network/acceptdata.hpp"       // AcceptData
+#include "network/bytespan.hpp"         // ByteSpan
 #include "network/family-type.hpp"      // family_type
 #include "network/handle-type.hpp"      // handle_type
+#include "network/namecache.hpp"        // NameCache
 #include "network/runtime.hpp"          // Runtime
+#include "network/sockaddrstorage.hpp"  // SockAddrStorage
 #include "network/socketcore.hpp"       // SocketCore
 #include "network/symbol.hpp"           // Symbol
 
+#include <memory>       // std::make_unique()
+
+namespace
+{
+    using Network::Symbol;
+
+    auto is_open(Symbol symbol) noexcept -> bool
+    {
+        switch (symbol) {
+        case Symbol::accept:
+        case Symbol::bind:
+        case Symbol::connect:
+            return true;
+        default:
+            return false;
+        }
+    }
+}
+
 Network::SocketData::SocketData(handle_type t_handle,
                                 family_type t_family,
                                 const Runtime* t_rt) :
@@ -28,17 +50,65 @@ Network::SocketData::SocketData(handle_type t_handle,
 {
 }
 
-Network::SocketData::SocketData(const AcceptData& t_ad) : m_sc(t_ad.core())
+Network::SocketData::SocketData(const AcceptData& t_ad) :
+    m_sc(t_ad.core()),
+    m_open(t_ad.name())
 {
-    m_nc[Symbol::accept] = t_ad.name();
 }
 
+Network::SocketData::SocketData(const SocketData& t_sd) :
+    m_sc(t_sd.m_sc),
+    m_open(t_sd.m_open),
+    m_open_symbol(t_sd.m_open_symbol),
+    m_nc(t_sd.m_nc ? std::make_unique<NameCache>(*t_sd.m_nc) : nullptr)
+{
+}
+
+Network::SocketData::SocketData(SocketData&& t_sd) noexcept = default;
+
+Network::SocketData::~SocketData() noexcept = default;
+
+auto Network::SocketData::operator=(const SocketData& t_sd) -> SocketData&
+{
+    if (this != &t_sd) {
+        m_sc = t_sd.m_sc;
+        m_open = t_sd.m_open;
+        m_open_symbol = t_sd.m_open_symbol;
+        m_nc = t_sd.m_nc ? std::make_unique<NameCache>(*t_sd.m_nc) : nullptr;
+    }
+
+    return *this;
+}
+
+auto Network::SocketData::operator=(SocketData&& t_sd) noexcept ->
+    SocketData& = default;
+
 auto Network::SocketData::core() const noexcept -> const SocketCore&
 {
     return m_sc;
 }
 
-auto Network::SocketData::name(Symbol t_symbol) const noexcept -> Name&
+auto Network::SocketData::name(Symbol t_symbol) const noexcept -> ByteSpan
+{
+    if (t_symbol == m_open_symbol) {
+        return m_open;
+    }
+
+    return m_nc ? m_nc->get(t_symbol) : ByteSpan {};
+}
+
+auto Network::SocketData::name(Symbol t_symbol, ByteSpan t_bs) const -> void
 {
-    return m_nc[t_symbol];
+    if (is_open(t_symbol) &&
+        (t_symbol == m_open_symbol || m_open.empty())) {
+        m_open.assign(t_bs);
+        m_open_symbol = t_symbol;
+        return;
+    }
+
+    if (!m_nc) {
+        m_nc = std::make_unique<NameCache>();
+    }
+
+    m_nc->set(t_symbol, t_bs);
 }
@@ -0,0 +1,45 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/socketdeleter.hpp"    // SocketDeleter
+#include "network/socket.hpp"           // Socket
+#include "network/socketslab.hpp"       // SocketSlab
+
+#include <memory>       // std::destroy_at()
+
+Network::SocketDeleter::SocketDeleter(SocketSlab* t_slab) noexcept :
+    m_slab(t_slab)
+{
+}
+
+auto Network::SocketDeleter::operator()(Socket* t_socket) const noexcept ->
+    void
+{
+    if (m_slab == nullptr) {
+        delete t_socket;  // NOLINT
+        return;
+    }
+
+    // The slot begins at the most-derived object, not necessarily at
+    // its Socket base.
+    auto* const slot {dynamic_cast<void*>(t_socket)};
+    std::destroy_at(t_socket);
+    m_slab->deallocate(slot);
+}
+
+auto Network::SocketDeleter::slab() const noexcept -> SocketSlab*
+{
+    return m_slab;
+}
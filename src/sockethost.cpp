@@ -15,8 +15,8 @@
 
 #include "network/sockethost.hpp"               // SocketHost
 #include "network/bytespan.hpp"                 // ByteSpan
-#include "network/bytestring.hpp"               // ByteString
 #include "network/optionalhostname.hpp"         // OptionalHostname
+#include "network/sockaddrstorage.hpp"          // SockAddrStorage
 #include "network/to-bytestring-void.hpp"       // to_bytestring()
 #include "network/to-sa-length.hpp"             // to_sa_length()
 
@@ -49,7 +49,8 @@ auto Network::SocketHost::canonical_name() const noexcept ->
     return m_name;
 }
 
-auto Network::SocketHost::to_bytestring(const addrinfo& t_ai) -> ByteString
+auto Network::SocketHost::to_bytestring(const addrinfo& t_ai) ->
+    SockAddrStorage
 {
     return Network::to_bytestring(t_ai.ai_addr, to_sa_length(t_ai.ai_addrlen));
 }
@@ -0,0 +1,104 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/socketslab.hpp"       // SocketSlab
+#include "network/inetsocket.hpp"       // InetSocket
+
+#ifndef _WIN32
+#include "network/unixsocket.hpp"       // UnixSocket
+#endif
+
+#include <algorithm>    // std::max()
+#include <cstddef>      // std::size_t
+#include <mutex>        // std::lock_guard
+#include <new>          // ::operator delete(), ::operator new()
+
+namespace
+{
+    using Network::InetSocket;
+#ifndef _WIN32
+    using Network::UnixSocket;
+#endif
+
+#ifdef _WIN32
+    constexpr std::size_t slot_align {alignof(InetSocket)};
+    constexpr std::size_t slot_bytes {sizeof(InetSocket)};
+#else
+    constexpr std::size_t slot_align {std::max(alignof(InetSocket),
+                                               alignof(UnixSocket))};
+    constexpr std::size_t slot_bytes {std::max(sizeof(InetSocket),
+                                               sizeof(UnixSocket))};
+#endif
+
+    static_assert(slot_align <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+    static_assert(slot_bytes % slot_align == 0);
+}
+
+Network::SocketSlab::~SocketSlab() noexcept
+{
+    for (auto* const chunk : m_chunks) {
+        ::operator delete(chunk);
+    }
+}
+
+auto Network::SocketSlab::allocate() -> void*
+{
+    const std::lock_guard lock {m_mutex};
+
+    if (m_free == nullptr) {
+        m_chunks.reserve(m_chunks.size() + 1);
+        auto* const chunk {static_cast<std::byte*>(::operator new(
+            chunk_slots * slot_bytes))};
+        m_chunks.push_back(chunk);
+
+        for (auto i {chunk_slots}; i > 0; --i) {
+            auto* const slot {chunk + (i - 1) * slot_bytes};
+            m_free = ::new (slot) FreeSlot {m_free};
+        }
+    }
+
+    auto* const slot {m_free};
+    m_free = slot->m_next;
+    ++m_size;
+    return slot;
+}
+
+auto Network::SocketSlab::deallocate(void* t_slot) noexcept -> void
+{
+    if (t_slot == nullptr) {
+        return;
+    }
+
+    const std::lock_guard lock {m_mutex};
+    m_free = ::new (t_slot) FreeSlot {m_free};
+    --m_size;
+}
+
+auto Network::SocketSlab::capacity() const noexcept -> std::size_t
+{
+    const std::lock_guard lock {m_mutex};
+    return m_chunks.size() * chunk_slots;
+}
+
+auto Network::SocketSlab::size() const noexcept -> std::size_t
+{
+    const std::lock_guard lock {m_mutex};
+    return m_size;
+}
+
+auto Network::SocketSlab::slot_size() noexcept -> std::size_t
+{
+    return slot_bytes;
+}
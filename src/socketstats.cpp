@@ -0,0 +1,41 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/socketstats.hpp"      // SocketStats
+#include "network/iocounter.hpp"        // IoCounter, io_counter_size
+#include "network/iostatssnapshot.hpp"  // IoStatsSnapshot
+
+#include <atomic>       // std::memory_order_relaxed
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t
+
+auto Network::SocketStats::add(IoCounter t_counter,
+                               std::uint64_t t_value) noexcept -> void
+{
+    const auto index {static_cast<std::size_t>(t_counter)};
+    m_counters[index].fetch_add(t_value, std::memory_order_relaxed);
+}
+
+auto Network::SocketStats::snapshot() const noexcept -> IoStatsSnapshot
+{
+    IoStatsSnapshot result;
+
+    for (std::size_t i {0}; i < io_counter_size; ++i) {
+        result.add(static_cast<IoCounter>(i),
+                   m_counters[i].load(std::memory_order_relaxed));
+    }
+
+    return result;
+}
@@ -0,0 +1,68 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/spawn.hpp"            // spawn()
+#include "network/task.hpp"             // Task
+
+#include <coroutine>    // std::suspend_never
+#include <exception>    // std::terminate()
+#include <utility>      // std::move()
+
+namespace
+{
+    struct Detached
+    {
+        struct promise_type
+        {
+            [[nodiscard]] auto get_return_object() const noexcept -> Detached
+            {
+                return {};
+            }
+
+            [[nodiscard]] auto initial_suspend() const noexcept ->
+                std::suspend_never
+            {
+                return {};
+            }
+
+            [[nodiscard]] auto final_suspend() const noexcept ->
+                std::suspend_never
+            {
+                return {};
+            }
+
+            auto return_void() const noexcept -> void
+            {
+            }
+
+            [[noreturn]] auto unhandled_exception() const noexcept -> void
+            {
+                // Like a std::thread, a detached task has nobody to
+                // report an exception to.
+                std::terminate();
+            }
+        };
+    };
+
+    auto detach(Network::Task<> task) -> Detached
+    {
+        co_await task;
+    }
+}
+
+auto Network::spawn(Task<> task) -> void
+{
+    detach(std::move(task));
+}
@@ -0,0 +1,72 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/iostatssnapshot.hpp"  // IoStatsSnapshot,
+                                        // operator<<()
+#include "network/iolatency.hpp"        // io_latency_size
+
+#include <array>        // std::array
+#include <cstddef>      // std::size_t
+#include <ostream>      // std::ostream
+#include <string_view>  // std::string_view
+
+namespace
+{
+    using LatencyNames =
+        std::array<std::string_view, Network::io_latency_size>;
+
+    constexpr LatencyNames latency_names {
+        "accept", "connect", "getaddrinfo", "getnameinfo"
+    };
+}
+
+auto Network::operator<<(std::ostream& os,
+                         const IoStatsSnapshot& snapshot) -> std::ostream&
+{
+    // clang-format off
+    os << "accepts " << snapshot.m_accepts << '\n'
+       << "again " << snapshot.m_again << '\n'
+       << "bytes_read " << snapshot.m_bytes_read << '\n'
+       << "bytes_written " << snapshot.m_bytes_written << '\n'
+       << "closes " << snapshot.m_closes << '\n'
+       << "connects " << snapshot.m_connects << '\n'
+       << "errors " << snapshot.m_errors << '\n'
+       << "resolve_errors " << snapshot.m_resolve_errors << '\n'
+       << "resolves " << snapshot.m_resolves << '\n'
+       << "system_calls " << snapshot.m_system_calls << '\n';
+    // clang-format on
+
+    for (std::size_t i {0}; i < latency_names.size(); ++i) {
+        const auto& name {latency_names[i]};
+        const auto& latency {snapshot.m_latencies[i]};
+        // clang-format off
+        os << name << "_count " << latency.m_count << '\n'
+           << name << "_p50_ns " << latency.m_p50 << '\n'
+           << name << "_p99_ns " << latency.m_p99 << '\n'
+           << name << "_p999_ns " << latency.m_p999 << '\n'
+           << name << "_max_ns " << latency.m_max << '\n';
+        // clang-format on
+    }
+
+    const auto& errors {snapshot.m_errors_by_number};
+
+    for (std::size_t i {0}; i < errors.size(); ++i) {
+        if (errors[i] != 0) {
+            os << "error " << i << ' ' << errors[i] << '\n';
+        }
+    }
+
+    return os;
+}
@@ -0,0 +1,34 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/streamtracer.hpp"     // StreamTracer
+
+#include <ostream>      // std::endl, std::ostream
+#include <string_view>  // std::string_view
+
+Network::StreamTracer::StreamTracer(std::ostream& t_os) noexcept :
+    m_os(&t_os)
+{
+}
+
+auto Network::StreamTracer::flush() -> void
+{
+    m_os->flush();
+}
+
+auto Network::StreamTracer::trace(std::string_view t_line) -> void
+{
+    *m_os << t_line << std::endl;
+}
@@ -15,8 +15,9 @@
 
 #include "network/assert.hpp"           // assert()
 #include "network/network.hpp"          // Address, ByteSpan, Error,
-                                        // Hostname, SocketFamily,
-                                        // SocketHints, SocketHost,
+                                        // Hostname, SockAddrStorage,
+                                        // SocketFamily, SocketHints,
+                                        // SocketHost,
                                         // SocketLimits, insert(),
                                         // sa_family_type, sa_size,
                                         // sin_family_type,
@@ -54,9 +55,9 @@ namespace
 {
     using Network::Address;
     using Network::ByteSpan;
-    using Network::ByteString;
     using Network::Error;
     using Network::Hostname;
+    using Network::SockAddrStorage;
     using Network::SocketFamily;
     using Network::SocketHints;
     using Network::SocketHost;
@@ -222,14 +223,14 @@ namespace
 
         const auto text {address.text()};
         static_cast<void>(text);
-        ByteString addr {bs.begin(), bs.end()};
-        assert(ByteString {address} == addr);
+        const SockAddrStorage addr {bs};
+        assert(SockAddrStorage {address} == addr);
         previous_address = addr;
     }
 
     auto test_address_empty() -> void
     {
-        const Address address {ByteString {}};
+        const Address address {SockAddrStorage {}};
         assert(address.empty());
         assert(address.port() == 0);
         assert(address.text() == string_null);
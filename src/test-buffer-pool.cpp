@@ -0,0 +1,160 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/assert.hpp"           // assert()
+#include "network/network.hpp"          // BufferPool, Error,
+                                        // PooledBuffer, run()
+#include "network/parse.hpp"            // parse()
+
+#include <cstdint>      // std::uintptr_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <cstring>      // std::memcpy()
+#include <iostream>     // std::cerr, std::endl
+#include <string_view>  // std::string_view
+#include <thread>       // std::jthread
+#include <utility>      // std::move()
+#include <vector>       // std::vector
+
+namespace
+{
+    using Network::BufferPool;
+    using Network::Error;
+    using Network::PooledBuffer;
+    using Network::parse;
+    using Network::run;
+
+    constexpr std::string_view hello {"Hello"};
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto is_aligned(const void* pointer) -> bool
+    {
+        const auto address {reinterpret_cast<std::uintptr_t>(pointer)};  // NOLINT
+        return address % BufferPool::alignment == 0;
+    }
+
+    auto test_alignment() -> void
+    {
+        for (const auto size : {0UZ, 1UZ, 12UZ, 100UZ, 4096UZ, 65537UZ,
+                                BufferPool::capacity_max + 1}) {
+            PooledBuffer buffer {size};
+            assert(buffer.size() == size);
+            assert(buffer.capacity() >= size);
+            assert(buffer.capacity() >= BufferPool::capacity_min);
+            assert(is_aligned(buffer.data()));
+        }
+    }
+
+    auto test_cache_limit() -> void
+    {
+        BufferPool::trim();
+        std::vector<PooledBuffer> buffers;
+
+        for (std::size_t i {0}; i < BufferPool::cache_max + 2; ++i) {
+            buffers.emplace_back(BufferPool::capacity_min);
+        }
+
+        buffers.clear();
+        assert(BufferPool::cached() == BufferPool::cache_max);
+        BufferPool::trim();
+        assert(BufferPool::cached() == 0);
+    }
+
+    auto test_move() -> void
+    {
+        BufferPool::trim();
+        PooledBuffer buffer_1 {hello.size()};
+        auto* const data {buffer_1.data()};
+        PooledBuffer buffer_2 {std::move(buffer_1)};
+        assert(buffer_2.data() == data);
+        assert(buffer_2.size() == hello.size());
+        buffer_1 = std::move(buffer_2);
+        assert(buffer_1.data() == data);
+        assert(BufferPool::cached() == 0);
+    }
+
+    auto test_recycle() -> void
+    {
+        BufferPool::trim();
+        const char* data {nullptr};
+        {
+            PooledBuffer buffer {100};
+            assert(buffer.capacity() == 128);
+            data = buffer.data();
+        }
+        assert(BufferPool::cached() == 1);
+        PooledBuffer buffer {128};
+        assert(buffer.data() == data);
+        assert(BufferPool::cached() == 0);
+    }
+
+    auto test_thread() -> void
+    {
+        BufferPool::trim();
+        {
+            const PooledBuffer buffer {hello.size()};
+        }
+        assert(BufferPool::cached() == 1);
+        std::jthread thread {[] {
+            assert(BufferPool::cached() == 0);
+            const PooledBuffer buffer {hello.size()};
+        }};
+        thread.join();
+        assert(BufferPool::cached() == 1);
+    }
+
+    auto test_view() -> void
+    {
+        PooledBuffer buffer {hello.size() * 2};
+        std::memcpy(buffer.data(), hello.data(), hello.size());
+        assert(buffer.view(hello.size()) == hello);
+        assert(buffer.view(buffer.size() + 1).size() == buffer.size());
+    }
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+        test_alignment();
+        test_cache_limit();
+        test_move();
+        test_recycle();
+        test_thread();
+        test_view();
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
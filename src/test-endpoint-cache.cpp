@@ -0,0 +1,219 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/assert.hpp"                   // assert()
+#include "network/hostname-length-limits.hpp"   // hostname_length_max
+#include "network/network.hpp"                  // EndpointCache, Error,
+                                                // Runtime, SockAddrStorage,
+                                                // TextBuffer,
+                                                // get_endpointresult(),
+                                                // get_numeric_endpoint(),
+                                                // run(), to_bytestring()
+#include "network/parse.hpp"                    // parse()
+#include "network/service-length-limits.hpp"    // service_length_max
+
+#ifdef _WIN32
+#include <winsock2.h>       // AF_INET, AF_INET6, htons(), sockaddr_in
+#include <ws2tcpip.h>       // NI_NUMERICHOST, NI_NUMERICSERV,
+                            // inet_pton(), sockaddr_in6
+#else
+#include <arpa/inet.h>      // htons(), inet_pton()
+#include <netdb.h>          // NI_NUMERICHOST, NI_NUMERICSERV
+#include <netinet/in.h>     // sockaddr_in, sockaddr_in6
+#include <sys/socket.h>     // AF_INET, AF_INET6
+#endif
+
+#include <array>        // std::array
+#include <cstdint>      // std::uint16_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <iostream>     // std::cerr, std::cout, std::endl
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+
+namespace
+{
+    using Network::EndpointCache;
+    using Network::Error;
+    using Network::Runtime;
+    using Network::SockAddrStorage;
+    using Network::TextBuffer;
+    using Network::get_endpointresult;
+    using Network::get_numeric_endpoint;
+    using Network::hostname_length_max;
+    using Network::parse;
+    using Network::run;
+    using Network::service_length_max;
+    using Network::to_bytestring;
+
+    constexpr auto flags {NI_NUMERICHOST | NI_NUMERICSERV};
+    constexpr std::uint16_t port {8080};
+
+    constexpr std::array<std::string_view, 6> inet_addresses {
+        "0.0.0.0",
+        "1.2.3.4",
+        "10.0.0.255",
+        "127.0.0.1",
+        "192.168.100.200",
+        "255.255.255.255",
+    };
+
+    constexpr std::array<std::string_view, 14> inet6_addresses {
+        "::",
+        "::1",
+        "::2",
+        "::1.2.3.4",
+        "::ffff:1.2.3.4",
+        "::ffff:0:1.2.3.4",
+        "1::",
+        "1:0:0:1::",
+        "64:ff9b::102:304",
+        "2001:db8::1",
+        "2001:db8:0:0:1:0:0:1",
+        "2001:db8:0:1:0:1:0:1",
+        "fe80::abcd:ef01",
+        "1:2:3:4:5:6:7:8",
+    };
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto get_inet(std::string_view address) -> SockAddrStorage
+    {
+        const std::string str {address};
+        sockaddr_in sin {};
+        sin.sin_family = AF_INET;
+        sin.sin_port = htons(port);
+        const auto result {::inet_pton(AF_INET, str.c_str(), &sin.sin_addr)};
+        assert(result == 1);
+        return to_bytestring(&sin, sizeof sin);
+    }
+
+    auto get_inet6(std::string_view address) -> SockAddrStorage
+    {
+        const std::string str {address};
+        sockaddr_in6 sin6 {};
+        sin6.sin6_family = AF_INET6;
+        sin6.sin6_port = htons(port);
+        const auto result {::inet_pton(AF_INET6, str.c_str(),
+                                       &sin6.sin6_addr)};
+        assert(result == 1);
+        return to_bytestring(&sin6, sizeof sin6);
+    }
+
+    auto test_numeric(const SockAddrStorage& bs, const Runtime* rt) -> void
+    {
+        TextBuffer hostname {hostname_length_max};
+        TextBuffer service {service_length_max};
+        assert(!get_endpointresult(hostname, service, bs, flags, rt));
+        const auto endpoint {get_numeric_endpoint(bs)};
+
+        if (is_verbose) {
+            std::cout << "Formatted "
+                      << std::string {hostname}
+                      << " as "
+                      << (endpoint ? (*endpoint)[0] : "nothing")
+                      << std::endl;
+        }
+
+        assert(endpoint);
+        assert((*endpoint)[0] == std::string {hostname});
+        assert((*endpoint)[1] == std::string {service});
+    }
+
+    auto test_cache(const Runtime* rt) -> void
+    {
+        EndpointCache cache {2};
+        const auto bs_1 {get_inet("127.0.0.1")};
+        const auto bs_2 {get_inet("10.0.0.1")};
+        const auto bs_3 {get_inet6("::1")};
+        assert(get_endpointresult(bs_1, flags, rt, cache));
+        assert(get_endpointresult(bs_2, flags, rt, cache));
+        assert(get_endpointresult(bs_1, flags, rt, cache));
+        assert(cache.hits() == 1);
+        assert(cache.misses() == 2);
+        assert(cache.size() == 2);
+
+        // Inserting a third entry evicts the least recently used one.
+        assert(get_endpointresult(bs_3, flags, rt, cache));
+        assert(cache.size() == 2);
+        assert(cache.find(bs_1, flags));
+        assert(!cache.find(bs_2, flags));
+        assert(cache.find(bs_3, flags));
+        assert(!cache.find(bs_1, 0));
+        cache.clear();
+        assert(cache.size() == 0);
+        assert(cache.capacity() == 2);
+    }
+
+    auto test_cache_invalid(const Runtime* rt) -> void
+    {
+        EndpointCache cache {1};
+        const auto bs {get_inet("127.0.0.1")};
+        assert(!get_endpointresult(bs, -1, rt, cache));
+        assert(cache.size() == 0);
+    }
+
+    auto test_numeric(const Runtime* rt) -> void
+    {
+        for (const auto& address : inet_addresses) {
+            test_numeric(get_inet(address), rt);
+        }
+
+        for (const auto& address : inet6_addresses) {
+            test_numeric(get_inet6(address), rt);
+        }
+    }
+
+    auto test_numeric_scoped() -> void
+    {
+        sockaddr_in6 sin6 {};
+        sin6.sin6_family = AF_INET6;
+        sin6.sin6_scope_id = 1;
+        assert(!get_numeric_endpoint(to_bytestring(&sin6, sizeof sin6)));
+    }
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+        const auto* const rt {sr.get()};
+        test_cache(rt);
+        test_cache_invalid(rt);
+        test_numeric(rt);
+        test_numeric_scoped();
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
@@ -14,7 +14,8 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "network/assert.hpp"           // assert()
-#include "network/network.hpp"          // Error, RuntimeError,
+#include "network/network.hpp"          // Error, OsError,
+                                        // RuntimeError, SystemCall,
                                         // get_api_error(),
                                         // get_os_error(),
                                         // reset_api_error(),
@@ -28,17 +29,26 @@
 #include "network/parse.hpp"            // parse()
 #include "network/quote.hpp"            // quote()
 
+#include <array>        // std::array
+#include <cstddef>      // std::byte
+#include <cstdint>      // std::int64_t
 #include <cstdlib>      // EXIT_FAILURE, std::exit()
 #include <iostream>     // std::cerr, std::cout, std::endl
 #include <limits>       // std::numeric_limits
+#include <optional>     // std::optional
+#include <ostream>      // std::ostream
 #include <regex>        // std::regex, std::regex_match
 #include <string>       // std::string
+#include <thread>       // std::jthread
+#include <vector>       // std::vector
 
 namespace
 {
     using Network::Error;
     using Network::LogicError;
+    using Network::OsError;
     using Network::RuntimeError;
+    using Network::SystemCall;
     using Network::ValueError;
     using Network::get_api_error;
     using Network::get_os_error;
@@ -310,6 +320,58 @@ namespace
 
 #endif
 
+    auto test_system_call() -> void
+    {
+        std::optional<OsError> error;
+
+        {
+            std::array<std::byte, 4> address {
+                std::byte {1}, std::byte {2}, std::byte {3}, std::byte {4}
+            };
+            const SystemCall call {
+                .m_name = "::connect",
+                .m_arguments = [](std::ostream& os,
+                                  const SystemCall& t_call) {
+                    // clang-format off
+                    os << t_call.m_handle
+                       << ", "
+                       << static_cast<int>(t_call.m_address[3])
+                       << ", "
+                       << t_call.m_values[0];
+                    // clang-format on
+                },
+                .m_address = address,
+                .m_values = {static_cast<std::int64_t>(address.size())},
+                .m_handle = 5,
+            };
+            error.emplace(1, 1, call);
+            address.fill(std::byte {0});
+        }
+
+        // A copy still refers to the address recorded with the call.
+        const auto copy {*error};
+        error.reset();
+        const std::string expected {"Call to ::connect(5, 4, 4) failed"};
+        assert(copy.string().starts_with(expected));
+        assert(copy.call().m_address.size() == 4);
+
+        // Formatting leaves the error unchanged, so that threads may
+        // share it.
+        std::array<std::string, 4> strings;
+
+        {
+            std::vector<std::jthread> threads;
+
+            for (auto& str : strings) {
+                threads.emplace_back([&] { str = copy.string(); });
+            }
+        }
+
+        for (const auto& str : strings) {
+            assert(str == copy.string());
+        }
+    }
+
     auto test_throw_error() -> void
     {
         const std::string expected {"Error"};
@@ -375,6 +437,7 @@ auto main(int argc, char* argv[]) -> int
         test_path_length();
         test_sun_length();
 #endif
+        test_system_call();
         test_throw_error();
         test_throw_logic_error();
         test_throw_runtime_error();
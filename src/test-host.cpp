@@ -15,13 +15,13 @@
 
 #include "network/argumentspan.hpp"     // ArgumentSpan
 #include "network/assert.hpp"           // assert()
-#include "network/network.hpp"          // Address, ByteSpan,
-                                        // ByteString, Endpoint,
+#include "network/network.hpp"          // Address, ByteSpan, Endpoint,
                                         // Error, HostnameView,
                                         // IpSocketHints,
                                         // OptionalHints,
                                         // OptionalHostname, OsError,
-                                        // Runtime, SocketHints,
+                                        // Runtime, SockAddrStorage,
+                                        // SocketHints,
                                         // SocketHost, get_endpoint(),
                                         // get_endpointresult(),
                                         // get_hostname(), insert(),
@@ -53,7 +53,6 @@ namespace
     using Network::Address;
     using Network::ArgumentSpan;
     using Network::ByteSpan;
-    using Network::ByteString;
     using Network::Endpoint;
     using Network::Error;
     using Network::HostnameView;
@@ -62,6 +61,7 @@ namespace
     using Network::OptionalHostname;
     using Network::OsError;
     using Network::Runtime;
+    using Network::SockAddrStorage;
     using Network::SocketHints;
     using Network::SocketHost;
     using Network::get_endpoint;
@@ -185,7 +185,7 @@ namespace
         return codes;
     }
 
-    auto get_inet_address() -> ByteString
+    auto get_inet_address() -> SockAddrStorage
     {
         sockaddr_in sin {};
 #ifdef HAVE_SOCKADDR_SA_LEN
@@ -262,7 +262,7 @@ namespace
     auto test_get_endpoint_invalid_flag(const Runtime* rt) -> void
     {
         std::string actual_str;
-        const ByteString addr {get_inet_address()};
+        const SockAddrStorage addr {get_inet_address()};
 
         try {
             static_cast<void>(get_endpoint(addr, -1, rt));
@@ -279,7 +279,7 @@ namespace
     auto test_get_endpointresult_invalid_flag(const Runtime* rt) -> void
     {
         std::string actual_str;
-        const ByteString addr {get_inet_address()};
+        const SockAddrStorage addr {get_inet_address()};
         const auto result {get_endpointresult(addr, -1, rt)};
 
         if (!result) {
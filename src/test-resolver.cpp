@@ -0,0 +1,330 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/assert.hpp"           // assert()
+#include "network/insert-endpoint.hpp"  // insert()
+#include "network/network.hpp"          // AddrinfoService, ApiOptions,
+                                        // Error, HostnameView,
+                                        // NameService, OptionalHints,
+                                        // OsError, ResolveResult,
+                                        // Resolver, ResolverOptions,
+                                        // Runtime, RuntimeScope,
+                                        // ServiceView, SocketHints,
+                                        // SocketTemplate,
+                                        // SocketTemplateVector, run()
+#include "network/openinputs.hpp"       // OpenInputs
+#include "network/parse.hpp"            // parse()
+
+#ifdef _WIN32
+#include <winsock2.h>       // AF_INET, INADDR_LOOPBACK, SOCK_STREAM,
+                            // htonl(), sockaddr, sockaddr_in
+#include <ws2tcpip.h>       // addrinfo
+#else
+#include <arpa/inet.h>      // htonl()
+#include <netdb.h>          // addrinfo
+#include <netinet/in.h>     // INADDR_LOOPBACK, sockaddr_in
+#include <sys/socket.h>     // AF_INET, SOCK_STREAM, sockaddr
+#endif
+
+#include <atomic>       // std::atomic
+#include <chrono>       // std::chrono::milliseconds,
+                        // std::chrono::seconds
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <expected>     // std::unexpected
+#include <future>       // std::promise, std::shared_future
+#include <iostream>     // std::cerr, std::cout, std::endl
+#include <iterator>     // std::back_inserter()
+#include <memory>       // std::make_shared()
+#include <thread>       // std::this_thread::sleep_for()
+#include <utility>      // std::move()
+
+namespace
+{
+    using Network::AddrinfoService;
+    using Network::ApiOptions;
+    using Network::Error;
+    using Network::HostnameView;
+    using Network::NameService;
+    using Network::OpenInputs;
+    using Network::OptionalHints;
+    using Network::OsError;
+    using Network::ResolveResult;
+    using Network::Resolver;
+    using Network::ResolverOptions;
+    using Network::Runtime;
+    using Network::RuntimeScope;
+    using Network::ServiceView;
+    using Network::SocketHints;
+    using Network::SocketTemplate;
+    using Network::SocketTemplateVector;
+    using Network::insert;
+    using Network::parse;
+    using Network::run;
+
+    constexpr HostnameView invalid_host {"invalid.test"};
+    constexpr HostnameView valid_host {"valid.test"};
+    constexpr ServiceView service {"http"};
+    constexpr SocketHints hints {AF_INET, SOCK_STREAM, 0};
+
+    auto is_verbose {false};  // NOLINT
+
+    class FakeService final : public NameService
+    {
+    public:
+        explicit FakeService(std::shared_future<void> t_gate = {}) :
+            m_gate(std::move(t_gate))
+        {
+        }
+
+        FakeService(const FakeService&) noexcept = delete;
+        FakeService(FakeService&&) noexcept = delete;
+        ~FakeService() noexcept final = default;
+        auto operator=(const FakeService&) noexcept -> FakeService& = delete;
+        auto operator=(FakeService&&) noexcept -> FakeService& = delete;
+
+        [[nodiscard]] auto lookup(const HostnameView& t_hostname,
+                                  const ServiceView& t_service,
+                                  const OptionalHints& t_hints,
+                                  const Runtime* t_rt) const ->
+            ResolveResult final
+        {
+            static_cast<void>(t_service);
+            static_cast<void>(t_hints);
+            static_cast<void>(t_rt);
+            ++m_count;
+
+            if (m_gate.valid()) {
+                m_gate.wait();
+            }
+
+            if (t_hostname == invalid_host) {
+                return std::unexpected {OsError {1, "Fake lookup failed"}};
+            }
+
+            sockaddr_in sin {};
+            sin.sin_family = AF_INET;
+            sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            void* pointer {&sin};
+            addrinfo ai {};
+            ai.ai_family = AF_INET;
+            ai.ai_socktype = SOCK_STREAM;
+            ai.ai_addr = static_cast<sockaddr*>(pointer);
+            ai.ai_addrlen = sizeof sin;
+            return SocketTemplateVector {SocketTemplate {ai}};
+        }
+
+        [[nodiscard]] auto count() const noexcept -> int
+        {
+            return m_count;
+        }
+
+    private:
+        std::shared_future<void> m_gate;
+        mutable std::atomic<int> m_count {0};
+    };
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto print(const ResolveResult& result) -> void
+    {
+        if (is_verbose) {
+            if (result) {
+                std::cout << "Resolved "
+                          << result->size()
+                          << " address(es)"
+                          << std::endl;
+            }
+            else {
+                std::cout << "Error: "
+                          << result.error().string()
+                          << std::endl;
+            }
+        }
+    }
+
+    auto test_addrinfo(const Runtime* rt) -> void
+    {
+        Resolver resolver {std::make_shared<AddrinfoService>()};
+        const auto result {resolver.resolve("localhost", {}, hints, rt)};
+        print(result);
+        assert(result && !result->empty());
+    }
+
+    auto test_capacity(const Runtime* rt) -> void
+    {
+        const auto fake {std::make_shared<FakeService>()};
+        ResolverOptions options;
+        options.m_capacity = 2;
+        Resolver resolver {fake, options};
+
+        for (const ServiceView sv : {"ftp", "http", "https"}) {
+            static_cast<void>(resolver.resolve(valid_host, sv, hints, rt));
+        }
+
+        assert(resolver.size() == 2);
+
+        // The entry closest to expiring was the one dropped.
+        static_cast<void>(resolver.resolve(valid_host, "https", hints, rt));
+        static_cast<void>(resolver.resolve(valid_host, "ftp", hints, rt));
+        assert(fake->count() == 4);
+        assert(resolver.size() == 2);
+    }
+
+    auto test_clear(const Runtime* rt) -> void
+    {
+        const auto fake {std::make_shared<FakeService>()};
+        Resolver resolver {fake};
+        static_cast<void>(resolver.resolve(valid_host, service, hints, rt));
+        assert(resolver.size() == 1);
+        resolver.clear();
+        assert(resolver.size() == 0);
+        static_cast<void>(resolver.resolve(valid_host, service, hints, rt));
+        assert(fake->count() == 2);
+    }
+
+    auto test_coalescing(const Runtime* rt) -> void
+    {
+        std::promise<void> gate;
+        const auto fake {
+            std::make_shared<FakeService>(gate.get_future().share())
+        };
+        Resolver resolver {fake};
+        const auto future_1 {resolver.resolve_async(valid_host, service,
+                                                    hints, rt)};
+        const auto future_2 {resolver.resolve_async(valid_host, service,
+                                                    hints, rt)};
+        const auto future_3 {resolver.resolve_async(valid_host, service,
+                                                    hints, rt)};
+        gate.set_value();
+        assert(future_1.get() && future_2.get() && future_3.get());
+        assert(fake->count() == 1);
+        assert(resolver.coalesced() == 2);
+        assert(resolver.misses() == 1);
+    }
+
+    auto test_expiry(const Runtime* rt) -> void
+    {
+        const auto fake {std::make_shared<FakeService>()};
+        ResolverOptions options;
+        options.m_positive_ttl = std::chrono::milliseconds {1};
+        Resolver resolver {fake, options};
+        static_cast<void>(resolver.resolve(valid_host, "ftp", hints, rt));
+        std::this_thread::sleep_for(std::chrono::milliseconds {10});
+
+        // Caching another answer drops the expired one.
+        static_cast<void>(resolver.resolve(valid_host, "http", hints, rt));
+        assert(resolver.size() == 1);
+    }
+
+    auto test_insert() -> void
+    {
+        const auto fake {std::make_shared<FakeService>()};
+        const auto resolver {std::make_shared<Resolver>(fake)};
+        const auto sr {run(ApiOptions {resolver}, RuntimeScope::shared)};
+        assert(sr->resolver() == resolver.get());
+        const OpenInputs oi {{valid_host, service}, hints, sr.get()};
+        SocketTemplateVector stv;
+        assert(!insert(std::back_inserter(stv), oi));
+        assert(!insert(std::back_inserter(stv), oi));
+        assert(stv.size() == 2);
+        assert(fake->count() == 1);
+        assert(resolver->hits() == 1);
+    }
+
+    auto test_negative(const Runtime* rt) -> void
+    {
+        const auto fake {std::make_shared<FakeService>()};
+        Resolver resolver {fake};
+
+        for (auto i {0}; i < 2; ++i) {
+            const auto result {resolver.resolve(invalid_host, service,
+                                                hints, rt)};
+            print(result);
+            assert(!result);
+            assert(result.error().string() == "Fake lookup failed");
+        }
+
+        assert(fake->count() == 1);
+        assert(resolver.hits() == 1);
+    }
+
+    auto test_positive(const Runtime* rt) -> void
+    {
+        const auto fake {std::make_shared<FakeService>()};
+        Resolver resolver {fake};
+
+        for (auto i {0}; i < 2; ++i) {
+            const auto result {resolver.resolve(valid_host, service,
+                                                hints, rt)};
+            print(result);
+            assert(result && result->size() == 1);
+        }
+
+        assert(fake->count() == 1);
+        assert(resolver.hits() == 1);
+        assert(resolver.misses() == 1);
+        assert(resolver.size() == 1);
+    }
+
+    auto test_zero_ttl(const Runtime* rt) -> void
+    {
+        const auto fake {std::make_shared<FakeService>()};
+        ResolverOptions options;
+        options.m_positive_ttl = std::chrono::seconds {0};
+        options.m_negative_ttl = std::chrono::seconds {0};
+        Resolver resolver {fake, options};
+        static_cast<void>(resolver.resolve(valid_host, service, hints, rt));
+        static_cast<void>(resolver.resolve(valid_host, service, hints, rt));
+        assert(fake->count() == 2);
+        assert(resolver.size() == 0);
+    }
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+        const auto* const rt {sr.get()};
+        test_addrinfo(rt);
+        test_capacity(rt);
+        test_clear(rt);
+        test_coalescing(rt);
+        test_expiry(rt);
+        test_insert();
+        test_negative(rt);
+        test_positive(rt);
+        test_zero_ttl(rt);
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
@@ -16,25 +16,33 @@
 #include "network/assert.hpp"           // assert()
 #include "network/network.hpp"          // ApiOptions, Error,
                                         // FailMode, Runtime,
-                                        // RuntimeScope, Version,
-                                        // get_runtime()
+                                        // RuntimeScope, SocketHints,
+                                        // SocketHost, Version,
+                                        // get_runtime(), insert(),
+                                        // run(), run_borrowed()
 #include "network/parse.hpp"            // parse()
 #include "network/quote.hpp"            // quote()
 #include "network/stop.hpp"             // stop()
 
 #ifdef _WIN32
-#include <winsock2.h>       // WSAEFAULT, WSAEPROCLIM,
-                            // WSANOTINITIALISED, WSASYSNOTREADY,
-                            // WSAVERNOTSUPPORTED
+#include <winsock2.h>       // AF_INET, SOCK_STREAM, WSAEFAULT,
+                            // WSAEPROCLIM, WSANOTINITIALISED,
+                            // WSASYSNOTREADY, WSAVERNOTSUPPORTED
+#else
+#include <sys/socket.h>     // AF_INET, SOCK_STREAM
 #endif
 
 #include <array>        // std::array
+#include <atomic>       // std::atomic
+#include <iterator>     // std::back_inserter()
 #include <cstdlib>      // EXIT_FAILURE, std::exit()
 #include <iostream>     // std::cerr, std::cout, std::endl
 #include <ostream>      // std::ostream
 #include <regex>        // std::regex, std::regex_match
 #include <string>       // std::string
 #include <string_view>  // std::string_view
+#include <thread>       // std::jthread
+#include <vector>       // std::vector
 
 namespace
 {
@@ -43,10 +51,18 @@ namespace
     using Network::FailMode;
     using Network::Runtime;
     using Network::RuntimeScope;
+    using Network::SocketHints;
+    using Network::SocketHost;
     using Network::Version;
     using Network::get_runtime;
+    using Network::insert;
     using Network::quote;
     using Network::parse;
+    using Network::run;
+    using Network::run_borrowed;
+
+    constexpr auto thread_count {8};
+    constexpr auto thread_iterations {10000};
 
 #ifdef _WIN32
     constexpr auto expected_code_stopped {WSANOTINITIALISED};
@@ -227,6 +243,50 @@ namespace
         test(*sr);
     }
 
+    auto test_concurrent() -> void
+    {
+        // Every thread races to start the stopped global runtime, and
+        // all of them must observe the same running instance.
+        const auto* const expected_rt {get_runtime(ApiOptions {}).get()};
+        assert(!expected_rt->is_running());
+        std::atomic<int> failures {0};
+
+        {
+            std::vector<std::jthread> threads;
+
+            for (auto i {0}; i < thread_count; ++i) {
+                threads.emplace_back([&] {
+                    for (auto j {0}; j < thread_iterations; ++j) {
+                        const auto* const rt {run_borrowed(is_verbose)};
+
+                        if (rt != expected_rt || !rt->is_running()) {
+                            ++failures;
+                        }
+                    }
+
+                    if (run(is_verbose).get() != expected_rt) {
+                        ++failures;
+                    }
+
+                    // Resolving through the global runtime borrows it
+                    // as well.
+                    const SocketHints hints {AF_INET, SOCK_STREAM};
+                    std::vector<SocketHost> hosts;
+
+                    if (insert(std::back_inserter(hosts), "127.0.0.1", {},
+                               hints, is_verbose) || hosts.empty()) {
+                        ++failures;
+                    }
+                });
+            }
+        }
+
+        assert(failures == 0);
+        assert(expected_rt->is_running());
+        assert(run(is_verbose)->stop() == 0);
+        assert(!expected_rt->is_running());
+    }
+
     auto test_inactive() -> void
     {
         std::string actual_str;
@@ -279,6 +339,7 @@ auto main(int argc, char* argv[]) -> int
         parse_arguments(argc, argv);
         test_versions(RuntimeScope::shared);
         test_versions(RuntimeScope::global);
+        test_concurrent();
         test_inactive();
     }
     catch (const Error& error) {
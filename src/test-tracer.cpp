@@ -0,0 +1,226 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/assert.hpp"           // assert()
+#include "network/network.hpp"          // ApiOptions, Error, IoMode,
+                                        // LogicError,
+                                        // RingTracer, RuntimeScope,
+                                        // SocketHints, StreamTracer,
+                                        // create_socketresult(),
+                                        // is_tracing, run(), trace()
+#include "network/parse.hpp"            // parse()
+
+#ifdef _WIN32
+#include <winsock2.h>       // AF_INET, SOCK_STREAM
+#else
+#include <sys/socket.h>     // AF_INET, SOCK_STREAM
+#endif
+
+#include <algorithm>    // std::count()
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <iostream>     // std::cerr, std::cout, std::endl
+#include <memory>       // std::make_shared()
+#include <ostream>      // std::ostream
+#include <sstream>      // std::ostringstream
+#include <string>       // std::string, std::to_string()
+#include <thread>       // std::jthread
+#include <vector>       // std::vector
+
+namespace
+{
+    using Network::ApiOptions;
+    using Network::Error;
+    using Network::IoMode;
+    using Network::LogicError;
+    using Network::RingTracer;
+    using Network::RuntimeScope;
+    using Network::SocketHints;
+    using Network::StreamTracer;
+    using Network::create_socketresult;
+    using Network::is_tracing;
+    using Network::parse;
+    using Network::run;
+    using Network::trace;
+
+    constexpr auto line_count {100};
+    constexpr auto thread_count {4};
+
+    auto is_verbose {false};  // NOLINT
+
+    auto count_lines(const std::string& str) -> std::size_t
+    {
+        return static_cast<std::size_t>(std::count(str.begin(),
+                                                   str.end(),
+                                                   '\n'));
+    }
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto print(const std::string& str) -> void
+    {
+        if (is_verbose) {
+            std::cout << str;
+        }
+    }
+
+    auto test_ring_tracer() -> void
+    {
+        std::ostringstream oss;
+        RingTracer tracer {oss, 4};
+        assert(tracer.capacity() == 4);
+        tracer.trace("one");
+        tracer.trace("two");
+        tracer.flush();
+        tracer.trace("three");
+        tracer.flush();
+        print(oss.str());
+        assert(oss.str() == "one\ntwo\nthree\n");
+        assert(tracer.dropped() == 0);
+    }
+
+    auto test_ring_tracer_threads() -> void
+    {
+        std::ostringstream oss;
+        RingTracer tracer {oss, 16};
+
+        {
+            std::vector<std::jthread> threads;
+
+            for (auto i {0}; i < thread_count; ++i) {
+                threads.emplace_back([&tracer, i]() {
+                    // Call the tracer directly, as trace() does
+                    // nothing when tracing is compiled out.
+                    for (auto j {0}; j < line_count; ++j) {
+                        tracer.trace("Thread " + std::to_string(i) +
+                                     " line " + std::to_string(j));
+                    }
+                });
+            }
+        }
+
+        tracer.flush();
+        const auto count {count_lines(oss.str())};
+        assert(count + tracer.dropped() == thread_count * line_count);
+    }
+
+    auto test_ring_tracer_zero() -> void
+    {
+        std::string actual_error_str;
+
+        try {
+            std::ostringstream oss;
+            const RingTracer tracer {oss, 0};
+            static_cast<void>(tracer);
+        }
+        catch (const LogicError& error) {
+            actual_error_str = error.what();
+        }
+
+        assert(actual_error_str == "Zero ring capacity");
+    }
+
+    auto test_runtime_tracer() -> void
+    {
+        std::ostringstream oss;
+        const auto tracer {std::make_shared<RingTracer>(oss)};
+        const auto sr {run(ApiOptions {tracer}, RuntimeScope::shared)};
+        assert(sr->is_verbose());
+        assert(sr->tracer() == tracer.get());
+        const SocketHints hints {AF_INET, SOCK_STREAM, 0};
+        const auto result {create_socketresult(hints, sr.get())};
+        assert(result);
+        tracer->flush();
+        print(oss.str());
+
+        if constexpr (is_tracing) {
+            assert(oss.str().find("Calling ::socket(") != std::string::npos);
+        }
+        else {
+            assert(oss.str().empty());
+        }
+    }
+
+    auto test_runtime_combined() -> void
+    {
+        std::ostringstream oss;
+        const auto tracer {std::make_shared<RingTracer>(oss)};
+        const auto ao {
+            ApiOptions {}.set_io_mode(IoMode::io_uring).set_tracer(tracer)
+        };
+        const auto sr {run(ao, RuntimeScope::shared)};
+        assert(sr->io_mode() == IoMode::io_uring);
+        assert(sr->tracer() == tracer.get());
+    }
+
+    auto test_runtime_untraced() -> void
+    {
+        const auto sr {run(ApiOptions {false}, RuntimeScope::shared)};
+        assert(!sr->is_verbose());
+        assert(sr->tracer() == nullptr);
+    }
+
+    auto test_stream_tracer() -> void
+    {
+        std::ostringstream oss;
+        StreamTracer tracer {oss};
+        trace(&tracer, [](std::ostream& os) {
+            os << "Calling " << "::socket()";
+        });
+        trace(nullptr, [](std::ostream& os) {
+            os << "Not traced";
+        });
+
+        if constexpr (is_tracing) {
+            assert(oss.str() == "Calling ::socket()\n");
+        }
+        else {
+            assert(oss.str().empty());
+        }
+    }
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        test_ring_tracer();
+        test_ring_tracer_threads();
+        test_ring_tracer_zero();
+        test_runtime_combined();
+        test_runtime_tracer();
+        test_runtime_untraced();
+        test_stream_tracer();
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
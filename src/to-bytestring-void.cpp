@@ -14,14 +14,15 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "network/to-bytestring-void.hpp"       // to_bytestring()
-#include "network/bytestring.hpp"               // ByteString
+#include "network/bytespan.hpp"                 // ByteSpan
 #include "network/length-type.hpp"              // length_type
+#include "network/sockaddrstorage.hpp"          // SockAddrStorage
 
 #include <cstddef>      // std::byte
-#include <span>         // std::span
 
-auto Network::to_bytestring(const void* data, length_type size) -> ByteString
+auto Network::to_bytestring(const void* data,
+                            length_type size) -> SockAddrStorage
 {
-    const std::span span {static_cast<const std::byte*>(data), size};
-    return {span.begin(), span.end()};
+    return SockAddrStorage {ByteSpan {static_cast<const std::byte*>(data),
+                                      size}};
 }
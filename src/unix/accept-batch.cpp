@@ -0,0 +1,114 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/accept-batch.hpp"     // accept_batch()
+
+#ifdef HAVE_ACCEPT4
+
+#include "network/acceptbatch.hpp"      // AcceptBatch
+#include "network/get-api-error.hpp"    // get_api_error()
+#include "network/handle-null.hpp"      // handle_null
+#include "network/iocounter.hpp"        // IoCounter
+#include "network/iolatency.hpp"        // IoLatency
+#include "network/oserror.hpp"          // OsError
+#include "network/reset-api-error.hpp"  // reset_api_error()
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/systemcall.hpp"       // SystemCall
+#include "network/to-os-error.hpp"      // to_os_error()
+#include "network/trace.hpp"            // trace()
+
+#include <sys/socket.h>     // SOCK_CLOEXEC, SOCK_NONBLOCK, ::accept4()
+
+#include <cerrno>       // EAGAIN, ECONNABORTED, EINTR, EWOULDBLOCK
+#include <ostream>      // std::ostream
+
+auto Network::accept_batch(const SocketCore& sc,
+                           AcceptBatch& batch) -> OsError
+{
+    constexpr auto flags {SOCK_NONBLOCK | SOCK_CLOEXEC};
+    const auto handle_1 {sc.handle()};
+    auto* const tracer {sc.tracer()};
+    batch.clear();
+
+    while (!batch.is_full()) {
+        const auto [sa, sa_length] {batch.slot()};
+
+        trace(tracer, [&](std::ostream& os) {
+            // clang-format off
+            os << "Calling ::accept4("
+               << handle_1
+               << ", ..., "
+               << *sa_length
+               << ", SOCK_NONBLOCK | SOCK_CLOEXEC)";
+            // clang-format on
+        });
+
+        sc.count(IoCounter::system_calls);
+        reset_api_error();
+        const auto start {sc.now()};
+        const auto handle_2 {::accept4(handle_1, sa, sa_length, flags)};
+
+        // Only a call that accepted a connection or failed outright is
+        // timed.  One that found the backlog empty or was interrupted
+        // did no accept, and on a blocking listener may have waited.
+        if (handle_2 != handle_null) {
+            sc.record(IoLatency::accept, start);
+            sc.count(IoCounter::accepts);
+            batch.push(handle_2);
+            continue;
+        }
+
+        const auto api_error {get_api_error()};
+
+        // Running out of connections ends every batch, and an aborted
+        // or interrupted accept is retried, so neither is an error.
+        switch (api_error) {
+        case EAGAIN:
+#if EWOULDBLOCK != EAGAIN
+        case EWOULDBLOCK:
+#endif
+            sc.count(IoCounter::again);
+            return {};
+        case ECONNABORTED:
+        case EINTR:
+            continue;
+        default:
+            break;
+        }
+
+        sc.record(IoLatency::accept, start);
+        const auto os_error {to_os_error(api_error)};
+        sc.count_error(os_error);
+
+        const SystemCall call {
+            .m_name = "::accept4",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", ..., "
+                   << t_call.m_values[0]
+                   << ", SOCK_NONBLOCK | SOCK_CLOEXEC";
+                // clang-format on
+            },
+            .m_values = {*sa_length},
+            .m_handle = handle_1,
+        };
+        return {os_error, api_error, call};
+    }
+
+    return {};
+}
+
+#endif
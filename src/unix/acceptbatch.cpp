@@ -0,0 +1,100 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/acceptbatch.hpp"      // AcceptBatch
+
+#ifdef HAVE_ACCEPT4
+
+#include "network/bytespan.hpp"         // ByteSpan
+#include "network/handle-null.hpp"      // handle_null
+#include "network/handle-type.hpp"      // handle_type
+#include "network/logicerror.hpp"       // LogicError
+
+#include <sys/socket.h>     // sockaddr, sockaddr_storage, socklen_t
+
+#include <cstddef>      // std::size_t
+#include <span>         // std::as_bytes(), std::span
+
+Network::AcceptBatch::AcceptBatch(std::size_t t_capacity) :
+    m_handles(t_capacity, handle_null),
+    m_lengths(t_capacity),
+    m_names(t_capacity)
+{
+    if (t_capacity == 0) {
+        throw LogicError {"Zero batch capacity"};
+    }
+}
+
+auto Network::AcceptBatch::capacity() const noexcept -> std::size_t
+{
+    return m_handles.size();
+}
+
+auto Network::AcceptBatch::handle(std::size_t t_index) const -> handle_type
+{
+    if (t_index >= m_size) {
+        throw LogicError {"Batch index out of range"};
+    }
+
+    return m_handles[t_index];
+}
+
+auto Network::AcceptBatch::is_full() const noexcept -> bool
+{
+    return m_size == m_handles.size();
+}
+
+auto Network::AcceptBatch::peer(std::size_t t_index) const -> ByteSpan
+{
+    if (t_index >= m_size) {
+        throw LogicError {"Batch index out of range"};
+    }
+
+    const auto& name {m_names[t_index]};
+    return std::as_bytes(std::span {&name, 1}).first(m_lengths[t_index]);
+}
+
+auto Network::AcceptBatch::size() const noexcept -> std::size_t
+{
+    return m_size;
+}
+
+auto Network::AcceptBatch::clear() noexcept -> void
+{
+    m_size = 0;
+}
+
+auto Network::AcceptBatch::push(handle_type t_handle) -> void
+{
+    if (is_full()) {
+        throw LogicError {"Batch is full"};
+    }
+
+    m_handles[m_size++] = t_handle;
+}
+
+auto Network::AcceptBatch::slot() -> slot_type
+{
+    if (is_full()) {
+        throw LogicError {"Batch is full"};
+    }
+
+    auto& length {m_lengths[m_size]};
+    length = sizeof(sockaddr_storage);
+    void* pointer {&m_names[m_size]};
+    return {static_cast<sockaddr*>(pointer), &length};
+}
+
+#endif
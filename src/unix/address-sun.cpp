@@ -22,7 +22,7 @@
 
 auto Network::Address::sun_text() const -> std::string_view
 {
-    return to_path(m_span);
+    return to_path(m_addr);
 }
 
 #endif
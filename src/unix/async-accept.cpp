@@ -0,0 +1,56 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/async-accept.hpp"     // async_accept()
+
+#ifdef HAVE_EPOLL
+
+#include "network/accept-result.hpp"            // accept_result()
+#include "network/acceptdata.hpp"               // AcceptData
+#include "network/error.hpp"                    // Error
+#include "network/eventawaiter.hpp"             // EventAwaiter
+#include "network/eventloop.hpp"                // EventLoop
+#include "network/is-again.hpp"                 // is_again()
+#include "network/socketcore.hpp"               // SocketCore
+#include "network/task.hpp"                     // Task
+
+#include <utility>      // std::move()
+
+auto Network::async_accept(EventLoop& loop,
+                           SocketCore sc) -> Task<AcceptData>
+{
+    while (true) {
+        auto result {accept_result(sc)};
+
+        if (result) {
+            co_return std::move(*result);
+        }
+
+        // A handle that has hung up will not become ready again.
+        if (!is_again(result.error().number()) ||
+            loop.is_hung_up(sc.handle())) {
+            throw Error {result.error()};
+        }
+
+        if (const auto error {
+                co_await EventAwaiter {loop, sc.handle(),
+                                       EventLoop::events_read}
+            }) {
+            throw Error {error};
+        }
+    }
+}
+
+#endif
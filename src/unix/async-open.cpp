@@ -0,0 +1,121 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/async-open.hpp"               // async_open()
+
+#ifdef HAVE_EPOLL
+
+#include "network/bytespan.hpp"                 // ByteSpan
+#include "network/eventawaiter.hpp"             // EventAwaiter
+#include "network/eventloop.hpp"                // EventLoop
+#include "network/get-api-error.hpp"            // get_api_error()
+#include "network/get-openhandler.hpp"          // get_openhandler()
+#include "network/iocounter.hpp"                // IoCounter
+#include "network/iolatency.hpp"                // IoLatency
+#include "network/open-handle.hpp"              // open()
+#include "network/opensymbol.hpp"               // OpenSymbol
+#include "network/oserror.hpp"                  // OsError
+#include "network/reset-api-error.hpp"          // reset_api_error()
+#include "network/socket-error.hpp"             // socket_error
+#include "network/socketcore.hpp"               // SocketCore
+#include "network/systemcall.hpp"               // SystemCall
+#include "network/task.hpp"                     // Task
+#include "network/to-os-error.hpp"              // to_os_error()
+#include "network/to-string-bytespan.hpp"       // to_string()
+#include "network/trace.hpp"                    // trace()
+
+#include <sys/socket.h>     // SOL_SOCKET, SO_ERROR, socklen_t,
+                            // ::getsockopt()
+
+#include <cerrno>       // EINPROGRESS
+#include <ostream>      // std::ostream
+
+namespace
+{
+    auto get_so_error(const Network::SocketCore& sc) -> int
+    {
+        const auto handle {sc.handle()};
+        int so_error {0};
+        socklen_t so_length {sizeof so_error};
+
+        trace(sc.tracer(), [&](std::ostream& os) {
+            // clang-format off
+            os << "Calling ::getsockopt("
+               << handle
+               << ", SOL_SOCKET, SO_ERROR, ...)";
+            // clang-format on
+        });
+
+        sc.count(Network::IoCounter::system_calls);
+        Network::reset_api_error();
+
+        if (::getsockopt(handle, SOL_SOCKET, SO_ERROR,
+                         &so_error, &so_length) == Network::socket_error) {
+            return Network::get_api_error();
+        }
+
+        return so_error;
+    }
+}
+
+auto Network::async_open(EventLoop& loop,
+                         SocketCore sc,
+                         ByteSpan bs,
+                         OpenSymbol symbol) -> Task<OsError>
+{
+    const auto start {sc.now()};
+    auto error {open(sc, bs, symbol)};
+
+    // Anything but a connect in progress has been counted and timed
+    // by open().
+    if (error.number() != EINPROGRESS) {
+        co_return error;
+    }
+
+    // A non-blocking connect completes once the socket is writable.
+    if (auto wait_error {
+            co_await EventAwaiter {loop, sc.handle(), EventLoop::events_write}
+        }) {
+        co_return wait_error;
+    }
+
+    const auto api_error {get_so_error(sc)};
+    sc.record(IoLatency::connect, start);
+
+    if (api_error == 0) {
+        sc.count(IoCounter::connects);
+        co_return OsError {};
+    }
+
+    const auto os_error {to_os_error(api_error)};
+    sc.count_error(os_error);
+    const SystemCall call {
+        .m_name = get_openhandler(symbol).string(),
+        .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+            // clang-format off
+            os << t_call.m_handle
+               << ", "
+               << to_string(t_call.m_address)
+               << ", "
+               << t_call.m_address.size();
+            // clang-format on
+        },
+        .m_address = bs,
+        .m_handle = sc.handle(),
+    };
+    co_return OsError {os_error, api_error, call};
+}
+
+#endif
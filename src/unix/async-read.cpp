@@ -0,0 +1,57 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/async-read.hpp"       // async_read()
+
+#ifdef HAVE_EPOLL
+
+#include "network/charspan.hpp"         // CharSpan
+#include "network/error.hpp"            // Error
+#include "network/eventawaiter.hpp"     // EventAwaiter
+#include "network/eventloop.hpp"        // EventLoop
+#include "network/is-again.hpp"         // is_again()
+#include "network/read-result.hpp"      // read_result()
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/task.hpp"             // Task
+
+#include <sys/types.h>      // ssize_t
+
+auto Network::async_read(EventLoop& loop,
+                         SocketCore sc,
+                         CharSpan cs) -> Task<ssize_t>
+{
+    while (true) {
+        const auto result {read_result(sc, cs)};
+
+        if (result) {
+            co_return *result;
+        }
+
+        // A handle that has hung up will not become ready again.
+        if (!is_again(result.error().number()) ||
+            loop.is_hung_up(sc.handle())) {
+            throw Error {result.error()};
+        }
+
+        if (const auto error {
+                co_await EventAwaiter {loop, sc.handle(),
+                                       EventLoop::events_read}
+            }) {
+            throw Error {error};
+        }
+    }
+}
+
+#endif
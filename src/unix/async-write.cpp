@@ -0,0 +1,58 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/async-write.hpp"      // async_write()
+
+#ifdef HAVE_EPOLL
+
+#include "network/error.hpp"            // Error
+#include "network/eventawaiter.hpp"     // EventAwaiter
+#include "network/eventloop.hpp"        // EventLoop
+#include "network/is-again.hpp"         // is_again()
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/task.hpp"             // Task
+#include "network/write-result.hpp"     // write_result()
+
+#include <sys/types.h>      // ssize_t
+
+#include <string_view>  // std::string_view
+
+auto Network::async_write(EventLoop& loop,
+                          SocketCore sc,
+                          std::string_view sv) -> Task<ssize_t>
+{
+    while (true) {
+        const auto result {write_result(sc, sv)};
+
+        if (result) {
+            co_return *result;
+        }
+
+        // A handle that has hung up will not become ready again.
+        if (!is_again(result.error().number()) ||
+            loop.is_hung_up(sc.handle())) {
+            throw Error {result.error()};
+        }
+
+        if (const auto error {
+                co_await EventAwaiter {loop, sc.handle(),
+                                       EventLoop::events_write}
+            }) {
+            throw Error {error};
+        }
+    }
+}
+
+#endif
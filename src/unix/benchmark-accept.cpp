@@ -0,0 +1,378 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/namesymbol.hpp"       // NameSymbol
+#include "network/network.hpp"          // BasicSocket, ByteSpan,
+                                        // ByteString, Error,
+                                        // SharedRuntime, SockAddrStorage,
+                                        // SocketCore, SocketHints,
+                                        // SocketSlab, Symbol,
+                                        // UniqueSocket, accept(),
+                                        // create_socket(), get_name(),
+                                        // handle_null, handle_type,
+                                        // run(), to_bytestring()
+#include "network/opensymbol.hpp"       // OpenSymbol
+#include "network/parse.hpp"            // parse()
+#include "network/socketdata.hpp"       // SocketData
+
+#include <arpa/inet.h>      // htonl()
+#include <netinet/in.h>     // INADDR_LOOPBACK, sockaddr_in
+#include <sys/socket.h>     // AF_INET, SOCK_STREAM, ::socket()
+
+#include <algorithm>    // std::ranges::sort()
+#include <atomic>       // std::atomic
+#include <chrono>       // std::chrono::duration,
+                        // std::chrono::steady_clock
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit(), std::free(),
+                        // std::malloc()
+#include <iostream>     // std::cerr, std::cout, std::endl
+#include <map>          // std::map
+#include <new>          // std::bad_alloc
+#include <string>       // std::string
+#include <vector>       // std::vector
+
+namespace
+{
+    using Network::BasicSocket;
+    using Network::ByteSpan;
+    using Network::ByteString;
+    using Network::Error;
+    using Network::NameSymbol;
+    using Network::OpenSymbol;
+    using Network::SharedRuntime;
+    using Network::SockAddrStorage;
+    using Network::SocketCore;
+    using Network::SocketData;
+    using Network::SocketHints;
+    using Network::SocketSlab;
+    using Network::Symbol;
+    using Network::UniqueSocket;
+    using Network::accept;
+    using Network::create_socket;
+    using Network::get_name;
+    using Network::handle_null;
+    using Network::handle_type;
+    using Network::parse;
+    using Network::run;
+    using Network::to_bytestring;
+
+    using Clock = std::chrono::steady_clock;
+    using Microseconds = std::chrono::duration<double, std::micro>;
+
+    constexpr std::size_t batch_size {64};
+    constexpr std::size_t connection_count {1024};
+    constexpr std::size_t percentile {99};
+
+    std::atomic<std::size_t> allocations {0};  // NOLINT
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto connect_batch(const SharedRuntime& sr,
+                       const SockAddrStorage& listener_name) ->
+        std::vector<UniqueSocket>
+    {
+        const SocketHints hints {AF_INET, SOCK_STREAM, 0};
+        std::vector<UniqueSocket> clients;
+        clients.reserve(batch_size);
+
+        for (std::size_t j {0}; j < batch_size; ++j) {
+            auto& client {clients.emplace_back(create_socket(hints,
+                                                             sr.get()))};
+
+            if (const auto error {client->open(listener_name,
+                                               OpenSymbol::connect)}) {
+                throw Error {error.string()};
+            }
+        }
+
+        return clients;
+    }
+
+    auto listen_loopback(const SharedRuntime& sr) -> UniqueSocket
+    {
+        const SocketHints hints {AF_INET, SOCK_STREAM, 0};
+        auto socket {create_socket(hints, sr.get())};
+        sockaddr_in sin {};
+        sin.sin_family = AF_INET;
+        sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        const auto bs {to_bytestring(&sin, sizeof sin)};
+
+        if (const auto error {socket->open(bs, OpenSymbol::bind)}) {
+            throw Error {error.string()};
+        }
+
+        if (const auto error {socket->listen(2 * batch_size)}) {
+            throw Error {error.string()};
+        }
+
+        return socket;
+    }
+
+    auto print(const std::string& label,
+               std::size_t count,
+               std::size_t calls,
+               const std::string& call = "accept") -> void
+    {
+        std::cout << label
+                  << ": "
+                  << static_cast<double>(count) /
+                     static_cast<double>(calls)
+                  << " allocations/"
+                  << call
+                  << std::endl;
+    }
+
+    auto print(const std::string& label,
+               std::size_t count,
+               std::vector<Clock::duration>& latencies) -> void
+    {
+        std::ranges::sort(latencies);
+        const auto index {latencies.size() * percentile / 100};
+        const Microseconds latency {latencies.at(index)};
+        std::cout << label
+                  << ": "
+                  << static_cast<double>(count) /
+                     static_cast<double>(connection_count)
+                  << " allocations/accept, p"
+                  << percentile
+                  << " "
+                  << latency.count()
+                  << " us/accept"
+                  << std::endl;
+    }
+
+    // Accept connections and cache each peer's name, counting heap
+    // allocations made by the library, by a std::map<Symbol,
+    // ByteString> name cache, as SocketData used before, and by the
+    // SocketData and BasicSocket constructed from each connection's
+    // AcceptData.
+    auto benchmark_accept(const SharedRuntime& sr) -> void
+    {
+        const auto listener {listen_loopback(sr)};
+        const SocketCore sc {static_cast<handle_type>(*listener),
+                             AF_INET, sr.get()};
+        const auto listener_name {get_name(sc, NameSymbol::getsockname)};
+        std::size_t accept_count {0};
+        std::size_t map_count {0};
+        std::size_t data_count {0};
+        std::size_t basic_count {0};
+        const auto accept_total {connection_count / 2};
+
+        for (std::size_t i {0}; i < connection_count; i += 2 * batch_size) {
+            const auto clients {connect_batch(sr, listener_name)};
+            const auto more_clients {connect_batch(sr, listener_name)};
+            std::vector<UniqueSocket> servers;
+            servers.reserve(batch_size);
+
+            for (std::size_t j {0}; j < batch_size; ++j) {
+                auto start {allocations.load()};
+                auto& server {servers.emplace_back(accept(*listener))};
+                static_cast<void>(server->get_name(Symbol::accept));
+                static_cast<void>(server->get_name(Symbol::getpeername));
+                accept_count += allocations.load() - start;
+                const auto peer {server->get_name(Symbol::accept)};
+
+                start = allocations.load();
+                std::map<Symbol, ByteString> map_cache;
+                map_cache[Symbol::accept].assign(peer.begin(), peer.end());
+                map_cache[Symbol::getpeername].assign(peer.begin(),
+                                                      peer.end());
+                map_count += allocations.load() - start;
+
+                const auto ad {listener->accept()};
+
+                start = allocations.load();
+                const SocketData sd {ad};
+                static_cast<void>(sd.name(Symbol::accept));
+                data_count += allocations.load() - start;
+
+                start = allocations.load();
+                const BasicSocket<AF_INET> socket {ad};
+                static_cast<void>(socket.get_name(Symbol::accept));
+                basic_count += allocations.load() - start;
+            }
+        }
+
+        print("accept and get_name", accept_count, accept_total);
+        print("std::map name cache", map_count, accept_total);
+        print("SocketData from accept", data_count, accept_total);
+        print("BasicSocket from accept", basic_count, accept_total);
+    }
+
+    auto open_socket(const SharedRuntime& sr,
+                     ByteSpan bs,
+                     OpenSymbol symbol,
+                     std::size_t& count) -> BasicSocket<AF_INET>
+    {
+        const auto handle {::socket(AF_INET, SOCK_STREAM, 0)};
+
+        if (handle == handle_null) {
+            throw Error {"Unable to create socket"};
+        }
+
+        BasicSocket<AF_INET> socket {handle, sr.get()};
+        const auto start {allocations.load()};
+
+        if (const auto error {socket.open(bs, symbol)}) {
+            throw Error {error};
+        }
+
+        static_cast<void>(socket.get_name(symbol == OpenSymbol::bind ?
+                                          Symbol::bind :
+                                          Symbol::connect));
+        count += allocations.load() - start;
+        return socket;
+    }
+
+    // Bind and connect sockets held by value, counting heap
+    // allocations made by each open and by caching its name.
+    auto benchmark_open(const SharedRuntime& sr) -> void
+    {
+        const auto listener {listen_loopback(sr)};
+        const SocketCore sc {static_cast<handle_type>(*listener),
+                             AF_INET, sr.get()};
+        const auto listener_name {get_name(sc, NameSymbol::getsockname)};
+        sockaddr_in sin {};
+        sin.sin_family = AF_INET;
+        sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        const auto loopback {to_bytestring(&sin, sizeof sin)};
+        std::size_t bind_count {0};
+        std::size_t connect_count {0};
+
+        for (std::size_t i {0}; i < connection_count; i += batch_size) {
+            std::vector<BasicSocket<AF_INET>> sockets;
+            sockets.reserve(2 * batch_size);
+
+            for (std::size_t j {0}; j < batch_size; ++j) {
+                sockets.push_back(open_socket(sr, loopback,
+                                              OpenSymbol::bind,
+                                              bind_count));
+                sockets.push_back(open_socket(sr, listener_name,
+                                              OpenSymbol::connect,
+                                              connect_count));
+            }
+
+            for (std::size_t j {0}; j < batch_size; ++j) {
+                static_cast<void>(accept(*listener));
+            }
+        }
+
+        print("BasicSocket bind", bind_count, connection_count, "open");
+        print("BasicSocket connect", connect_count, connection_count,
+              "open");
+    }
+
+    // Accept connections into heap-allocated sockets and into sockets
+    // carved from a SocketSlab, counting heap allocations and timing
+    // each accept.  The slab is reused across batches, so after the
+    // first batch it allocates nothing.
+    auto benchmark_slab(const SharedRuntime& sr) -> void
+    {
+        const auto listener {listen_loopback(sr)};
+        const SocketCore sc {static_cast<handle_type>(*listener),
+                             AF_INET, sr.get()};
+        const auto listener_name {get_name(sc, NameSymbol::getsockname)};
+        SocketSlab slab;
+        std::size_t heap_count {0};
+        std::size_t slab_count {0};
+        std::vector<Clock::duration> heap_latencies;
+        std::vector<Clock::duration> slab_latencies;
+        heap_latencies.reserve(connection_count);
+        slab_latencies.reserve(connection_count);
+
+        for (std::size_t i {0}; i < connection_count; i += batch_size) {
+            const auto heap_clients {connect_batch(sr, listener_name)};
+            const auto slab_clients {connect_batch(sr, listener_name)};
+            std::vector<UniqueSocket> servers;
+            servers.reserve(2 * batch_size);
+
+            for (std::size_t j {0}; j < batch_size; ++j) {
+                auto start {allocations.load()};
+                auto time {Clock::now()};
+                servers.emplace_back(accept(*listener));
+                heap_latencies.push_back(Clock::now() - time);
+                heap_count += allocations.load() - start;
+
+                start = allocations.load();
+                time = Clock::now();
+                servers.emplace_back(accept(*listener, slab));
+                slab_latencies.push_back(Clock::now() - time);
+                slab_count += allocations.load() - start;
+            }
+        }
+
+        print("accept into heap", heap_count, heap_latencies);
+        print("accept into slab", slab_count, slab_latencies);
+    }
+}
+
+auto operator new(std::size_t size) -> void*
+{
+    ++allocations;
+
+    if (auto* const pointer {std::malloc(size)}) {  // NOLINT
+        return pointer;
+    }
+
+    throw std::bad_alloc {};
+}
+
+auto operator delete(void* pointer) noexcept -> void
+{
+    std::free(pointer);  // NOLINT
+}
+
+auto operator delete(void* pointer, std::size_t size) noexcept -> void
+{
+    static_cast<void>(size);
+    std::free(pointer);  // NOLINT
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+        benchmark_accept(sr);
+        benchmark_open(sr);
+        benchmark_slab(sr);
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
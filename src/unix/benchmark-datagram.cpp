@@ -0,0 +1,214 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/namesymbol.hpp"       // NameSymbol
+#include "network/network.hpp"          // DatagramBatch, Error,
+                                        // SharedRuntime,
+                                        // SocketCore, SocketHints,
+                                        // UniqueSocket, create_socket(),
+                                        // get_name(), handle_type,
+                                        // receive_batch(),
+                                        // receive_from(), run(),
+                                        // send_batch(), send_to(),
+                                        // to_bytestring()
+#include "network/opensymbol.hpp"       // OpenSymbol
+#include "network/os-features.hpp"      // HAVE_RECVMMSG
+#include "network/parse.hpp"            // parse()
+
+#include <arpa/inet.h>      // htonl()
+#include <netinet/in.h>     // INADDR_LOOPBACK, sockaddr_in
+#include <sys/socket.h>     // AF_INET, MSG_WAITFORONE, SOCK_DGRAM
+
+#include <chrono>       // std::chrono::duration,
+                        // std::chrono::steady_clock
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <iostream>     // std::cerr, std::cout, std::endl
+#include <string>       // std::string
+#include <vector>       // std::vector
+
+namespace
+{
+    using Network::ByteString;
+    using Network::CharSpan;
+    using Network::Error;
+    using Network::NameSymbol;
+    using Network::OpenSymbol;
+    using Network::SharedRuntime;
+    using Network::SocketCore;
+    using Network::SocketHints;
+    using Network::UniqueSocket;
+    using Network::create_socket;
+    using Network::get_name;
+    using Network::handle_type;
+    using Network::parse;
+    using Network::receive_from;
+    using Network::run;
+    using Network::send_to;
+    using Network::to_bytestring;
+#ifdef HAVE_RECVMMSG
+    using Network::DatagramBatch;
+    using Network::receive_batch;
+    using Network::send_batch;
+#endif
+
+    using Clock = std::chrono::steady_clock;
+    using Seconds = std::chrono::duration<double>;
+
+    constexpr std::size_t batch_size_max {64};
+    constexpr std::size_t packet_count {1UZ << 16U};
+    constexpr std::size_t packet_size {64};
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto bind_loopback(const SharedRuntime& sr) -> UniqueSocket
+    {
+        const SocketHints hints {AF_INET, SOCK_DGRAM, 0};
+        auto socket {create_socket(hints, sr.get())};
+        sockaddr_in sin {};
+        sin.sin_family = AF_INET;
+        sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        const auto bs {to_bytestring(&sin, sizeof sin)};
+
+        if (const auto error {socket->open(bs, OpenSymbol::bind)}) {
+            throw Error {error.string()};
+        }
+
+        return socket;
+    }
+
+    auto get_core(const UniqueSocket& socket,
+                  const SharedRuntime& sr) -> SocketCore
+    {
+        return {static_cast<handle_type>(*socket), AF_INET, sr.get()};
+    }
+
+    auto print(const std::string& label,
+               std::size_t count,
+               Seconds elapsed) -> void
+    {
+        std::cout << label
+                  << ": "
+                  << static_cast<double>(count) / elapsed.count()
+                  << " packets/s"
+                  << std::endl;
+    }
+
+    auto benchmark_single(const SharedRuntime& sr) -> void
+    {
+        const auto receiver {bind_loopback(sr)};
+        const auto sender {bind_loopback(sr)};
+        const auto receiver_sc {get_core(receiver, sr)};
+        const auto sender_sc {get_core(sender, sr)};
+        const auto peer {get_name(receiver_sc, NameSymbol::getsockname)};
+        std::vector<char> buffer(packet_size);
+        const std::string packet(packet_size, 'x');
+        const auto start {Clock::now()};
+
+        for (std::size_t i {0}; i < packet_count; ++i) {
+            static_cast<void>(send_to(sender_sc, packet, peer));
+            static_cast<void>(receive_from(receiver_sc, buffer));
+        }
+
+        print("sendto/recvfrom", packet_count, Clock::now() - start);
+    }
+
+#ifdef HAVE_RECVMMSG
+    auto benchmark_batch(const SharedRuntime& sr,
+                         std::size_t batch_size) -> void
+    {
+        const auto receiver {bind_loopback(sr)};
+        const auto sender {bind_loopback(sr)};
+        const auto receiver_sc {get_core(receiver, sr)};
+        const auto sender_sc {get_core(sender, sr)};
+        const auto peer {get_name(receiver_sc, NameSymbol::getsockname)};
+        std::vector<char> input(batch_size * packet_size);
+        std::vector<char> output(batch_size * packet_size, 'x');
+        std::vector<CharSpan> input_spans;
+        std::vector<CharSpan> output_spans;
+
+        for (std::size_t i {0}; i < batch_size; ++i) {
+            const auto offset {i * packet_size};
+            input_spans.emplace_back(input.data() + offset, packet_size);
+            output_spans.emplace_back(output.data() + offset, packet_size);
+        }
+
+        DatagramBatch in_batch {input_spans};
+        DatagramBatch out_batch {output_spans};
+
+        for (std::size_t i {0}; i < batch_size; ++i) {
+            out_batch.prepare(i, packet_size, peer);
+        }
+
+        const auto start {Clock::now()};
+        std::size_t sent {0};
+
+        // A batch can be sent short, so count only the packets the
+        // kernel accepted.
+        while (sent < packet_count) {
+            const auto count {send_batch(sender_sc, out_batch, batch_size)};
+
+            for (std::size_t received {0}; received < count;) {
+                received += receive_batch(receiver_sc, in_batch,
+                                          MSG_WAITFORONE);
+            }
+
+            sent += count;
+        }
+
+        print("sendmmsg/recvmmsg batch " + std::to_string(batch_size),
+              sent, Clock::now() - start);
+    }
+#endif
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+        benchmark_single(sr);
+#ifdef HAVE_RECVMMSG
+        for (std::size_t size {1}; size <= batch_size_max; size *= 2) {
+            benchmark_batch(sr, size);
+        }
+#endif
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
@@ -0,0 +1,158 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/namesymbol.hpp"       // NameSymbol
+#include "network/network.hpp"          // Error, SharedRuntime,
+                                        // SocketCore, SocketHints,
+                                        // TextBuffer, close(),
+                                        // create_socketpair(),
+                                        // get_nameresult(),
+                                        // handle_type, run()
+#include "network/parse.hpp"            // parse()
+
+#include <sys/socket.h>     // AF_INET, AF_UNIX, SOCK_STREAM
+
+#include <chrono>       // std::chrono::duration,
+                        // std::chrono::steady_clock
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <functional>   // std::function
+#include <iostream>     // std::cerr, std::cout, std::endl
+#include <string_view>  // std::string_view
+
+namespace
+{
+    using Network::Error;
+    using Network::NameSymbol;
+    using Network::SharedRuntime;
+    using Network::SocketCore;
+    using Network::SocketHints;
+    using Network::TextBuffer;
+    using Network::close;
+    using Network::create_socketpair;
+    using Network::get_nameresult;
+    using Network::handle_type;
+    using Network::parse;
+    using Network::run;
+
+    using Clock = std::chrono::steady_clock;
+    using Nanoseconds = std::chrono::duration<double, std::nano>;
+
+    constexpr std::size_t error_count {1UZ << 18U};
+    constexpr handle_type handle_bad {1000};
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    // Run a failing operation repeatedly and report the mean time
+    // per failure, which includes the system call itself.
+    auto measure(std::string_view label,
+                 const std::function<std::size_t()>& fail) -> void
+    {
+        std::size_t count {0};
+        const auto start {Clock::now()};
+
+        for (std::size_t i {0}; i < error_count; ++i) {
+            count += fail();
+        }
+
+        const Nanoseconds elapsed {Clock::now() - start};
+        std::cout << label
+                  << ": "
+                  << elapsed.count() / static_cast<double>(error_count)
+                  << " ns/error"
+                  << std::endl;
+
+        if (count != error_count) {
+            throw Error {"Unexpected success"};
+        }
+    }
+
+    auto benchmark_close(const SharedRuntime& sr) -> void
+    {
+        const SocketCore sc {handle_bad, AF_INET, sr.get()};
+        measure("close EBADF", [&]() -> std::size_t {
+            return close(sc) ? 1 : 0;
+        });
+        measure("close EBADF, formatted", [&]() -> std::size_t {
+            return close(sc).string().empty() ? 0 : 1;
+        });
+    }
+
+    auto benchmark_get_name(const SharedRuntime& sr) -> void
+    {
+        const SocketCore sc {handle_bad, AF_INET, sr.get()};
+        measure("getsockname EBADF", [&]() -> std::size_t {
+            return get_nameresult(sc, NameSymbol::getsockname) ? 0 : 1;
+        });
+    }
+
+    auto benchmark_read(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        const auto sp {create_socketpair(hints, sr.get())};
+
+        if (sp[0]->set_nonblocking(true)) {
+            throw Error {"Unable to set non-blocking mode"};
+        }
+
+        TextBuffer buffer {1UZ << 16U};
+        measure("read EAGAIN", [&]() -> std::size_t {
+            try {
+                static_cast<void>(sp[0]->read(buffer));
+            }
+            catch (const Error&) {
+                return 1;
+            }
+
+            return 0;
+        });
+    }
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+        benchmark_close(sr);
+        benchmark_get_name(sr);
+        benchmark_read(sr);
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
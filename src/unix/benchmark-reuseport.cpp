@@ -0,0 +1,163 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/network.hpp"          // Error, SharedRuntime,
+                                        // ShardedListener,
+                                        // SockAddrStorage, SocketHints,
+                                        // UniqueSocket, create_socket(),
+                                        // run()
+#include "network/opensymbol.hpp"       // OpenSymbol
+#include "network/os-features.hpp"      // HAVE_ACCEPT4, HAVE_REUSEPORT
+#include "network/parse.hpp"            // parse()
+
+#include <netdb.h>          // AI_PASSIVE
+#include <sys/socket.h>     // AF_INET, SOCK_STREAM
+
+#include <algorithm>    // std::max()
+#include <chrono>       // std::chrono::duration,
+                        // std::chrono::steady_clock
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <iostream>     // std::cerr, std::cout, std::endl
+#include <string>       // std::string, std::to_string()
+#include <thread>       // std::jthread, std::this_thread::yield(),
+                        // std::thread
+#include <vector>       // std::vector
+
+namespace
+{
+    using Network::Error;
+    using Network::OpenSymbol;
+    using Network::SharedRuntime;
+    using Network::SockAddrStorage;
+    using Network::SocketHints;
+    using Network::UniqueSocket;
+    using Network::create_socket;
+    using Network::parse;
+    using Network::run;
+#if defined(HAVE_ACCEPT4) && defined(HAVE_REUSEPORT)
+    using Network::ShardedListener;
+#endif
+
+    using Clock = std::chrono::steady_clock;
+    using Seconds = std::chrono::duration<double>;
+
+    constexpr std::size_t client_count {4};
+    constexpr std::size_t connection_count {2048};
+    constexpr std::size_t shard_count_min {4};
+
+    auto is_pinned {false};  // NOLINT
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "pv")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-p] [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('p')) {
+            is_pinned = true;
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto connect_all(const SharedRuntime& sr,
+                     const SockAddrStorage& name,
+                     std::size_t count) -> void
+    {
+        const SocketHints hints {AF_INET, SOCK_STREAM, 0};
+
+        for (std::size_t i {0}; i < count; ++i) {
+            const auto socket {create_socket(hints, sr.get())};
+
+            if (const auto error {socket->open(name, OpenSymbol::connect)}) {
+                throw Error {error.string()};
+            }
+        }
+    }
+
+#if defined(HAVE_ACCEPT4) && defined(HAVE_REUSEPORT)
+    // Accept connections from several client threads on a listener
+    // with the given number of SO_REUSEPORT shards, and report the
+    // rate at which they are accepted.
+    auto benchmark_shards(const SharedRuntime& sr,
+                          std::size_t shard_count) -> void
+    {
+        const SocketHints hints {AF_INET, SOCK_STREAM, 0, AI_PASSIVE};
+        ShardedListener listener {{"127.0.0.1", "0"}, hints, sr.get(),
+                                  shard_count, is_pinned};
+        listener.start([](UniqueSocket, std::size_t) {});
+        const auto start {Clock::now()};
+        {
+            std::vector<std::jthread> clients;
+
+            for (std::size_t i {0}; i < client_count; ++i) {
+                clients.emplace_back([&] {
+                    connect_all(sr, listener.name(),
+                                connection_count / client_count);
+                });
+            }
+        }
+
+        while (listener.accepted() < connection_count) {
+            std::this_thread::yield();
+        }
+
+        const Seconds elapsed {Clock::now() - start};
+        listener.stop();
+        std::cout << "shards "
+                  << shard_count
+                  << ": "
+                  << static_cast<double>(connection_count) / elapsed.count()
+                  << " connections/s"
+                  << std::endl;
+    }
+#endif
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+#if defined(HAVE_ACCEPT4) && defined(HAVE_REUSEPORT)
+        const auto shard_count_max {
+            std::max<std::size_t>(shard_count_min,
+                                  std::thread::hardware_concurrency())
+        };
+
+        for (std::size_t count {1}; count <= shard_count_max; count *= 2) {
+            benchmark_shards(sr, count);
+        }
+#endif
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
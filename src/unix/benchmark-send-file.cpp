@@ -0,0 +1,262 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/network.hpp"          // Error, SharedRuntime, Socket,
+                                        // SocketCore, SocketHints,
+                                        // SpliceRelay,
+                                        // create_socketpair(),
+                                        // handle_type, run(), to_size()
+#include "network/os-features.hpp"      // HAVE_SENDFILE, HAVE_SPLICE
+#include "network/parse.hpp"            // parse()
+
+#include <sys/socket.h>     // AF_UNIX, SOCK_STREAM
+#include <sys/types.h>      // off_t
+#include <unistd.h>         // ::close(), ::pread(), ::unlink(),
+                            // ::write()
+
+#include <chrono>       // std::chrono::duration,
+                        // std::chrono::steady_clock
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit(), ::mkstemp()
+#include <filesystem>   // std::filesystem::temp_directory_path()
+#include <iostream>     // std::cerr, std::cout, std::endl
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <thread>       // std::jthread
+#include <utility>      // std::cmp_equal()
+#include <vector>       // std::vector
+
+namespace
+{
+    using Network::Error;
+    using Network::SharedRuntime;
+    using Network::Socket;
+    using Network::SocketCore;
+    using Network::SocketHints;
+    using Network::create_socketpair;
+    using Network::handle_type;
+    using Network::parse;
+    using Network::run;
+    using Network::to_size;
+#ifdef HAVE_SPLICE
+    using Network::SpliceRelay;
+#endif
+
+    using Clock = std::chrono::steady_clock;
+    using Seconds = std::chrono::duration<double>;
+
+    constexpr std::size_t chunk_size {1UZ << 16U};
+    constexpr std::size_t file_size {1UZ << 26U};
+    constexpr double mebibyte {1UZ << 20U};
+
+    const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto create_file() -> handle_type
+    {
+        auto path {(std::filesystem::temp_directory_path() /
+                    "benchmark-send-file-XXXXXX").string()};
+        const auto handle {::mkstemp(path.data())};
+
+        if (handle == -1) {
+            throw Error {"Unable to create file " + path};
+        }
+
+        static_cast<void>(::unlink(path.c_str()));
+        const std::string chunk(chunk_size, 'x');
+
+        for (std::size_t total {0}; total < file_size; total += chunk_size) {
+            if (!std::cmp_equal(::write(handle, chunk.data(), chunk.size()),
+                                chunk.size())) {
+                throw Error {"Unable to write file " + path};
+            }
+        }
+
+        return handle;
+    }
+
+    auto drain(const Socket& socket) -> void
+    {
+        std::vector<char> buffer(chunk_size);
+
+        for (std::size_t total {0}; total < file_size;) {
+            const auto ssize {socket.read(buffer)};
+
+            if (ssize <= 0) {
+                break;
+            }
+
+            total += to_size(ssize);
+        }
+    }
+
+    auto write_all(const Socket& socket, std::string_view sv) -> void
+    {
+        while (!sv.empty()) {
+            sv.remove_prefix(to_size(socket.write(sv)));
+        }
+    }
+
+    auto print(std::string_view label, Seconds elapsed) -> void
+    {
+        const auto rate {static_cast<double>(file_size) / mebibyte /
+                         elapsed.count()};
+        std::cout << label
+                  << ": "
+                  << rate
+                  << " MiB/s"
+                  << std::endl;
+    }
+
+    auto benchmark_read_write(const SharedRuntime& sr,
+                              handle_type handle) -> void
+    {
+        auto sp {create_socketpair(hints, sr.get())};
+        std::vector<char> buffer(chunk_size);
+        const auto start {Clock::now()};
+        std::jthread reader {[&] {drain(*sp[1]);}};
+
+        for (std::size_t offset {0}; offset < file_size;) {
+            const auto ssize {::pread(handle, buffer.data(), buffer.size(),
+                                      static_cast<off_t>(offset))};
+
+            if (ssize <= 0) {
+                break;
+            }
+
+            write_all(*sp[0], {buffer.data(), to_size(ssize)});
+            offset += to_size(ssize);
+        }
+
+        reader.join();
+        print("pread/write", Clock::now() - start);
+    }
+
+    auto benchmark_copy_relay(const SharedRuntime& sr) -> void
+    {
+        auto input {create_socketpair(hints, sr.get())};
+        auto output {create_socketpair(hints, sr.get())};
+        std::vector<char> buffer(chunk_size);
+        const auto start {Clock::now()};
+        std::jthread reader {[&] {drain(*output[0]);}};
+        std::jthread writer {[&] {
+            const std::string chunk(chunk_size, 'x');
+
+            for (std::size_t total {0}; total < file_size;
+                 total += chunk_size) {
+                write_all(*input[1], chunk);
+            }
+        }};
+
+        for (std::size_t total {0}; total < file_size;) {
+            const auto ssize {input[0]->read(buffer)};
+
+            if (ssize <= 0) {
+                break;
+            }
+
+            write_all(*output[1], {buffer.data(), to_size(ssize)});
+            total += to_size(ssize);
+        }
+
+        writer.join();
+        reader.join();
+        print("read/write relay", Clock::now() - start);
+    }
+
+#ifdef HAVE_SENDFILE
+    auto benchmark_send_file(const SharedRuntime& sr,
+                             handle_type handle) -> void
+    {
+        auto sp {create_socketpair(hints, sr.get())};
+        const auto start {Clock::now()};
+        std::jthread reader {[&] {drain(*sp[1]);}};
+        static_cast<void>(sp[0]->send_file(handle, 0, file_size));
+        reader.join();
+        print("sendfile", Clock::now() - start);
+    }
+#endif
+
+#ifdef HAVE_SPLICE
+    auto benchmark_splice_relay(const SharedRuntime& sr) -> void
+    {
+        auto input {create_socketpair(hints, sr.get())};
+        auto output {create_socketpair(hints, sr.get())};
+        const SocketCore input_sc {static_cast<handle_type>(*input[0]),
+                                   AF_UNIX, sr.get()};
+        const SocketCore output_sc {static_cast<handle_type>(*output[1]),
+                                    AF_UNIX, sr.get()};
+        SpliceRelay relay {sr.get(), chunk_size};
+        const auto start {Clock::now()};
+        std::jthread reader {[&] {drain(*output[0]);}};
+        std::jthread writer {[&] {
+            const std::string chunk(chunk_size, 'x');
+
+            for (std::size_t total {0}; total < file_size;
+                 total += chunk_size) {
+                write_all(*input[1], chunk);
+            }
+        }};
+        static_cast<void>(relay.relay(input_sc, output_sc, file_size));
+        writer.join();
+        reader.join();
+        print("splice relay", Clock::now() - start);
+    }
+#endif
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+        const auto handle {create_file()};
+        benchmark_read_write(sr, handle);
+#ifdef HAVE_SENDFILE
+        benchmark_send_file(sr, handle);
+#endif
+        benchmark_copy_relay(sr);
+#ifdef HAVE_SPLICE
+        benchmark_splice_relay(sr);
+#endif
+        static_cast<void>(::close(handle));
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
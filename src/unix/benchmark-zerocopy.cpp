@@ -0,0 +1,332 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/network.hpp"          // Error, SharedRuntime, Socket,
+                                        // SocketCore, SocketHints,
+                                        // UniqueSocket, handle_type,
+                                        // ZeroCopy, ZeroCopyCompletion,
+                                        // accept(), create_socket(),
+                                        // reap_zerocopy(), run(),
+                                        // send_zerocopy(),
+                                        // to_bytestring(), to_size()
+#include "network/opensymbol.hpp"       // OpenSymbol
+#include "network/os-features.hpp"      // HAVE_ZEROCOPY
+#include "network/parse.hpp"            // parse()
+
+#include <arpa/inet.h>      // htonl()
+#include <netinet/in.h>     // INADDR_LOOPBACK, sockaddr_in
+#include <poll.h>           // pollfd, ::poll()
+#include <sys/socket.h>     // AF_INET, SOCK_STREAM
+#include <time.h>           // CLOCK_THREAD_CPUTIME_ID, timespec,
+                            // ::clock_gettime()
+
+#include <array>        // std::array
+#include <chrono>       // std::chrono::duration,
+                        // std::chrono::steady_clock
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <functional>   // std::function, std::ref()
+#include <iostream>     // std::cerr, std::cout, std::endl
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <thread>       // std::jthread
+#include <vector>       // std::vector
+
+namespace
+{
+    using Network::Error;
+    using Network::OpenSymbol;
+    using Network::SharedRuntime;
+    using Network::Socket;
+    using Network::SocketCore;
+    using Network::SocketHints;
+    using Network::UniqueSocket;
+    using Network::accept;
+    using Network::create_socket;
+    using Network::handle_type;
+    using Network::parse;
+    using Network::run;
+    using Network::to_bytestring;
+    using Network::to_size;
+#ifdef HAVE_ZEROCOPY
+    using Network::ZeroCopy;
+    using Network::ZeroCopyCompletion;
+    using Network::reap_zerocopy;
+    using Network::send_zerocopy;
+#endif
+
+    using Clock = std::chrono::steady_clock;
+    using Seconds = std::chrono::duration<double>;
+    using Sender = std::function<void(const Socket&, std::string_view)>;
+
+    struct Usage
+    {
+        Seconds m_cpu;
+        Seconds m_elapsed;
+    };
+
+    constexpr std::size_t completion_count {64};
+    constexpr std::size_t outstanding_max {256};
+    constexpr std::size_t total_size {1UZ << 28U};
+    constexpr double gibibyte {1UZ << 30U};
+    constexpr double mebibyte {1UZ << 20U};
+    constexpr std::array message_sizes {
+        1UZ << 12U, 1UZ << 14U, 1UZ << 16U, 1UZ << 18U, 1UZ << 20U
+    };
+
+    const SocketHints hints {AF_INET, SOCK_STREAM, 0};
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto get_thread_time() -> Seconds
+    {
+        timespec ts {};
+        static_cast<void>(::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts));
+        return Seconds {static_cast<double>(ts.tv_sec) +
+                        static_cast<double>(ts.tv_nsec) / 1e9};
+    }
+
+    auto create_listener(const SharedRuntime& sr) -> UniqueSocket
+    {
+        auto listener {create_socket(hints, sr.get())};
+        sockaddr_in sin {};
+        sin.sin_family = AF_INET;
+        sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        const auto bs {to_bytestring(&sin, sizeof sin)};
+
+        if (listener->open(bs, OpenSymbol::bind) || listener->listen(1)) {
+            throw Error {"Unable to create listener"};
+        }
+
+        return listener;
+    }
+
+    auto drain(const Socket& socket) -> void
+    {
+        std::vector<char> buffer(1UZ << 20U);
+
+        for (std::size_t total {0}; total < total_size;) {
+            const auto ssize {socket.read(buffer)};
+
+            if (ssize <= 0) {
+                break;
+            }
+
+            total += to_size(ssize);
+        }
+    }
+
+    // Measure the CPU time consumed by the sending thread only.
+    auto measure(const SharedRuntime& sr,
+                 std::size_t message_size,
+                 const Sender& sender,
+                 bool is_zerocopy) -> Usage
+    {
+        const auto listener {create_listener(sr)};
+        const auto client {create_socket(hints, sr.get())};
+#ifdef HAVE_ZEROCOPY
+        if (is_zerocopy) {
+            if (const auto error {client->set_option<ZeroCopy>(true)}) {
+                throw Error {error.string()};
+            }
+        }
+#else
+        static_cast<void>(is_zerocopy);
+#endif
+
+        if (client->open(listener->get_sockname(), OpenSymbol::connect)) {
+            throw Error {"Unable to connect to listener"};
+        }
+
+        const auto server {accept(*listener)};
+        const std::string message(message_size, 'x');
+        std::jthread reader {[&] {drain(*server);}};
+        const auto start {Clock::now()};
+        const auto cpu_start {get_thread_time()};
+
+        sender(*client, message);
+        const auto cpu {get_thread_time() - cpu_start};
+        reader.join();
+        return {cpu, Clock::now() - start};
+    }
+
+    auto print(std::string_view label,
+               std::size_t message_size,
+               const Usage& usage) -> void
+    {
+        const auto gib {static_cast<double>(total_size) / gibibyte};
+        const auto rate {static_cast<double>(total_size) / mebibyte /
+                         usage.m_elapsed.count()};
+        std::cout << label
+                  << " "
+                  << message_size
+                  << ": "
+                  << usage.m_cpu.count() / gib
+                  << " CPU s/GiB, "
+                  << rate
+                  << " MiB/s"
+                  << std::endl;
+    }
+
+    auto write_all(const Socket& socket, std::string_view sv) -> void
+    {
+        while (!sv.empty()) {
+            sv.remove_prefix(to_size(socket.write(sv)));
+        }
+    }
+
+    auto send_write(const Socket& socket, std::string_view message) -> void
+    {
+        for (std::size_t total {0}; total < total_size;
+             total += message.size()) {
+            write_all(socket, message);
+        }
+    }
+
+    auto benchmark_write(const SharedRuntime& sr,
+                         std::size_t message_size) -> void
+    {
+        const auto usage {measure(sr, message_size, send_write, false)};
+        print("write", message_size, usage);
+    }
+
+#ifdef HAVE_ZEROCOPY
+    class ZeroCopySender
+    {
+    public:
+        auto operator()(const Socket& socket, std::string_view message) ->
+            void
+        {
+            const auto& sc {socket.core()};
+
+            for (std::size_t total {0}; total < total_size;
+                 total += message.size()) {
+                send_all(sc, message);
+                reap(sc);
+            }
+
+            // The buffer may be reused only once every send is done.
+            while (m_completed < m_sent) {
+                wait(sc.handle());
+                reap(sc);
+            }
+        }
+
+        [[nodiscard]] auto copied() const noexcept -> std::size_t
+        {
+            return m_copied;
+        }
+
+    private:
+        auto send_all(const SocketCore& sc, std::string_view sv) -> void
+        {
+            while (!sv.empty()) {
+                sv.remove_prefix(to_size(send_zerocopy(sc, sv)));
+                ++m_sent;
+
+                // Bound the notifications held in socket option
+                // memory, or further sends fail with ENOBUFS.
+                while (m_sent - m_completed > outstanding_max) {
+                    wait(sc.handle());
+                    reap(sc);
+                }
+            }
+        }
+
+        static auto wait(handle_type handle) -> void
+        {
+            // Pending notifications are reported as POLLERR.
+            pollfd pfd {handle, 0, 0};
+            static_cast<void>(::poll(&pfd, 1, -1));
+        }
+
+        auto reap(const SocketCore& sc) -> void
+        {
+            const auto size {reap_zerocopy(sc, m_completions)};
+
+            for (std::size_t i {0}; i < size; ++i) {
+                const auto& completion {m_completions[i]};
+                m_completed += completion.size();
+
+                if (completion.m_is_copied) {
+                    m_copied += completion.size();
+                }
+            }
+        }
+
+        std::array<ZeroCopyCompletion, completion_count> m_completions {};
+        std::size_t m_completed {0};
+        std::size_t m_copied {0};
+        std::size_t m_sent {0};
+    };
+
+    auto benchmark_zerocopy(const SharedRuntime& sr,
+                            std::size_t message_size) -> void
+    {
+        ZeroCopySender sender;
+        const auto usage {measure(sr, message_size, std::ref(sender), true)};
+        print("send_zerocopy", message_size, usage);
+
+        if (is_verbose) {
+            std::cout << "send_zerocopy "
+                      << message_size
+                      << ": "
+                      << sender.copied()
+                      << " sends fell back to copying"
+                      << std::endl;
+        }
+    }
+#endif
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+
+        for (const auto message_size : message_sizes) {
+            benchmark_write(sr, message_size);
+#ifdef HAVE_ZEROCOPY
+            benchmark_zerocopy(sr, message_size);
+#endif
+        }
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
@@ -18,7 +18,7 @@
 #include "network/bind-path.hpp"                // bind()
 #include "network/create-socket-hints.hpp"      // create_socket()
 #include "network/pathnameview.hpp"             // PathnameView
-#include "network/run.hpp"                      // run()
+#include "network/run.hpp"                      // run_borrowed()
 #include "network/runtime.hpp"                  // Runtime
 #include "network/sockethints.hpp"              // SocketHints
 #include "network/socketresult.hpp"             // SocketResultVector
@@ -42,8 +42,7 @@ auto Network::bind(const PathnameView& pathname,
                    const SocketHints& hints,
                    bool is_verbose) -> SocketResult
 {
-    const auto sr {run(is_verbose)};
-    return bind(pathname, hints, sr.get());
+    return bind(pathname, hints, run_borrowed(is_verbose));
 }
 
 #endif
@@ -18,7 +18,7 @@
 #include "network/connect-path.hpp"             // connect()
 #include "network/create-socket-hints.hpp"      // create_socket()
 #include "network/pathnameview.hpp"             // PathnameView
-#include "network/run.hpp"                      // run()
+#include "network/run.hpp"                      // run_borrowed()
 #include "network/runtime.hpp"                  // Runtime
 #include "network/sockethints.hpp"              // SocketHints
 #include "network/socketresult.hpp"             // SocketResult
@@ -40,8 +40,7 @@ auto Network::connect(const PathnameView& pathname,
                       const SocketHints& hints,
                       bool is_verbose) -> SocketResult
 {
-    const auto sr {run(is_verbose)};
-    return connect(pathname, hints, sr.get());
+    return connect(pathname, hints, run_borrowed(is_verbose));
 }
 
 #endif
@@ -1,4 +1,4 @@
-// Copyright (C) 2022  "Michael G. Morey" <mgmorey@gmail.com>
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -18,12 +18,37 @@
 #include "network/create-socket-socketdata.hpp" // create_socket()
 #include "network/inetsocket.hpp"               // InetSocket
 #include "network/socketdata.hpp"               // SocketData
+#include "network/socketdeleter.hpp"            // SocketDeleter
+#include "network/socketslab.hpp"               // SocketSlab
 #include "network/uniquesocket.hpp"             // UniqueSocket
 #include "network/unixsocket.hpp"               // UnixSocket
 
 #include <sys/socket.h>     // AF_UNIX
 
 #include <memory>       // std::make_unique()
+#include <new>          // ::new
+
+namespace
+{
+    using Network::SocketData;
+    using Network::SocketDeleter;
+    using Network::SocketSlab;
+    using Network::UniqueSocket;
+
+    template <typename T>
+    auto make_socket(const SocketData& sd, SocketSlab& slab) -> UniqueSocket
+    {
+        auto* const slot {slab.allocate()};
+
+        try {
+            return {::new (slot) T {sd}, SocketDeleter {&slab}};
+        }
+        catch (...) {
+            slab.deallocate(slot);
+            throw;
+        }
+    }
+}
 
 auto Network::create_socket(const SocketData& sd) -> UniqueSocket
 {
@@ -35,4 +60,15 @@ auto Network::create_socket(const SocketData& sd) -> UniqueSocket
     }
 }
 
+auto Network::create_socket(const SocketData& sd,
+                            SocketSlab& slab) -> UniqueSocket
+{
+    switch (sd.core().family()) {  // NOLINT
+    case AF_UNIX:
+        return make_socket<UnixSocket>(sd, slab);
+    default:
+        return make_socket<InetSocket>(sd, slab);
+    }
+}
+
 #endif
@@ -18,7 +18,7 @@
 #include "network/create-socketpair.hpp"        // create_socketpair()
 #include "network/create-socketpairresult.hpp"  // create_socketpairresult()
 #include "network/error.hpp"                    // Error
-#include "network/run.hpp"                      // run()
+#include "network/run.hpp"                      // run_borrowed()
 #include "network/runtime.hpp"                  // Runtime
 #include "network/sockethints.hpp"              // SocketHints
 #include "network/socketpair.hpp"               // SocketPair
@@ -40,8 +40,7 @@ auto Network::create_socketpair(const SocketHints& hints,
 auto Network::create_socketpair(const SocketHints& hints,
                                 bool is_verbose) -> SocketPair
 {
-    const auto sr {run(is_verbose)};
-    return create_socketpair(hints, sr.get());
+    return create_socketpair(hints, run_borrowed(is_verbose));
 }
 
 #endif
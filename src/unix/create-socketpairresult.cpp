@@ -32,13 +32,14 @@
 #include "network/socketprotocol.hpp"           // SocketProtocol
 #include "network/sockettype.hpp"               // SocketType
 #include "network/to-os-error.hpp"              // to_os_error()
+#include "network/trace.hpp"                    // trace()
 
 #include <sys/socket.h>     // ::socketpair()
 
 #include <algorithm>    // std::ranges::transform()
 #include <expected>     // std::unexpected
-#include <iostream>     // std::cout, std::endl
 #include <iterator>     // std::back_inserter
+#include <ostream>      // std::ostream
 #include <sstream>      // std::ostringstream
 #include <vector>       // std::vector
 
@@ -50,26 +51,25 @@ auto Network::create_socketpairresult(const SocketHints& hints,
 
     std::vector<handle_type> handles(2, handle_null);
     const auto family {hints.m_family};
-    const auto is_verbose {rt->is_verbose()};
+    auto* const tracer {rt->tracer()};
 
-    if (is_verbose) {
+    trace(tracer, [&](std::ostream& os) {
         // clang-format off
-        std::cout << "Calling ::socketpair("
-                  << Format("domain")
-                  << SocketFamily(family)
-                  << Format(delim, tab, "type")
-                  << SocketType(hints.m_socktype)
-                  << Format(delim, tab, "protocol")
-                  << SocketProtocol(hints.m_protocol, family)
-                  << Format(delim, tab, "fds")
-                  << '{'
-                  << handles[0]
-                  << ", "
-                  << handles[1]
-                  << "})"
-                  << std::endl;
+        os << "Calling ::socketpair("
+           << Format("domain")
+           << SocketFamily(family)
+           << Format(delim, tab, "type")
+           << SocketType(hints.m_socktype)
+           << Format(delim, tab, "protocol")
+           << SocketProtocol(hints.m_protocol, family)
+           << Format(delim, tab, "fds")
+           << '{'
+           << handles[0]
+           << ", "
+           << handles[1]
+           << "})";
         // clang-format on
-    }
+    });
 
     reset_api_error();
 
@@ -101,28 +101,27 @@ auto Network::create_socketpairresult(const SocketHints& hints,
         return std::unexpected {OsError {os_error, oss.str()}};
     }
 
-    if (is_verbose) {
+    trace(tracer, [&](std::ostream& os) {
         // clang-format off
-        std::cout << "Call to ::socketpair("
-                  << Format("domain")
-                  << SocketFamily(family)
-                  << Format(delim, tab, "type")
-                  << SocketType(hints.m_socktype)
-                  << Format(delim, tab, "protocol")
-                  << SocketProtocol(hints.m_protocol, family)
-                  << Format(delim, tab, "fds")
-                  << '{'
-                  << handles[0]
-                  << ", "
-                  << handles[1]
-                  << "}) returned data {"
-                  << handles[0]
-                  << ", "
-                  << handles[1]
-                  << '}'
-                  << std::endl;
+        os << "Call to ::socketpair("
+           << Format("domain")
+           << SocketFamily(family)
+           << Format(delim, tab, "type")
+           << SocketType(hints.m_socktype)
+           << Format(delim, tab, "protocol")
+           << SocketProtocol(hints.m_protocol, family)
+           << Format(delim, tab, "fds")
+           << '{'
+           << handles[0]
+           << ", "
+           << handles[1]
+           << "}) returned data {"
+           << handles[0]
+           << ", "
+           << handles[1]
+           << '}';
         // clang-format on
-    }
+    });
 
     SocketPair sp;
     auto create = [=](handle_type handle) -> UniqueSocket {
@@ -0,0 +1,106 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/datagrambatch.hpp"    // DatagramBatch
+
+#ifdef HAVE_RECVMMSG
+
+#include "network/bytespan.hpp"         // ByteSpan
+#include "network/charspan.hpp"         // CharSpan
+#include "network/logicerror.hpp"       // LogicError
+
+#include <sys/socket.h>     // mmsghdr, sockaddr_storage, socklen_t
+#include <sys/uio.h>        // iovec
+
+#include <algorithm>    // std::ranges::copy()
+#include <cstddef>      // std::byte, std::size_t
+#include <span>         // std::as_bytes, std::as_writable_bytes,
+                        // std::span
+#include <string_view>  // std::string_view
+
+Network::DatagramBatch::DatagramBatch(std::span<const CharSpan> t_buffers) :
+    m_buffers(t_buffers.begin(), t_buffers.end()),
+    m_iov(t_buffers.size()),
+    m_names(t_buffers.size()),
+    m_headers(t_buffers.size())
+{
+    if (m_buffers.empty()) {
+        throw LogicError {"Zero batch capacity"};
+    }
+
+    for (std::size_t i {0}; i < m_headers.size(); ++i) {
+        auto& hdr {m_headers[i].msg_hdr};
+        hdr.msg_name = &m_names[i];
+        hdr.msg_iov = &m_iov[i];
+        hdr.msg_iovlen = 1;
+    }
+
+    reset();
+}
+
+auto Network::DatagramBatch::capacity() const noexcept -> std::size_t
+{
+    return m_headers.size();
+}
+
+auto Network::DatagramBatch::data(std::size_t t_index) const ->
+    std::string_view
+{
+    return {m_buffers.at(t_index).data(), m_headers.at(t_index).msg_len};
+}
+
+auto Network::DatagramBatch::headers() noexcept -> std::span<mmsghdr>
+{
+    return m_headers;
+}
+
+auto Network::DatagramBatch::peer(std::size_t t_index) const -> ByteSpan
+{
+    const auto& name {m_names.at(t_index)};
+    const auto length {m_headers[t_index].msg_hdr.msg_namelen};
+    return std::as_bytes(std::span {&name, 1}).first(length);
+}
+
+auto Network::DatagramBatch::prepare(std::size_t t_index,
+                                     std::size_t t_length,
+                                     ByteSpan t_peer) -> void
+{
+    const auto& buffer {m_buffers.at(t_index)};
+
+    if (t_length > buffer.size()) {
+        throw LogicError {"Datagram length exceeds buffer size"};
+    }
+
+    if (t_peer.size() > sizeof(sockaddr_storage)) {
+        throw LogicError {"Peer address exceeds storage size"};
+    }
+
+    auto name {std::as_writable_bytes(std::span {&m_names[t_index], 1})};
+    std::ranges::copy(t_peer, name.begin());
+    auto& hdr {m_headers[t_index].msg_hdr};
+    hdr.msg_namelen = static_cast<socklen_t>(t_peer.size());
+    m_iov[t_index].iov_len = t_length;
+}
+
+auto Network::DatagramBatch::reset() noexcept -> void
+{
+    for (std::size_t i {0}; i < m_headers.size(); ++i) {
+        m_iov[i] = iovec {m_buffers[i].data(), m_buffers[i].size()};
+        m_headers[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+        m_headers[i].msg_len = 0;
+    }
+}
+
+#endif
@@ -0,0 +1,53 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/eventawaiter.hpp"     // EventAwaiter
+
+#ifdef HAVE_EPOLL
+
+#include "network/eventloop.hpp"        // EventLoop
+#include "network/handle-type.hpp"      // handle_type
+#include "network/oserror.hpp"          // OsError
+
+#include <coroutine>    // std::coroutine_handle
+#include <utility>      // std::move()
+
+Network::EventAwaiter::EventAwaiter(EventLoop& t_loop,
+                                    handle_type t_handle,
+                                    EventLoop::Events t_events) noexcept :
+    m_loop(t_loop),
+    m_handle(t_handle),
+    m_events(t_events)
+{
+}
+
+auto Network::EventAwaiter::await_ready() const noexcept -> bool
+{
+    return false;
+}
+
+auto Network::EventAwaiter::await_suspend(std::coroutine_handle<> t_handle) ->
+    bool
+{
+    m_error = m_loop.wait(m_handle, m_events, t_handle);
+    return !m_error;
+}
+
+auto Network::EventAwaiter::await_resume() -> OsError
+{
+    return std::move(m_error);
+}
+
+#endif
@@ -0,0 +1,393 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/eventloop.hpp"        // EventLoop
+
+#ifdef HAVE_EPOLL
+
+#include "network/error.hpp"            // Error
+#include "network/get-api-error.hpp"    // get_api_error()
+#include "network/handle-null.hpp"      // handle_null
+#include "network/handle-type.hpp"      // handle_type
+#include "network/handlegenerations.hpp" // HandleGenerations
+#include "network/logicerror.hpp"       // LogicError
+#include "network/oserror.hpp"          // OsError
+#include "network/reset-api-error.hpp"  // reset_api_error()
+#include "network/runtime.hpp"          // Runtime
+#include "network/socket-error.hpp"     // socket_error
+#include "network/systemcall.hpp"       // SystemCall
+#include "network/to-os-error.hpp"      // to_os_error()
+#include "network/to-size.hpp"          // to_size()
+#include "network/trace.hpp"            // trace()
+#include "network/uniquesocket.hpp"     // UniqueSocket
+
+#include <sys/epoll.h>      // EPOLL_CLOEXEC, EPOLL_CTL_ADD,
+                            // EPOLL_CTL_DEL, EPOLL_CTL_MOD,
+                            // epoll_event, ::epoll_create1(),
+                            // ::epoll_ctl(), ::epoll_wait()
+#include <unistd.h>         // ::close()
+
+#include <cerrno>       // EEXIST, EINTR
+#include <coroutine>    // std::coroutine_handle
+#include <cstddef>      // std::size_t
+#include <ostream>      // std::ostream
+#include <string_view>  // std::string_view
+#include <utility>      // std::exchange(), std::move()
+
+namespace
+{
+    auto to_string(int operation) -> std::string_view
+    {
+        switch (operation) {
+        case EPOLL_CTL_ADD:
+            return "EPOLL_CTL_ADD";
+        case EPOLL_CTL_DEL:
+            return "EPOLL_CTL_DEL";
+        case EPOLL_CTL_MOD:
+            return "EPOLL_CTL_MOD";
+        default:
+            return "EPOLL_CTL_UNKNOWN";
+        }
+    }
+}
+
+Network::EventLoop::EventLoop(const Runtime* t_rt, int t_size) :
+    m_events(to_size(t_size)),
+    m_rt(t_rt)
+{
+    if (m_rt == nullptr) {
+        throw LogicError {"Null runtime pointer"};
+    }
+
+    trace(m_rt->tracer(), [&](std::ostream& os) {
+        os << "Calling ::epoll_create1(EPOLL_CLOEXEC)";
+    });
+
+    reset_api_error();
+    m_handle = ::epoll_create1(EPOLL_CLOEXEC);
+
+    if (m_handle == handle_null) {
+        const auto api_error {get_api_error()};
+        const auto os_error {to_os_error(api_error)};
+        const SystemCall call {
+            .m_name = "::epoll_create1",
+            .m_arguments = [](std::ostream& os, const SystemCall&) {
+                os << "EPOLL_CLOEXEC";
+            },
+        };
+        throw Error {OsError {os_error, api_error, call}};
+    }
+}
+
+Network::EventLoop::~EventLoop() noexcept
+{
+    m_retired.clear();
+    m_entries.clear();
+    m_waiters.clear();
+    static_cast<void>(::close(m_handle));
+}
+
+auto Network::EventLoop::add(handle_type t_handle,
+                             Events t_events,
+                             Callback t_callback) -> OsError
+{
+    if (auto error {control(EPOLL_CTL_ADD, t_handle, t_events)}) {
+        return error;
+    }
+
+    m_entries.insert_or_assign(t_handle, Entry {std::move(t_callback), {}});
+    return {};
+}
+
+auto Network::EventLoop::add(UniqueSocket t_socket,
+                             Events t_events,
+                             Callback t_callback) -> OsError
+{
+    const auto handle {static_cast<handle_type>(*t_socket)};
+
+    if (auto error {control(EPOLL_CTL_ADD, handle, t_events)}) {
+        return error;
+    }
+
+    m_entries.insert_or_assign(handle, Entry {std::move(t_callback),
+                                              std::move(t_socket)});
+    return {};
+}
+
+auto Network::EventLoop::modify(handle_type t_handle,
+                                Events t_events) -> OsError
+{
+    return control(EPOLL_CTL_MOD, t_handle, t_events);
+}
+
+auto Network::EventLoop::remove(handle_type t_handle) -> OsError
+{
+    if (const auto wt {m_waiters.find(t_handle)}; wt != m_waiters.end()) {
+        // Coroutines still waiting on the handle will not be resumed.
+        m_pending -= static_cast<std::size_t>(wt->second.m_reader ? 1 : 0);
+        m_pending -= static_cast<std::size_t>(wt->second.m_writer ? 1 : 0);
+        m_waiters.erase(wt);
+    }
+
+    const auto it {m_entries.find(t_handle)};
+
+    if (it == m_entries.end()) {
+        return control(EPOLL_CTL_DEL, t_handle, 0);
+    }
+
+    auto error {control(EPOLL_CTL_DEL, t_handle, 0)};
+
+    if (m_is_dispatching) {
+        // Defer destruction: the callback being removed may be the
+        // one that is currently executing.
+        m_retired.push_back(m_entries.extract(it));
+    }
+    else {
+        m_entries.erase(it);
+    }
+
+    return error;
+}
+
+auto Network::EventLoop::run() -> OsError
+{
+    m_is_stopping = false;
+
+    while (!m_is_stopping && (!m_entries.empty() || m_pending > 0)) {
+        if (auto error {run_once(-1)}) {
+            return error;
+        }
+    }
+
+    return {};
+}
+
+auto Network::EventLoop::run_once(int t_timeout) -> OsError
+{
+    const auto size {static_cast<int>(m_events.size())};
+
+    trace(m_rt->tracer(), [&](std::ostream& os) {
+        // clang-format off
+        os << "Calling ::epoll_wait("
+           << m_handle
+           << ", ..., "
+           << size
+           << ", "
+           << t_timeout
+           << ')';
+        // clang-format on
+    });
+
+    reset_api_error();
+    const auto count {::epoll_wait(m_handle, m_events.data(), size, t_timeout)};
+
+    if (count == socket_error) {
+        const auto api_error {get_api_error()};
+
+        if (api_error == EINTR) {
+            return {};
+        }
+
+        const auto os_error {to_os_error(api_error)};
+        const SystemCall call {
+            .m_name = "::epoll_wait",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", ..., "
+                   << t_call.m_values[0]
+                   << ", "
+                   << t_call.m_values[1];
+                // clang-format on
+            },
+            .m_values = {size, t_timeout},
+            .m_handle = m_handle,
+        };
+        return {os_error, api_error, call};
+    }
+
+    m_is_dispatching = true;
+
+    for (std::size_t i {0}; i < to_size(count); ++i) {
+        const auto& event {m_events[i]};
+        const auto handle {event.data.fd};
+        if (const auto it {m_entries.find(handle)}; it != m_entries.end()) {
+            it->second.m_callback(handle, event.events);
+        }
+        else if (const auto wt {m_waiters.find(handle)};
+                 wt != m_waiters.end()) {
+            resume(wt->second, event.events);
+        }
+
+        if (m_is_stopping) {
+            break;
+        }
+    }
+
+    m_is_dispatching = false;
+    m_retired.clear();
+    return {};
+}
+
+auto Network::EventLoop::stop() noexcept -> void
+{
+    m_is_stopping = true;
+}
+
+auto Network::EventLoop::wait(handle_type t_handle,
+                              Events t_events,
+                              std::coroutine_handle<> t_waiter) -> OsError
+{
+    // A handle dispatched to a callback is never dispatched to a
+    // waiter, so awaiting it would suspend the coroutine forever.
+    if (m_entries.contains(t_handle)) {
+        throw LogicError {"Handle is registered with a callback"};
+    }
+
+    const auto generation {HandleGenerations::reserve(t_handle)};
+    auto it {m_waiters.find(t_handle)};
+
+    // Register the handle when it is first awaited, and again if it
+    // was closed and its number reused since it was registered.
+    if (it == m_waiters.end() || it->second.m_generation != generation) {
+        constexpr Events events {EPOLLIN | EPOLLOUT | EPOLLET};
+        auto error {control(EPOLL_CTL_ADD, t_handle, events)};
+
+        // A stale registration survives closing the old descriptor
+        // while another descriptor still refers to its file.
+        if (error.number() == EEXIST && it != m_waiters.end()) {
+            error = control(EPOLL_CTL_MOD, t_handle, events);
+        }
+
+        if (error) {
+            return error;
+        }
+
+        if (it != m_waiters.end()) {
+            m_waiters.erase(it);
+        }
+
+        it = m_waiters.emplace(t_handle,
+                               Waiters {.m_generation = generation}).first;
+    }
+
+    auto& waiter {(t_events & events_read) != 0 ? it->second.m_reader :
+                  it->second.m_writer};
+
+    if (!waiter) {
+        ++m_pending;
+    }
+
+    waiter = t_waiter;
+    return {};
+}
+
+auto Network::EventLoop::is_hung_up(handle_type t_handle) const noexcept ->
+    bool
+{
+    const auto it {m_waiters.find(t_handle)};
+    return it != m_waiters.end() && it->second.m_is_hung_up &&
+        it->second.m_generation == HandleGenerations::current(t_handle);
+}
+
+auto Network::EventLoop::runtime() const noexcept -> const Runtime*
+{
+    return m_rt;
+}
+
+auto Network::EventLoop::size() const noexcept -> std::size_t
+{
+    return m_entries.size() + m_waiters.size();
+}
+
+auto Network::EventLoop::control(int t_operation,
+                                 handle_type t_handle,
+                                 Events t_events) const -> OsError
+{
+    epoll_event event {};
+    event.events = t_events;
+    event.data.fd = t_handle;
+
+    trace(m_rt->tracer(), [&](std::ostream& os) {
+        // clang-format off
+        os << "Calling ::epoll_ctl("
+           << m_handle
+           << ", "
+           << to_string(t_operation)
+           << ", "
+           << t_handle
+           << ", "
+           << t_events
+           << ')';
+        // clang-format on
+    });
+
+    reset_api_error();
+
+    if (::epoll_ctl(m_handle, t_operation, t_handle, &event) == socket_error) {
+        const auto api_error {get_api_error()};
+        const auto os_error {to_os_error(api_error)};
+        const SystemCall call {
+            .m_name = "::epoll_ctl",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", "
+                   << t_call.m_detail
+                   << ", "
+                   << t_call.m_values[0]
+                   << ", "
+                   << t_call.m_values[1];
+                // clang-format on
+            },
+            .m_detail = to_string(t_operation),
+            .m_values = {t_handle, t_events},
+            .m_handle = m_handle,
+        };
+        return {os_error, api_error, call};
+    }
+
+    return {};
+}
+
+auto Network::EventLoop::resume(Waiters& t_waiters, Events t_events) -> void
+{
+    if ((t_events & events_error) != 0) {
+        t_waiters.m_is_hung_up = true;
+    }
+
+    // Take both waiters before resuming either, as a resumed
+    // coroutine may wait again or remove the handle.
+    const auto reader {
+        (t_events & (events_read | events_error)) != 0 ?
+        std::exchange(t_waiters.m_reader, {}) : std::coroutine_handle<> {}
+    };
+    const auto writer {
+        (t_events & (events_write | events_error)) != 0 ?
+        std::exchange(t_waiters.m_writer, {}) : std::coroutine_handle<> {}
+    };
+
+    if (reader) {
+        --m_pending;
+        reader.resume();
+    }
+
+    if (writer) {
+        --m_pending;
+        writer.resume();
+    }
+}
+
+#endif
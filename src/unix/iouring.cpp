@@ -0,0 +1,385 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/iouring.hpp"          // IoUring
+
+#ifdef HAVE_IO_URING
+
+#include "network/error.hpp"            // Error
+#include "network/get-api-error.hpp"    // get_api_error()
+#include "network/handle-null.hpp"      // handle_null
+#include "network/handle-type.hpp"      // handle_type
+#include "network/logicerror.hpp"       // LogicError
+#include "network/oserror.hpp"          // OsError
+#include "network/reset-api-error.hpp"  // reset_api_error()
+#include "network/runtime.hpp"          // Runtime
+#include "network/socket-error.hpp"     // socket_error
+#include "network/systemcall.hpp"       // SystemCall
+#include "network/to-os-error.hpp"      // to_os_error()
+#include "network/trace.hpp"            // trace()
+
+#include <linux/io_uring.h>     // IORING_ENTER_GETEVENTS,
+                                // IORING_FEAT_NODROP,
+                                // IORING_OFF_CQ_RING,
+                                // IORING_OFF_SQES,
+                                // IORING_OFF_SQ_RING,
+                                // IORING_REGISTER_BUFFERS,
+                                // IORING_SQ_CQ_OVERFLOW,
+                                // IORING_UNREGISTER_BUFFERS,
+                                // io_uring_cqe, io_uring_params,
+                                // io_uring_sqe
+#include <sys/mman.h>           // MAP_FAILED, MAP_POPULATE,
+                                // MAP_SHARED, PROT_READ,
+                                // PROT_WRITE, ::mmap(), ::munmap()
+#include <sys/syscall.h>        // __NR_io_uring_enter,
+                                // __NR_io_uring_register,
+                                // __NR_io_uring_setup
+#include <sys/uio.h>            // iovec
+#include <unistd.h>             // ::close(), ::syscall()
+
+#include <atomic>       // std::atomic_ref, std::memory_order_acquire,
+                        // std::memory_order_release
+#include <cerrno>       // EINTR
+#include <cstddef>      // std::byte, std::size_t
+#include <cstdint>      // std::int64_t
+#include <ostream>      // std::ostream
+#include <span>         // std::span
+
+namespace
+{
+    auto to_call_error(const Network::SystemCall& call) -> Network::OsError
+    {
+        const auto api_error {Network::get_api_error()};
+        return {Network::to_os_error(api_error), api_error, call};
+    }
+
+    template <typename T>
+    auto to_pointer(void* base, unsigned offset) noexcept -> T*
+    {
+        return reinterpret_cast<T*>(static_cast<std::byte*>(base) +  // NOLINT
+                                    offset);
+    }
+}
+
+Network::IoUring::IoUring(const Runtime* t_rt, unsigned t_entries) :
+    m_rt(t_rt)
+{
+    if (m_rt == nullptr) {
+        throw LogicError {"Null runtime pointer"};
+    }
+
+    io_uring_params params {};
+
+    trace(m_rt->tracer(), [&](std::ostream& os) {
+        // clang-format off
+        os << "Calling ::io_uring_setup("
+           << t_entries
+           << ", ...)";
+        // clang-format on
+    });
+
+    reset_api_error();
+    m_handle = static_cast<handle_type>(::syscall(__NR_io_uring_setup,
+                                                  t_entries,
+                                                  &params));
+
+    if (m_handle == handle_null) {
+        const SystemCall call {
+            .m_name = "::io_uring_setup",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_values[0]
+                   << ", ...";
+                // clang-format on
+            },
+            .m_values = {t_entries},
+        };
+        throw Error {to_call_error(call)};
+    }
+
+    // Without this feature the kernel drops completions once the
+    // completion queue is full, and their requests would never
+    // finish.
+    if ((params.features & IORING_FEAT_NODROP) == 0) {
+        static_cast<void>(::close(m_handle));
+        throw Error {"Kernel io_uring lacks IORING_FEAT_NODROP"};
+    }
+
+    try {
+        map(m_sq,
+            params.sq_off.array + params.sq_entries * sizeof(unsigned),
+            IORING_OFF_SQ_RING);
+        map(m_cq,
+            params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe),
+            IORING_OFF_CQ_RING);
+        map(m_sqes,
+            params.sq_entries * sizeof(io_uring_sqe),
+            IORING_OFF_SQES);
+    }
+    catch (const Error&) {
+        unmap(m_sqes);
+        unmap(m_cq);
+        unmap(m_sq);
+        static_cast<void>(::close(m_handle));
+        throw;
+    }
+
+    m_sq_head = to_pointer<unsigned>(m_sq.m_data, params.sq_off.head);
+    m_sq_tail = to_pointer<unsigned>(m_sq.m_data, params.sq_off.tail);
+    m_sq_array = to_pointer<unsigned>(m_sq.m_data, params.sq_off.array);
+    m_sq_flags = to_pointer<unsigned>(m_sq.m_data, params.sq_off.flags);
+    m_sq_mask = *to_pointer<unsigned>(m_sq.m_data, params.sq_off.ring_mask);
+    m_cq_head = to_pointer<unsigned>(m_cq.m_data, params.cq_off.head);
+    m_cq_tail = to_pointer<unsigned>(m_cq.m_data, params.cq_off.tail);
+    m_cq_mask = *to_pointer<unsigned>(m_cq.m_data, params.cq_off.ring_mask);
+    m_cqe_base = to_pointer<io_uring_cqe>(m_cq.m_data, params.cq_off.cqes);
+    m_sqe_base = static_cast<io_uring_sqe*>(m_sqes.m_data);
+    m_sq_entries = params.sq_entries;
+    m_sqe_tail = *m_sq_tail;
+}
+
+Network::IoUring::~IoUring() noexcept
+{
+    unmap(m_sqes);
+    unmap(m_cq);
+    unmap(m_sq);
+    static_cast<void>(::close(m_handle));
+}
+
+auto Network::IoUring::get_sqe() noexcept -> io_uring_sqe*
+{
+    const auto head {
+        std::atomic_ref {*m_sq_head}.load(std::memory_order_acquire)
+    };
+
+    if (m_sqe_tail - head >= m_sq_entries) {
+        return nullptr;
+    }
+
+    const auto index {m_sqe_tail & m_sq_mask};
+    auto* sqe {m_sqe_base + index};  // NOLINT
+    *sqe = {};
+    m_sq_array[index] = index;  // NOLINT
+    ++m_sqe_tail;
+    return sqe;
+}
+
+auto Network::IoUring::is_overflowed() const noexcept -> bool
+{
+    const auto flags {
+        std::atomic_ref {*m_sq_flags}.load(std::memory_order_acquire)
+    };
+    return (flags & IORING_SQ_CQ_OVERFLOW) != 0;
+}
+
+auto Network::IoUring::peek_cqe() const noexcept -> const io_uring_cqe*
+{
+    const auto head {*m_cq_head};
+    const auto tail {
+        std::atomic_ref {*m_cq_tail}.load(std::memory_order_acquire)
+    };
+
+    if (head == tail) {
+        return nullptr;
+    }
+
+    return m_cqe_base + (head & m_cq_mask);  // NOLINT
+}
+
+auto Network::IoUring::seen_cqe() noexcept -> void
+{
+    std::atomic_ref {*m_cq_head}.store(*m_cq_head + 1,
+                                       std::memory_order_release);
+}
+
+auto Network::IoUring::flush() -> OsError
+{
+    return enter(0, 0, IORING_ENTER_GETEVENTS);
+}
+
+auto Network::IoUring::register_buffers(std::span<const iovec> t_iovecs) ->
+    OsError
+{
+    if (m_has_buffers) {
+        trace(m_rt->tracer(), [&](std::ostream& os) {
+            // clang-format off
+            os << "Calling ::io_uring_register("
+               << m_handle
+               << ", IORING_UNREGISTER_BUFFERS, nullptr, 0)";
+            // clang-format on
+        });
+
+        reset_api_error();
+
+        if (::syscall(__NR_io_uring_register, m_handle,
+                      IORING_UNREGISTER_BUFFERS, nullptr, 0) == socket_error) {
+            const SystemCall call {
+                .m_name = "::io_uring_register",
+                .m_arguments = [](std::ostream& os,
+                                  const SystemCall& t_call) {
+                    // clang-format off
+                    os << t_call.m_handle
+                       << ", IORING_UNREGISTER_BUFFERS, nullptr, 0";
+                    // clang-format on
+                },
+                .m_handle = m_handle,
+            };
+            return to_call_error(call);
+        }
+
+        m_has_buffers = false;
+    }
+
+    if (t_iovecs.empty()) {
+        return {};
+    }
+
+    trace(m_rt->tracer(), [&](std::ostream& os) {
+        // clang-format off
+        os << "Calling ::io_uring_register("
+           << m_handle
+           << ", IORING_REGISTER_BUFFERS, ..., "
+           << t_iovecs.size()
+           << ')';
+        // clang-format on
+    });
+
+    reset_api_error();
+
+    if (::syscall(__NR_io_uring_register, m_handle,
+                  IORING_REGISTER_BUFFERS, t_iovecs.data(),
+                  t_iovecs.size()) == socket_error) {
+        const SystemCall call {
+            .m_name = "::io_uring_register",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", IORING_REGISTER_BUFFERS, ..., "
+                   << t_call.m_values[0];
+                // clang-format on
+            },
+            .m_values = {static_cast<std::int64_t>(t_iovecs.size())},
+            .m_handle = m_handle,
+        };
+        return to_call_error(call);
+    }
+
+    m_has_buffers = true;
+    return {};
+}
+
+auto Network::IoUring::submit(unsigned t_wait) -> OsError
+{
+    std::atomic_ref {*m_sq_tail}.store(m_sqe_tail, std::memory_order_release);
+    const auto head {
+        std::atomic_ref {*m_sq_head}.load(std::memory_order_acquire)
+    };
+    const auto count {m_sqe_tail - head};
+    const auto flags {t_wait > 0 ? IORING_ENTER_GETEVENTS : 0U};
+    return enter(count, t_wait, flags);
+}
+
+auto Network::IoUring::enter(unsigned t_count,
+                             unsigned t_wait,
+                             unsigned t_flags) -> OsError
+{
+    trace(m_rt->tracer(), [&](std::ostream& os) {
+        // clang-format off
+        os << "Calling ::io_uring_enter("
+           << m_handle
+           << ", "
+           << t_count
+           << ", "
+           << t_wait
+           << ", "
+           << t_flags
+           << ", nullptr, 0)";
+        // clang-format on
+    });
+
+    reset_api_error();
+
+    if (::syscall(__NR_io_uring_enter, m_handle, t_count, t_wait, t_flags,
+                  nullptr, 0) == socket_error) {
+        const auto api_error {get_api_error()};
+
+        if (api_error == EINTR) {
+            return {};
+        }
+
+        // Entering the ring is the hot path, so the message is only
+        // formatted if it is asked for.
+        const SystemCall call {
+            .m_name = "::io_uring_enter",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", "
+                   << t_call.m_values[0]
+                   << ", "
+                   << t_call.m_values[1]
+                   << ", "
+                   << t_call.m_values[2]
+                   << ", nullptr, 0";
+                // clang-format on
+            },
+            .m_values = {t_count, t_wait, t_flags},
+            .m_handle = m_handle,
+        };
+        return {to_os_error(api_error), api_error, call};
+    }
+
+    return {};
+}
+
+auto Network::IoUring::map(Region& t_region, std::size_t t_size,
+                           long long t_offset) -> void
+{
+    reset_api_error();
+    auto* data {::mmap(nullptr, t_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, m_handle, t_offset)};
+
+    if (data == MAP_FAILED) {  // NOLINT
+        const SystemCall call {
+            .m_name = "::mmap",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << "nullptr, "
+                   << t_call.m_values[0]
+                   << ", PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, "
+                   << t_call.m_handle
+                   << ", "
+                   << t_call.m_values[1];
+                // clang-format on
+            },
+            .m_values = {static_cast<std::int64_t>(t_size), t_offset},
+            .m_handle = m_handle,
+        };
+        throw Error {to_call_error(call)};
+    }
+
+    t_region.m_data = data;
+    t_region.m_size = t_size;
+}
+
+auto Network::IoUring::unmap(Region& t_region) noexcept -> void
+{
+    if (t_region.m_data != nullptr) {
+        static_cast<void>(::munmap(t_region.m_data, t_region.m_size));
+        t_region = {};
+    }
+}
+
+#endif
@@ -0,0 +1,473 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/open-connectoptions.hpp"     // open()
+#include "network/bytespan.hpp"                 // ByteSpan
+#include "network/connectoptions.hpp"           // ConnectOptions
+#include "network/create-socketresult.hpp"      // create_socketresult()
+#include "network/format-os-error.hpp"          // format_os_error()
+#include "network/get-api-error.hpp"            // get_api_error()
+#include "network/get-sa-span.hpp"              // get_sa_span()
+#include "network/get-socketoption.hpp"         // get_option()
+#include "network/insert-endpoint.hpp"          // insert()
+#include "network/iocounter.hpp"                // IoCounter
+#include "network/iolatency.hpp"                // IoLatency
+#include "network/iostats.hpp"                  // IoStats
+#include "network/open-handle.hpp"              // open()
+#include "network/openinputs.hpp"               // OpenInputs
+#include "network/opensymbol.hpp"               // OpenSymbol
+#include "network/oserror.hpp"                  // OsError
+#include "network/reset-api-error.hpp"          // reset_api_error()
+#include "network/runtime.hpp"                  // Runtime
+#include "network/socket-error.hpp"             // socket_error
+#include "network/socketcore.hpp"               // SocketCore
+#include "network/socketoptions.hpp"            // SocketError
+#include "network/socketresult.hpp"             // SocketResult
+#include "network/sockettemplate.hpp"           // SocketTemplate
+#include "network/sockettemplatevector.hpp"     // SocketTemplateVector
+#include "network/systemcall.hpp"               // SystemCall
+#include "network/to-os-error.hpp"              // to_os_error()
+#include "network/to-size.hpp"                  // to_size()
+#include "network/to-string-bytespan.hpp"       // to_string()
+#include "network/trace.hpp"                    // trace()
+#include "network/uniquesocket.hpp"             // UniqueSocket
+
+#include <poll.h>           // POLLOUT, nfds_t, pollfd, ::poll()
+#include <sys/socket.h>     // MSG_FASTOPEN, ::sendto()
+
+#include <algorithm>    // std::clamp(), std::min()
+#include <cerrno>       // EINPROGRESS, EINTR, EOPNOTSUPP, ETIMEDOUT
+#include <chrono>       // std::chrono::ceil(),
+                        // std::chrono::milliseconds,
+                        // std::chrono::steady_clock
+#include <climits>      // INT_MAX
+#include <cstddef>      // std::ptrdiff_t, std::size_t
+#include <cstdint>      // std::int64_t, std::uint64_t
+#include <expected>     // std::expected, std::unexpected
+#include <iterator>     // std::back_inserter()
+#include <ostream>      // std::ostream
+#include <sstream>      // std::ostringstream
+#include <string_view>  // std::string_view
+#include <utility>      // std::move()
+#include <vector>       // std::vector
+
+namespace
+{
+    using Network::ByteSpan;
+    using Network::ConnectOptions;
+    using Network::IoCounter;
+    using Network::IoLatency;
+    using Network::OpenInputs;
+    using Network::OpenSymbol;
+    using Network::OsError;
+    using Network::SocketCore;
+    using Network::SocketError;
+    using Network::SocketTemplate;
+    using Network::SocketTemplateVector;
+    using Network::SystemCall;
+    using Network::UniqueSocket;
+    using Network::create_socketresult;
+    using Network::format_os_error;
+    using Network::get_api_error;
+    using Network::get_option;
+    using Network::get_sa_span;
+    using Network::reset_api_error;
+    using Network::socket_error;
+    using Network::to_os_error;
+    using Network::to_size;
+    using Network::to_string;
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Attempt
+    {
+        UniqueSocket m_socket;
+        const SocketTemplate* m_st {nullptr};
+        std::size_t m_sent {0};
+        SocketCore::Clock::time_point m_start {};
+        bool m_is_connected {false};
+    };
+
+    using AttemptResult = std::expected<Attempt, OsError>;
+
+    auto to_timeout(Clock::duration duration) -> int
+    {
+        const auto ms {std::chrono::ceil<std::chrono::milliseconds>(duration)};
+        return static_cast<int>(std::clamp<Clock::rep>(ms.count(), 0,
+                                                       INT_MAX));
+    }
+
+    // Alternate between address families, starting with the family
+    // of the first address returned, as in RFC 8305 section 4.
+    auto interleave(const SocketTemplateVector& stv) -> SocketTemplateVector
+    {
+        SocketTemplateVector first;
+        SocketTemplateVector second;
+        SocketTemplateVector result;
+
+        for (const auto& st : stv) {
+            auto& v {st.hints().m_family == stv.front().hints().m_family ?
+                     first : second};
+            v.push_back(st);
+        }
+
+        for (std::size_t i {0}; i < first.size() || i < second.size(); ++i) {
+            if (i < first.size()) {
+                result.push_back(first[i]);
+            }
+
+            if (i < second.size()) {
+                result.push_back(second[i]);
+            }
+        }
+
+        return result;
+    }
+
+#ifdef MSG_FASTOPEN
+    // Start connecting with the data in the SYN when the kernel holds
+    // a Fast Open cookie for the peer, or request a cookie otherwise.
+    auto fast_open(const SocketCore& sc,
+                   ByteSpan bs,
+                   std::string_view data) ->
+        std::expected<std::size_t, OsError>
+    {
+        const auto [sa, salen] {get_sa_span(bs)};
+        const auto handle {sc.handle()};
+
+        trace(sc.tracer(), [&](std::ostream& os) {
+            // clang-format off
+            os << "Calling ::sendto("
+               << handle
+               << ", ..., "
+               << data.size()
+               << ", MSG_FASTOPEN, "
+               << to_string(bs)
+               << ", "
+               << salen
+               << ')';
+            // clang-format on
+        });
+
+        sc.count(IoCounter::system_calls);
+        reset_api_error();
+        const auto ssize {::sendto(handle, data.data(), data.size(),
+                                   MSG_FASTOPEN, sa, salen)};
+
+        if (ssize == socket_error) {
+            const auto api_error {get_api_error()};
+            const auto os_error {to_os_error(api_error)};
+            sc.count_error(os_error);
+            const SystemCall call {
+                .m_name = "::sendto",
+                .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                    // clang-format off
+                    os << t_call.m_handle
+                       << ", ..., "
+                       << t_call.m_values[0]
+                       << ", MSG_FASTOPEN, "
+                       << to_string(t_call.m_address)
+                       << ", "
+                       << t_call.m_values[1];
+                    // clang-format on
+                },
+                .m_address = bs,
+                .m_values = {static_cast<std::int64_t>(data.size()), salen},
+                .m_handle = handle,
+            };
+            return std::unexpected {OsError {os_error, api_error, call}};
+        }
+
+        sc.count(IoCounter::bytes_written, static_cast<std::uint64_t>(ssize));
+        return to_size(ssize);
+    }
+#endif
+
+    auto connect(Attempt& attempt, const ConnectOptions& options) -> OsError
+    {
+        const auto& sc {attempt.m_socket->core()};
+        const auto bs {attempt.m_st->address()};
+
+#ifdef MSG_FASTOPEN
+        if (options.m_is_fastopen && !options.m_data.empty()) {
+            const auto result {fast_open(sc, bs, options.m_data)};
+
+            if (result) {
+                attempt.m_sent = *result;
+                return {};
+            }
+
+            // Fall back to a plain connect if client support is
+            // disabled in the kernel.
+            if (result.error().number() != EOPNOTSUPP) {
+                return result.error();
+            }
+        }
+#else
+        static_cast<void>(options);
+#endif
+
+        // A connect completing at once has already been counted and
+        // timed by open().
+        const auto error {open(sc, bs, OpenSymbol::connect)};
+        attempt.m_is_connected = !error;
+        return error;
+    }
+
+    auto start(const SocketTemplate& st,
+               const OpenInputs& oi,
+               const ConnectOptions& options) -> AttemptResult
+    {
+        auto result {create_socketresult(st.hints(), oi.runtime())};
+
+        if (!result) {
+            return std::unexpected {result.error()};
+        }
+
+        Attempt attempt {std::move(*result), &st};
+
+        if (auto error {attempt.m_socket->set_nonblocking(true)}) {
+            return std::unexpected {error};
+        }
+
+        attempt.m_start = attempt.m_socket->core().now();
+
+        if (auto error {connect(attempt, options)};
+            error && error.number() != EINPROGRESS) {
+            return std::unexpected {error};
+        }
+
+        return attempt;
+    }
+
+    auto get_error(const Attempt& attempt) -> OsError
+    {
+        if (attempt.m_is_connected) {
+            return {};
+        }
+
+        const auto& sc {attempt.m_socket->core()};
+        const auto result {get_option<SocketError>(sc)};
+
+        if (!result) {
+            return result.error();
+        }
+
+        sc.record(IoLatency::connect, attempt.m_start);
+
+        if (*result == 0) {
+            sc.count(IoCounter::connects);
+            return {};
+        }
+
+        const auto api_error {*result};
+        const auto os_error {to_os_error(api_error)};
+        sc.count_error(os_error);
+        const auto bs {attempt.m_st->address()};
+        const SystemCall call {
+            .m_name = "::connect",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", "
+                   << to_string(t_call.m_address)
+                   << ", "
+                   << t_call.m_address.size();
+                // clang-format on
+            },
+            .m_address = bs,
+            .m_handle = sc.handle(),
+        };
+        return {os_error, api_error, call};
+    }
+
+    auto poll(std::vector<pollfd>& pfds,
+              int timeout,
+              const OpenInputs& oi) -> OsError
+    {
+        const auto nfds {static_cast<nfds_t>(pfds.size())};
+        auto* const stats {oi.runtime()->stats()};
+
+        trace(oi.runtime()->tracer(), [&](std::ostream& os) {
+            // clang-format off
+            os << "Calling ::poll(..., "
+               << nfds
+               << ", "
+               << timeout
+               << ')';
+            // clang-format on
+        });
+
+        if (stats != nullptr) {
+            stats->add(IoCounter::system_calls);
+        }
+
+        reset_api_error();
+
+        if (::poll(pfds.data(), nfds, timeout) == socket_error) {
+            const auto api_error {get_api_error()};
+
+            if (api_error == EINTR) {
+                return {};
+            }
+
+            const auto os_error {to_os_error(api_error)};
+
+            if (stats != nullptr) {
+                stats->add_error(os_error);
+            }
+
+            const SystemCall call {
+                .m_name = "::poll",
+                .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                    // clang-format off
+                    os << "..., "
+                       << t_call.m_values[0]
+                       << ", "
+                       << t_call.m_values[1];
+                    // clang-format on
+                },
+                .m_values = {static_cast<std::int64_t>(nfds), timeout},
+            };
+            return {os_error, api_error, call};
+        }
+
+        return {};
+    }
+
+    // Restore blocking mode on the winning socket, and send any data
+    // that did not fit in the SYN.
+    auto finish(Attempt& attempt, const ConnectOptions& options) -> OsError
+    {
+        const auto& socket {*attempt.m_socket};
+
+        if (auto error {socket.set_nonblocking(false)}) {
+            return error;
+        }
+
+        auto data {options.m_data.substr(std::min(attempt.m_sent,
+                                                  options.m_data.size()))};
+
+        while (!data.empty()) {
+            data.remove_prefix(to_size(socket.write(data)));
+        }
+
+        return {};
+    }
+}
+
+auto Network::open(const OpenInputs& oi,
+                   const ConnectOptions& options) -> SocketResult
+{
+    SocketTemplateVector stv;
+
+    if (const auto error = insert(std::back_inserter(stv), oi)) {
+        return std::unexpected {error};
+    }
+
+    const auto templates {interleave(stv)};
+    const auto deadline {Clock::now() + options.m_timeout};
+    auto next_start {Clock::now()};
+    std::size_t next {0};
+    std::vector<Attempt> attempts;
+    std::vector<pollfd> pfds;
+    OsError last_error;
+    auto is_timed_out {false};
+
+    while (next < templates.size() || !attempts.empty()) {
+        const auto now {Clock::now()};
+
+        if (now >= deadline) {
+            is_timed_out = true;
+            break;
+        }
+
+        // Start the next attempt once the previous one has had its
+        // head start, or as soon as none is pending.
+        if (next < templates.size() &&
+            (attempts.empty() || now >= next_start)) {
+            auto result {start(templates[next++], oi, options)};
+
+            if (!result) {
+                last_error = result.error();
+                next_start = now;
+                continue;
+            }
+
+            attempts.push_back(std::move(*result));
+            next_start = now + options.m_attempt_delay;
+            continue;
+        }
+
+        const auto until {next < templates.size() ?
+                          std::min(next_start, deadline) : deadline};
+        pfds.clear();
+
+        for (const auto& attempt : attempts) {
+            pfds.push_back({attempt.m_socket->core().handle(), POLLOUT, 0});
+        }
+
+        if (auto error {poll(pfds, to_timeout(until - now), oi)}) {
+            return std::unexpected {error};
+        }
+
+        // Walk backwards so that erasing keeps the indices of the
+        // attempts still to be checked.
+        for (auto i {pfds.size()}; i-- > 0;) {
+            if (pfds[i].revents == 0) {
+                continue;
+            }
+
+            if (auto error {get_error(attempts[i])}) {
+                last_error = error;
+                attempts.erase(attempts.begin() +
+                               static_cast<std::ptrdiff_t>(i));
+
+                // A failed attempt lets the next one start at once.
+                next_start = Clock::now();
+                continue;
+            }
+
+            auto& winner {attempts[i]};
+
+            if (auto error {finish(winner, options)}) {
+                return std::unexpected {error};
+            }
+
+            // The other attempts are abandoned, and their sockets
+            // closed, when the vector is destroyed.
+            return std::move(winner.m_socket);
+        }
+    }
+
+    if (is_timed_out || !last_error) {
+        const auto os_error {to_os_error(ETIMEDOUT)};
+        std::ostringstream oss;
+        // clang-format off
+        oss << "Connection attempts timed out after "
+            << std::chrono::ceil<std::chrono::milliseconds>(options.m_timeout)
+                .count()
+            << " ms: "
+            << format_os_error(os_error);
+        // clang-format on
+        return std::unexpected {OsError {os_error, oss.str()}};
+    }
+
+    return std::unexpected {last_error};
+}
+
+#endif
@@ -0,0 +1,107 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/read-charspans.hpp"   // read()
+#include "network/charspan.hpp"         // CharSpan
+#include "network/error.hpp"            // Error
+#include "network/get-api-error.hpp"    // get_api_error()
+#include "network/iocounter.hpp"        // IoCounter
+#include "network/oserror.hpp"          // OsError
+#include "network/quote-charspans.hpp"  // quote()
+#include "network/reset-api-error.hpp"  // reset_api_error()
+#include "network/smallvector.hpp"      // SmallVector
+#include "network/socket-error.hpp"     // socket_error
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/systemcall.hpp"       // SystemCall
+#include "network/to-os-error.hpp"      // to_os_error()
+#include "network/trace.hpp"            // trace()
+
+#include <sys/types.h>      // ssize_t
+#include <sys/uio.h>        // iovec, ::readv()
+
+#include <algorithm>    // std::ranges::transform()
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t
+#include <ostream>      // std::ostream
+#include <span>         // std::span
+
+auto Network::read(const SocketCore& sc,
+                   std::span<const CharSpan> css) -> ssize_t
+{
+    const auto handle {sc.handle()};
+    auto* const tracer {sc.tracer()};
+    SmallVector<iovec> storage {css.size()};
+    const auto iov {storage.span()};
+    std::ranges::transform(css, iov.begin(), [](CharSpan cs) {
+        return iovec {cs.data(), cs.size()};
+    });
+    const auto iov_count {static_cast<int>(iov.size())};
+
+    trace(tracer, [&](std::ostream& os) {
+        // clang-format off
+        os << "Calling ::readv("
+           << handle
+           << ", "
+           << quote(css)
+           << ", "
+           << iov_count
+           << ')';
+        // clang-format on
+    });
+
+    sc.count(IoCounter::system_calls);
+    reset_api_error();
+    const auto ssize {::readv(handle, iov.data(), iov_count)};
+
+    if (ssize == socket_error) {
+        const auto api_error {get_api_error()};
+        const auto os_error {to_os_error(api_error)};
+        sc.count_error(os_error);
+        const SystemCall call {
+            .m_name = "::readv",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", ..., "
+                   << t_call.m_values[0];
+                // clang-format on
+            },
+            .m_values = {iov_count},
+            .m_handle = handle,
+        };
+        throw Error {OsError {os_error, api_error, call}};
+    }
+
+    sc.count(IoCounter::bytes_read, static_cast<std::uint64_t>(ssize));
+
+    trace(tracer, [&](std::ostream& os) {
+        // clang-format off
+        os << "Call to ::readv("
+           << handle
+           << ", "
+           << quote(css)
+           << ", "
+           << iov_count
+           << ") returned data "
+           << quote(css, static_cast<std::size_t>(ssize));
+        // clang-format on
+    });
+
+    return ssize;
+}
+
+#endif
@@ -0,0 +1,99 @@
+// Copyright (C) 2023  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/read-result.hpp"      // read_result()
+#include "network/charspan.hpp"         // CharSpan
+#include "network/get-api-error.hpp"    // get_api_error()
+#include "network/iocounter.hpp"        // IoCounter
+#include "network/oserror.hpp"          // OsError
+#include "network/quote.hpp"            // quote()
+#include "network/reset-api-error.hpp"  // reset_api_error()
+#include "network/sizeresult.hpp"       // SizeResult
+#include "network/socket-error.hpp"     // socket_error
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/systemcall.hpp"       // SystemCall
+#include "network/to-os-error.hpp"      // to_os_error()
+#include "network/trace.hpp"            // trace()
+
+#include <sys/types.h>      // ssize_t
+#include <unistd.h>         // ::read()
+
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::int64_t, std::uint64_t
+#include <expected>     // std::unexpected
+#include <ostream>      // std::ostream
+#include <string_view>  // std::string_view
+
+auto Network::read_result(const SocketCore& sc,
+                          CharSpan cs) -> SizeResult
+{
+    const std::string_view sv {cs.data(), cs.size()};
+    const auto handle {sc.handle()};
+    auto* const tracer {sc.tracer()};
+
+    trace(tracer, [&](std::ostream& os) {
+        // clang-format off
+        os << "Calling ::read("
+           << handle
+           << ", ..., "
+           << cs.size()
+           << ')';
+        // clang-format on
+    });
+
+    sc.count(IoCounter::system_calls);
+    reset_api_error();
+    const auto error {::read(handle, cs.data(), cs.size())};
+
+    if (error == socket_error) {
+        const auto api_error {get_api_error()};
+        const auto os_error {to_os_error(api_error)};
+        sc.count_error(os_error);
+        const SystemCall call {
+            .m_name = "::read",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", ..., "
+                   << t_call.m_values[0];
+                // clang-format on
+            },
+            .m_values = {static_cast<std::int64_t>(cs.size())},
+            .m_handle = handle,
+        };
+        return std::unexpected {OsError {os_error, api_error, call}};
+    }
+
+    sc.count(IoCounter::bytes_read, static_cast<std::uint64_t>(error));
+
+    // A pooled buffer is neither cleared nor private to a connection,
+    // so only the bytes read are traced.
+    trace(tracer, [&](std::ostream& os) {
+        // clang-format off
+        os << "Call to ::read("
+           << handle
+           << ", ..., "
+           << cs.size()
+           << ") returned data "
+           << quote(sv.substr(0, static_cast<std::size_t>(error)));
+        // clang-format on
+    });
+
+    return error;
+}
+
+#endif
@@ -0,0 +1,168 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/reap-zerocopy.hpp"    // reap_zerocopy()
+
+#ifdef HAVE_ZEROCOPY
+
+#include "network/error.hpp"            // Error
+#include "network/get-api-error.hpp"    // get_api_error()
+#include "network/iocounter.hpp"        // IoCounter
+#include "network/oserror.hpp"          // OsError
+#include "network/reset-api-error.hpp"  // reset_api_error()
+#include "network/socket-error.hpp"     // socket_error
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/systemcall.hpp"       // SystemCall
+#include "network/to-os-error.hpp"      // to_os_error()
+#include "network/trace.hpp"            // trace()
+#include "network/zerocopycompletion.hpp" // ZeroCopyCompletion
+
+#include <linux/errqueue.h> // SO_EE_CODE_ZEROCOPY_COPIED,
+                            // SO_EE_ORIGIN_ZEROCOPY,
+                            // sock_extended_err
+#include <netinet/in.h>     // IPPROTO_IP, IPPROTO_IPV6, IPV6_RECVERR,
+                            // IP_RECVERR, sockaddr_in6
+#include <sys/socket.h>     // CMSG_DATA(), CMSG_FIRSTHDR(),
+                            // CMSG_NXTHDR(), CMSG_SPACE(),
+                            // MSG_CTRUNC, MSG_DONTWAIT,
+                            // MSG_ERRQUEUE, cmsghdr, msghdr,
+                            // ::recvmsg()
+
+#include <array>        // std::array
+#include <cerrno>       // EAGAIN, EWOULDBLOCK
+#include <cstddef>      // std::byte, std::size_t
+#include <cstring>      // std::memcpy()
+#include <ostream>      // std::ostream
+#include <span>         // std::span
+
+namespace
+{
+    // The kernel follows the extended error with the address of the
+    // offending node, which for a zero-copy notification is unset.
+    using ControlBuffer =
+        std::array<std::byte, CMSG_SPACE(sizeof(sock_extended_err) +
+                                         sizeof(sockaddr_in6))>;
+
+    auto is_complete(const msghdr& msg, cmsghdr* cmsg) noexcept -> bool
+    {
+        const auto* const begin {
+            static_cast<const std::byte*>(msg.msg_control)
+        };
+        const auto* const data {
+            static_cast<const std::byte*>(
+                static_cast<const void*>(CMSG_DATA(cmsg)))
+        };
+        return data + sizeof(sock_extended_err) <=
+            begin + msg.msg_controllen;
+    }
+
+    auto is_recverr(const cmsghdr& cmsg) noexcept -> bool
+    {
+        return (cmsg.cmsg_level == IPPROTO_IP &&
+                cmsg.cmsg_type == IP_RECVERR) ||
+            (cmsg.cmsg_level == IPPROTO_IPV6 &&
+             cmsg.cmsg_type == IPV6_RECVERR);
+    }
+}
+
+auto Network::reap_zerocopy(const SocketCore& sc,
+                            std::span<ZeroCopyCompletion> completions) ->
+    std::size_t
+{
+    const auto handle {sc.handle()};
+    auto* const tracer {sc.tracer()};
+    std::size_t count {0};
+
+    // Each ::recvmsg() call dequeues one notification, which the
+    // kernel may have coalesced to cover several sends.
+    while (count < completions.size()) {
+        alignas(cmsghdr) ControlBuffer control {};
+        msghdr msg {};
+        msg.msg_control = control.data();
+        msg.msg_controllen = control.size();
+
+        trace(tracer, [&](std::ostream& os) {
+            // clang-format off
+            os << "Calling ::recvmsg("
+               << handle
+               << ", ..., MSG_ERRQUEUE | MSG_DONTWAIT)";
+            // clang-format on
+        });
+
+        sc.count(IoCounter::system_calls);
+        reset_api_error();
+
+        if (::recvmsg(handle, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) ==
+            socket_error) {
+            const auto api_error {get_api_error()};
+
+            if (api_error == EAGAIN || api_error == EWOULDBLOCK) {
+                sc.count(IoCounter::again);
+                break;
+            }
+
+            const auto os_error {to_os_error(api_error)};
+            sc.count_error(os_error);
+            const SystemCall call {
+                .m_name = "::recvmsg",
+                .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                    // clang-format off
+                    os << t_call.m_handle
+                       << ", ..., MSG_ERRQUEUE | MSG_DONTWAIT";
+                    // clang-format on
+                },
+                .m_handle = handle,
+            };
+            throw Error {OsError {os_error, api_error, call}};
+        }
+
+        // Ancillary data that did not fit is discarded by the kernel,
+        // so a truncated header is read only as far as it was copied.
+        const auto is_truncated {(msg.msg_flags & MSG_CTRUNC) != 0};
+
+        for (auto* cmsg {CMSG_FIRSTHDR(&msg)};
+             cmsg != nullptr;
+             cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+            if (is_truncated && !is_complete(msg, cmsg)) {
+                trace(tracer, [&](std::ostream& os) {
+                    os << "Discarding truncated zero-copy notification";
+                });
+                break;
+            }
+
+            if (!is_recverr(*cmsg)) {
+                continue;
+            }
+
+            sock_extended_err error {};
+            std::memcpy(&error, CMSG_DATA(cmsg), sizeof error);
+
+            if (error.ee_errno != 0 ||
+                error.ee_origin != SO_EE_ORIGIN_ZEROCOPY) {
+                continue;
+            }
+
+            auto& completion {completions[count++]};
+            completion.m_first = error.ee_info;
+            completion.m_last = error.ee_data;
+            completion.m_is_copied =
+                (error.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0;
+        }
+    }
+
+    return count;
+}
+
+#endif
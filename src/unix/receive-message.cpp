@@ -0,0 +1,126 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/receive-message.hpp"  // receive_message()
+#include "network/charspan.hpp"         // CharSpan
+#include "network/error.hpp"            // Error
+#include "network/get-api-error.hpp"    // get_api_error()
+#include "network/iocounter.hpp"        // IoCounter
+#include "network/messagedata.hpp"      // MessageData
+#include "network/oserror.hpp"          // OsError
+#include "network/quote-charspans.hpp"  // quote()
+#include "network/reset-api-error.hpp"  // reset_api_error()
+#include "network/smallvector.hpp"      // SmallVector
+#include "network/socket-error.hpp"     // socket_error
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/systemcall.hpp"       // SystemCall
+#include "network/to-os-error.hpp"      // to_os_error()
+#include "network/trace.hpp"            // trace()
+
+#include <sys/socket.h>     // msghdr, ::recvmsg()
+#include <sys/uio.h>        // iovec
+
+#include <algorithm>    // std::ranges::transform()
+#include <cstddef>      // std::byte, std::size_t
+#include <cstdint>      // std::int64_t, std::uint64_t
+#include <ostream>      // std::ostream
+#include <span>         // std::span
+
+auto Network::receive_message(const SocketCore& sc,
+                              std::span<const CharSpan> css,
+                              std::span<std::byte> control,
+                              int flags) -> MessageData
+{
+    const auto handle {sc.handle()};
+    auto* const tracer {sc.tracer()};
+    SmallVector<iovec> storage {css.size()};
+    const auto iov {storage.span()};
+    std::ranges::transform(css, iov.begin(), [](CharSpan cs) {
+        return iovec {cs.data(), cs.size()};
+    });
+    msghdr msg {};
+    msg.msg_iov = iov.data();
+    msg.msg_iovlen = static_cast<decltype(msg.msg_iovlen)>(iov.size());
+    msg.msg_control = control.empty() ? nullptr : control.data();
+    msg.msg_controllen =
+        static_cast<decltype(msg.msg_controllen)>(control.size());
+
+    trace(tracer, [&](std::ostream& os) {
+        // clang-format off
+        os << "Calling ::recvmsg("
+           << handle
+           << ", {"
+           << quote(css)
+           << ", "
+           << control.size()
+           << "}, "
+           << flags
+           << ')';
+        // clang-format on
+    });
+
+    sc.count(IoCounter::system_calls);
+    reset_api_error();
+    const auto ssize {::recvmsg(handle, &msg, flags)};
+
+    if (ssize == socket_error) {
+        const auto api_error {get_api_error()};
+        const auto os_error {to_os_error(api_error)};
+        sc.count_error(os_error);
+        const SystemCall call {
+            .m_name = "::recvmsg",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", {..., "
+                   << t_call.m_values[0]
+                   << "}, "
+                   << t_call.m_values[1];
+                // clang-format on
+            },
+            .m_values = {static_cast<std::int64_t>(control.size()), flags},
+            .m_handle = handle,
+        };
+        throw Error {OsError {os_error, api_error, call}};
+    }
+
+    sc.count(IoCounter::bytes_read, static_cast<std::uint64_t>(ssize));
+
+    trace(tracer, [&](std::ostream& os) {
+        // clang-format off
+        os << "Call to ::recvmsg("
+           << handle
+           << ", {"
+           << quote(css)
+           << ", "
+           << control.size()
+           << "}, "
+           << flags
+           << ") returned data {"
+           << ssize
+           << ", "
+           << msg.msg_controllen
+           << ", "
+           << msg.msg_flags
+           << '}';
+        // clang-format on
+    });
+
+    return {ssize, static_cast<std::size_t>(msg.msg_controllen), msg.msg_flags};
+}
+
+#endif
@@ -0,0 +1,99 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/send-batch.hpp"       // send_batch()
+
+#ifdef HAVE_RECVMMSG
+
+#include "network/datagrambatch.hpp"    // DatagramBatch
+#include "network/error.hpp"            // Error
+#include "network/get-api-error.hpp"    // get_api_error()
+#include "network/iocounter.hpp"        // IoCounter
+#include "network/logicerror.hpp"       // LogicError
+#include "network/oserror.hpp"          // OsError
+#include "network/reset-api-error.hpp"  // reset_api_error()
+#include "network/socket-error.hpp"     // socket_error
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/systemcall.hpp"       // SystemCall
+#include "network/to-os-error.hpp"      // to_os_error()
+#include "network/to-size.hpp"          // to_size()
+#include "network/trace.hpp"            // trace()
+
+#include <sys/socket.h>     // ::sendmmsg()
+
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t
+#include <ostream>      // std::ostream
+
+auto Network::send_batch(const SocketCore& sc,
+                         DatagramBatch& batch,
+                         std::size_t count,
+                         int flags) -> std::size_t
+{
+    if (count > batch.capacity()) {
+        throw LogicError {"Batch count exceeds capacity"};
+    }
+
+    const auto headers {batch.headers()};
+    const auto handle {sc.handle()};
+    const auto vlen {static_cast<unsigned>(count)};
+
+    trace(sc.tracer(), [&](std::ostream& os) {
+        // clang-format off
+        os << "Calling ::sendmmsg("
+           << handle
+           << ", ..., "
+           << vlen
+           << ", "
+           << flags
+           << ')';
+        // clang-format on
+    });
+
+    sc.count(IoCounter::system_calls);
+    reset_api_error();
+    const auto sent {::sendmmsg(handle, headers.data(), vlen, flags)};
+
+    if (sent == socket_error) {
+        const auto api_error {get_api_error()};
+        const auto os_error {to_os_error(api_error)};
+        sc.count_error(os_error);
+        const SystemCall call {
+            .m_name = "::sendmmsg",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", ..., "
+                   << t_call.m_values[0]
+                   << ", "
+                   << t_call.m_values[1];
+                // clang-format on
+            },
+            .m_values = {vlen, flags},
+            .m_handle = handle,
+        };
+        throw Error {OsError {os_error, api_error, call}};
+    }
+
+    const auto size {to_size(sent)};
+
+    for (std::size_t i {0}; i < size; ++i) {
+        sc.count(IoCounter::bytes_written, headers[i].msg_len);
+    }
+
+    return size;
+}
+
+#endif
@@ -0,0 +1,107 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/send-file-path.hpp"   // send_file()
+
+#ifdef HAVE_SENDFILE
+
+#include "network/error.hpp"            // Error
+#include "network/format-os-error.hpp"  // format_os_error()
+#include "network/get-api-error.hpp"    // get_api_error()
+#include "network/handle-null.hpp"      // handle_null
+#include "network/handle-type.hpp"      // handle_type
+#include "network/pathname.hpp"         // Pathname
+#include "network/reset-api-error.hpp"  // reset_api_error()
+#include "network/send-file.hpp"        // send_file()
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/to-os-error.hpp"      // to_os_error()
+#include "network/trace.hpp"            // trace()
+
+#include <fcntl.h>          // O_CLOEXEC, O_RDONLY, ::open()
+#include <sys/types.h>      // off_t, ssize_t
+#include <unistd.h>         // ::close()
+
+#include <cstddef>      // std::size_t
+#include <ostream>      // std::ostream
+#include <sstream>      // std::ostringstream
+
+namespace
+{
+    class FileHandle
+    {
+    public:
+        explicit FileHandle(Network::handle_type t_handle) noexcept :
+            m_handle(t_handle)
+        {
+        }
+
+        FileHandle() = delete;
+        FileHandle(const FileHandle&) = delete;
+        FileHandle(FileHandle&&) = delete;
+
+        ~FileHandle() noexcept
+        {
+            static_cast<void>(::close(m_handle));
+        }
+
+        auto operator=(const FileHandle&) -> FileHandle& = delete;
+        auto operator=(FileHandle&&) -> FileHandle& = delete;
+
+        explicit operator Network::handle_type() const noexcept
+        {
+            return m_handle;
+        }
+
+    private:
+        Network::handle_type m_handle;
+    };
+}
+
+auto Network::send_file(const SocketCore& sc,
+                        const Pathname& path,
+                        off_t offset,
+                        std::size_t length) -> ssize_t
+{
+    trace(sc.tracer(), [&](std::ostream& os) {
+        // clang-format off
+        os << "Calling ::open("
+           << path
+           << ", O_RDONLY | O_CLOEXEC)";
+        // clang-format on
+    });
+
+    reset_api_error();
+    const auto handle {::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+
+    if (handle == handle_null) {
+        const auto api_error {get_api_error()};
+        const auto os_error {to_os_error(api_error)};
+        std::ostringstream oss;
+        // clang-format off
+        oss << "Call to ::open("
+            << path
+            << ", O_RDONLY | O_CLOEXEC) failed with error "
+            << api_error
+            << ": "
+            << format_os_error(os_error);
+        // clang-format on
+        throw Error {oss.str()};
+    }
+
+    const FileHandle file {handle};
+    return send_file(sc, static_cast<handle_type>(file), offset, length);
+}
+
+#endif
@@ -0,0 +1,122 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/send-file.hpp"        // send_file()
+
+#ifdef HAVE_SENDFILE
+
+#include "network/error.hpp"            // Error
+#include "network/get-api-error.hpp"    // get_api_error()
+#include "network/handle-type.hpp"      // handle_type
+#include "network/iocounter.hpp"        // IoCounter
+#include "network/oserror.hpp"          // OsError
+#include "network/reset-api-error.hpp"  // reset_api_error()
+#include "network/socket-error.hpp"     // socket_error
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/systemcall.hpp"       // SystemCall
+#include "network/to-os-error.hpp"      // to_os_error()
+#include "network/trace.hpp"            // trace()
+
+#include <sys/sendfile.h>   // ::sendfile()
+#include <sys/types.h>      // off_t, ssize_t
+
+#include <cerrno>       // EINTR
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::int64_t, std::uint64_t
+#include <ostream>      // std::ostream
+
+auto Network::send_file(const SocketCore& sc,
+                        handle_type handle,
+                        off_t offset,
+                        std::size_t length) -> ssize_t
+{
+    const auto socket {sc.handle()};
+    auto* const tracer {sc.tracer()};
+    std::size_t total {0};
+
+    // The kernel may transfer fewer bytes than requested, so repeat
+    // until the whole range is sent or the end of file is reached.
+    // Once some bytes have been sent, a failure ends the transfer
+    // early rather than throwing, so that the caller can resume from
+    // the right offset.
+    while (total < length) {
+        const auto remaining {length - total};
+
+        trace(tracer, [&](std::ostream& os) {
+            // clang-format off
+            os << "Calling ::sendfile("
+               << socket
+               << ", "
+               << handle
+               << ", "
+               << offset
+               << ", "
+               << remaining
+               << ')';
+            // clang-format on
+        });
+
+        sc.count(IoCounter::system_calls);
+        reset_api_error();
+        const auto ssize {::sendfile(socket, handle, &offset, remaining)};
+
+        if (ssize == socket_error) {
+            const auto api_error {get_api_error()};
+
+            if (api_error == EINTR) {
+                continue;
+            }
+
+            const auto os_error {to_os_error(api_error)};
+            sc.count_error(os_error);
+
+            if (total > 0) {
+                break;
+            }
+
+            const SystemCall call {
+                .m_name = "::sendfile",
+                .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                    // clang-format off
+                    os << t_call.m_handle
+                       << ", "
+                       << t_call.m_values[0]
+                       << ", "
+                       << t_call.m_values[1]
+                       << ", "
+                       << t_call.m_values[2];
+                    // clang-format on
+                },
+                .m_values = {handle,
+                             offset,
+                             static_cast<std::int64_t>(remaining)},
+                .m_handle = socket,
+            };
+            throw Error {OsError {os_error, api_error, call}};
+        }
+
+        if (ssize == 0) {
+            break;
+        }
+
+        sc.count(IoCounter::bytes_written,
+                 static_cast<std::uint64_t>(ssize));
+        total += static_cast<std::size_t>(ssize);
+    }
+
+    return static_cast<ssize_t>(total);
+}
+
+#endif
@@ -0,0 +1,108 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/send-to.hpp"                  // send_to()
+#include "network/bytespan.hpp"                 // ByteSpan
+#include "network/error.hpp"                    // Error
+#include "network/get-api-error.hpp"            // get_api_error()
+#include "network/get-sa-span.hpp"              // get_sa_span()
+#include "network/iocounter.hpp"                // IoCounter
+#include "network/oserror.hpp"                  // OsError
+#include "network/quote.hpp"                    // quote()
+#include "network/reset-api-error.hpp"          // reset_api_error()
+#include "network/socket-error.hpp"             // socket_error
+#include "network/socketcore.hpp"               // SocketCore
+#include "network/systemcall.hpp"               // SystemCall
+#include "network/to-os-error.hpp"              // to_os_error()
+#include "network/to-string-bytespan.hpp"       // to_string()
+#include "network/trace.hpp"                    // trace()
+
+#include <sys/socket.h>     // ::sendto()
+#include <sys/types.h>      // ssize_t
+
+#include <cstdint>      // std::int64_t, std::uint64_t
+#include <ostream>      // std::ostream
+#include <string_view>  // std::string_view
+
+auto Network::send_to(const SocketCore& sc,
+                      std::string_view sv,
+                      ByteSpan bs,
+                      int flags) -> ssize_t
+{
+    const auto [sa, salen] {get_sa_span(bs)};
+    const auto handle {sc.handle()};
+
+    trace(sc.tracer(), [&](std::ostream& os) {
+        // clang-format off
+        os << "Calling ::sendto("
+           << handle
+           << ", "
+           << quote(sv)
+           << ", "
+           << sv.size()
+           << ", "
+           << flags
+           << ", "
+           << to_string(bs)
+           << ", "
+           << salen
+           << ')';
+        // clang-format on
+    });
+
+    sc.count(IoCounter::system_calls);
+    reset_api_error();
+    const auto ssize {::sendto(handle,
+                               sv.data(),
+                               sv.size(),
+                               flags,
+                               sa,
+                               salen)};
+
+    if (ssize == socket_error) {
+        const auto api_error {get_api_error()};
+        const auto os_error {to_os_error(api_error)};
+        sc.count_error(os_error);
+        const SystemCall call {
+            .m_name = "::sendto",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", ..., "
+                   << t_call.m_values[0]
+                   << ", "
+                   << t_call.m_values[1]
+                   << ", "
+                   << to_string(t_call.m_address)
+                   << ", "
+                   << t_call.m_values[2];
+                // clang-format on
+            },
+            .m_address = bs,
+            .m_values = {static_cast<std::int64_t>(sv.size()),
+                         flags,
+                         static_cast<std::int64_t>(salen)},
+            .m_handle = handle,
+        };
+        throw Error {OsError {os_error, api_error, call}};
+    }
+
+    sc.count(IoCounter::bytes_written, static_cast<std::uint64_t>(ssize));
+    return ssize;
+}
+
+#endif
@@ -0,0 +1,82 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/set-nonblocking.hpp"  // set_nonblocking()
+#include "network/get-api-error.hpp"    // get_api_error()
+#include "network/oserror.hpp"          // OsError
+#include "network/reset-api-error.hpp"  // reset_api_error()
+#include "network/socket-error.hpp"     // socket_error
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/systemcall.hpp"       // SystemCall
+#include "network/to-os-error.hpp"      // to_os_error()
+#include "network/trace.hpp"            // trace()
+
+#include <fcntl.h>          // F_GETFL, F_SETFL, O_NONBLOCK, ::fcntl()
+
+#include <ostream>      // std::ostream
+
+auto Network::set_nonblocking(const SocketCore& sc,
+                              bool is_nonblocking) -> OsError
+{
+    const auto handle {sc.handle()};
+
+    reset_api_error();
+    auto flags {::fcntl(handle, F_GETFL, 0)};  // NOLINT
+
+    if (flags != socket_error) {
+        if (is_nonblocking) {
+            flags |= O_NONBLOCK;  // NOLINT
+        }
+        else {
+            flags &= ~O_NONBLOCK;  // NOLINT
+        }
+
+        trace(sc.tracer(), [&](std::ostream& os) {
+            // clang-format off
+            os << "Calling ::fcntl("
+               << handle
+               << ", F_SETFL, "
+               << flags
+               << ')';
+            // clang-format on
+        });
+
+        reset_api_error();
+
+        if (::fcntl(handle, F_SETFL, flags) != socket_error) {  // NOLINT
+            return {};
+        }
+    }
+
+    const auto api_error {get_api_error()};
+    const auto os_error {to_os_error(api_error)};
+    const SystemCall call {
+        .m_name = "::fcntl",
+        .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+            // clang-format off
+            os << t_call.m_handle
+               << ", F_SETFL, "
+               << t_call.m_values[0];
+            // clang-format on
+        },
+        .m_values = {flags},
+        .m_handle = handle,
+    };
+    return {os_error, api_error, call};
+}
+
+#endif
@@ -0,0 +1,345 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/shardedlistener.hpp"          // ShardedListener
+
+#if defined(HAVE_ACCEPT4) && defined(HAVE_REUSEPORT)
+
+#include "network/accept-batch.hpp"             // accept_batch()
+#include "network/acceptbatch.hpp"              // AcceptBatch
+#include "network/bind-endpoint.hpp"            // bind()
+#include "network/close.hpp"                    // close()
+#include "network/create-socket-handle.hpp"     // create_socket()
+#include "network/create-socket-hints.hpp"      // create_socket()
+#include "network/endpointview.hpp"             // EndpointView
+#include "network/error.hpp"                    // Error
+#include "network/family-type.hpp"              // family_type
+#include "network/get-sa-family.hpp"            // get_sa_family()
+#include "network/handle-type.hpp"              // handle_type
+#include "network/listen.hpp"                   // listen()
+#include "network/logicerror.hpp"               // LogicError
+#include "network/opensetup.hpp"                // OpenSetup
+#include "network/opensymbol.hpp"               // OpenSymbol
+#include "network/oserror.hpp"                  // OsError
+#include "network/runtime.hpp"                  // Runtime
+#include "network/set-nonblocking.hpp"          // set_nonblocking()
+#include "network/set-socketoption.hpp"         // set_option()
+#include "network/sockaddrstorage.hpp"          // SockAddrStorage
+#include "network/socketcore.hpp"               // SocketCore
+#include "network/sockethints.hpp"              // SocketHints
+#include "network/socketoptions.hpp"            // ReusePort
+#include "network/uniquesocket.hpp"             // UniqueSocket
+
+#include <poll.h>           // POLLIN, pollfd, ::poll()
+#include <pthread.h>        // ::pthread_self(),
+                            // ::pthread_setaffinity_np()
+#include <sched.h>          // CPU_SET(), CPU_ZERO(), cpu_set_t
+
+#include <algorithm>    // std::max(), std::min()
+#include <cerrno>       // EMFILE, ENFILE, ENOBUFS, ENOMEM
+#include <chrono>       // std::chrono::milliseconds
+#include <cstddef>      // std::size_t
+#include <exception>    // std::exception
+#include <memory>       // std::make_unique()
+#include <mutex>        // std::lock_guard
+#include <stop_token>   // std::stop_token
+#include <string>       // std::string
+#include <thread>       // std::this_thread::sleep_for(), std::thread
+#include <utility>      // std::move()
+
+namespace
+{
+    using Network::Error;
+    using Network::LogicError;
+    using Network::OsError;
+    using Network::ReusePort;
+    using Network::Runtime;
+    using Network::SocketCore;
+    using Network::UniqueSocket;
+    using Network::close;
+    using Network::family_type;
+    using Network::handle_type;
+    using Network::listen;
+    using Network::set_nonblocking;
+    using Network::set_option;
+
+    auto get_cpu_count() noexcept -> std::size_t
+    {
+        return std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    auto get_message() -> std::string
+    {
+        try {
+            throw;
+        }
+        catch (const std::exception& ex) {
+            return ex.what();
+        }
+        catch (...) {
+            return "Unknown exception";
+        }
+    }
+
+    auto is_transient(const OsError& error) noexcept -> bool
+    {
+        switch (error.number()) {
+        case EMFILE:
+        case ENFILE:
+        case ENOBUFS:
+        case ENOMEM:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    auto pin(std::size_t shard) noexcept -> void
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);  // NOLINT
+        CPU_SET(shard % get_cpu_count(), &set);  // NOLINT
+        static_cast<void>(::pthread_setaffinity_np(::pthread_self(),
+                                                   sizeof set, &set));
+    }
+
+    auto prepare(const UniqueSocket& socket,
+                 family_type family,
+                 const Runtime* rt,
+                 int backlog) -> void
+    {
+        const SocketCore sc {static_cast<handle_type>(*socket), family, rt};
+
+        if (const auto error {listen(sc, backlog)}) {
+            throw Error {error.string()};
+        }
+
+        if (const auto error {set_nonblocking(sc)}) {
+            throw Error {error.string()};
+        }
+    }
+}
+
+Network::ShardedListener::ShardedListener(const EndpointView& t_endpoint,
+                                          const SocketHints& t_hints,
+                                          const Runtime* t_rt,
+                                          std::size_t t_shard_count,
+                                          bool t_is_pinned,
+                                          int t_backlog) :
+    m_rt(t_rt),
+    m_is_pinned(t_is_pinned)
+{
+    if (m_rt == nullptr) {
+        throw LogicError {"Null runtime pointer"};
+    }
+
+    const auto shard_count {t_shard_count == 0 ?
+                            get_cpu_count() :
+                            t_shard_count};
+    const OpenSetup setup {[](const SocketCore& sc) {
+        return set_option<ReusePort>(sc, true);
+    }};
+    auto results {bind(t_endpoint, t_hints, m_rt, setup)};
+    OsError error;
+
+    for (auto& result : results) {
+        if (result) {
+            auto shard {std::make_unique<Shard>()};
+            shard->m_socket = std::move(*result);
+            m_shards.push_back(std::move(shard));
+            break;
+        }
+
+        error = result.error();
+    }
+
+    if (m_shards.empty()) {
+        throw Error {error.string()};
+    }
+
+    // Bind the remaining shards to the address actually bound by the
+    // first, in case the endpoint asked for an ephemeral port.
+    m_name = SockAddrStorage {m_shards.front()->m_socket->get_sockname()};
+    const auto family {get_sa_family(m_name)};
+    const SocketHints hints {family, t_hints.m_socktype, t_hints.m_protocol};
+    prepare(m_shards.front()->m_socket, family, m_rt, t_backlog);
+
+    while (m_shards.size() < shard_count) {
+        auto shard {std::make_unique<Shard>()};
+        shard->m_socket = create_socket(hints, m_rt);
+        const SocketCore sc {static_cast<handle_type>(*shard->m_socket),
+                             family, m_rt};
+
+        if (const auto error_2 {set_option<ReusePort>(sc, true)}) {
+            throw Error {error_2.string()};
+        }
+
+        if (const auto error_2 {shard->m_socket->open(m_name,
+                                                      OpenSymbol::bind)}) {
+            throw Error {error_2.string()};
+        }
+
+        prepare(shard->m_socket, family, m_rt, t_backlog);
+        m_shards.push_back(std::move(shard));
+    }
+}
+
+Network::ShardedListener::~ShardedListener() noexcept
+{
+    stop();
+}
+
+auto Network::ShardedListener::start(Handler t_handler) -> void
+{
+    if (!m_threads.empty()) {
+        throw LogicError {"Sharded listener is already running"};
+    }
+
+    m_handler = std::move(t_handler);
+    m_threads.reserve(m_shards.size());
+
+    for (std::size_t i {0}; i < m_shards.size(); ++i) {
+        // A shard closed by a failure stays closed.  Every thread has
+        // been joined, so the socket may be read without the lock.
+        if (!m_shards[i]->m_socket) {
+            continue;
+        }
+
+        m_threads.emplace_back([this, i](std::stop_token token) {
+            run(token, i);
+        });
+    }
+}
+
+auto Network::ShardedListener::stop() noexcept -> void
+{
+    for (auto& thread : m_threads) {
+        thread.request_stop();
+    }
+
+    m_threads.clear();
+}
+
+auto Network::ShardedListener::accepted() const noexcept -> std::size_t
+{
+    std::size_t result {0};
+
+    for (const auto& shard : m_shards) {
+        result += shard->m_accepted.load(std::memory_order_relaxed);
+    }
+
+    return result;
+}
+
+auto Network::ShardedListener::accepted(std::size_t t_shard) const ->
+    std::size_t
+{
+    return m_shards.at(t_shard)->m_accepted.load(std::memory_order_relaxed);
+}
+
+auto Network::ShardedListener::error(std::size_t t_shard) const -> OsError
+{
+    const auto& shard {*m_shards.at(t_shard)};
+    const std::lock_guard lock {shard.m_mutex};
+    return shard.m_error;
+}
+
+auto Network::ShardedListener::name() const noexcept ->
+    const SockAddrStorage&
+{
+    return m_name;
+}
+
+auto Network::ShardedListener::shard_count() const noexcept -> std::size_t
+{
+    return m_shards.size();
+}
+
+auto Network::ShardedListener::run(std::stop_token t_token,
+                                   std::size_t t_shard) -> void
+{
+    auto& shard {*m_shards[t_shard]};
+    const auto family {get_sa_family(m_name)};
+    const SocketCore sc {static_cast<handle_type>(*shard.m_socket),
+                         family, m_rt};
+    AcceptBatch batch {batch_size};
+    pollfd pfd {sc.handle(), POLLIN, 0};
+    std::chrono::milliseconds delay {0};
+
+    if (m_is_pinned) {
+        pin(t_shard);
+    }
+
+    while (!t_token.stop_requested()) {
+        pfd.revents = 0;
+
+        // Wake up periodically to notice a stop request.
+        if (::poll(&pfd, 1, poll_timeout) <= 0) {
+            continue;
+        }
+
+        const auto error {accept_batch(sc, batch)};
+        std::size_t taken {0};
+
+        try {
+            while (taken < batch.size()) {
+                auto socket {create_socket(batch.handle(taken), family,
+                                           m_rt)};
+                ++taken;
+                shard.m_accepted.fetch_add(1, std::memory_order_relaxed);
+                m_handler(std::move(socket), t_shard);
+            }
+        }
+        catch (...) {
+            // Close the handles not yet taken over by a socket.
+            for (auto i {taken}; i < batch.size(); ++i) {
+                static_cast<void>(close(SocketCore {batch.handle(i),
+                                                    family, m_rt}));
+            }
+
+            fail(shard, OsError {0, get_message()});
+            break;
+        }
+
+        if (!error) {
+            delay = {};
+            continue;
+        }
+
+        if (is_transient(error)) {
+            // The pending connections stay queued, so poll() would
+            // return at once: wait for descriptors or memory to be
+            // released, backing off up to the poll timeout.
+            delay = std::min(std::max(delay * 2,
+                                      std::chrono::milliseconds {1}),
+                             std::chrono::milliseconds {poll_timeout});
+            std::this_thread::sleep_for(delay);
+            continue;
+        }
+
+        fail(shard, error);
+        break;
+    }
+}
+
+auto Network::ShardedListener::fail(Shard& t_shard, const OsError& t_error)
+    -> void
+{
+    const std::lock_guard lock {t_shard.m_mutex};
+    t_shard.m_error = t_error;
+    t_shard.m_socket.reset();
+}
+
+#endif
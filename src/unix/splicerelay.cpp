@@ -0,0 +1,190 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "network/splicerelay.hpp"      // SpliceRelay
+
+#ifdef HAVE_SPLICE
+
+#include "network/error.hpp"            // Error
+#include "network/get-api-error.hpp"    // get_api_error()
+#include "network/handle-null.hpp"      // handle_null
+#include "network/handle-type.hpp"      // handle_type
+#include "network/iocounter.hpp"        // IoCounter
+#include "network/logicerror.hpp"       // LogicError
+#include "network/oserror.hpp"          // OsError
+#include "network/reset-api-error.hpp"  // reset_api_error()
+#include "network/runtime.hpp"          // Runtime
+#include "network/socket-error.hpp"     // socket_error
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/systemcall.hpp"       // SystemCall
+#include "network/to-os-error.hpp"      // to_os_error()
+#include "network/trace.hpp"            // trace()
+
+#include <fcntl.h>          // O_CLOEXEC, SPLICE_F_MORE, SPLICE_F_MOVE,
+                            // ::splice()
+#include <unistd.h>         // ::close(), ::pipe2()
+
+#include <algorithm>    // std::min()
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::int64_t
+#include <ostream>      // std::ostream
+
+Network::SpliceRelay::SpliceRelay(const Runtime* t_rt,
+                                  std::size_t t_chunk_size) :
+    m_rt(t_rt),
+    m_chunk_size(t_chunk_size)
+{
+    if (m_rt == nullptr) {
+        throw LogicError {"Null runtime pointer"};
+    }
+
+    if (m_chunk_size == 0) {
+        throw LogicError {"Zero chunk size"};
+    }
+
+    open_pipe();
+}
+
+Network::SpliceRelay::~SpliceRelay() noexcept
+{
+    close_pipe();
+}
+
+auto Network::SpliceRelay::relay(const SocketCore& t_input,
+                                 const SocketCore& t_output,
+                                 std::size_t t_length) -> std::size_t
+{
+    if (m_pipe[0] == handle_null) {
+        open_pipe();
+    }
+
+    const auto [pipe_input, pipe_output] {m_pipe};
+    std::size_t total {0};
+
+    try {
+        while (total < t_length) {
+            const auto chunk {std::min(t_length - total, m_chunk_size)};
+            auto pending {splice(t_input, t_input.handle(), pipe_output,
+                                 chunk)};
+
+            if (pending == 0) {
+                break;
+            }
+
+            t_input.count(IoCounter::bytes_read, pending);
+            total += pending;
+
+            while (pending > 0) {
+                const auto sent {splice(t_output, pipe_input,
+                                        t_output.handle(), pending)};
+                t_output.count(IoCounter::bytes_written, sent);
+                pending -= sent;
+            }
+        }
+    }
+    catch (...) {
+        // Discard whatever is left in the pipe rather than send it
+        // to the output of the next call.
+        close_pipe();
+        throw;
+    }
+
+    return total;
+}
+
+auto Network::SpliceRelay::close_pipe() noexcept -> void
+{
+    for (auto& handle : m_pipe) {
+        if (handle != handle_null) {
+            static_cast<void>(::close(handle));
+            handle = handle_null;
+        }
+    }
+}
+
+auto Network::SpliceRelay::open_pipe() -> void
+{
+    trace(m_rt->tracer(), [&](std::ostream& os) {
+        os << "Calling ::pipe2(..., O_CLOEXEC)";
+    });
+
+    reset_api_error();
+
+    if (::pipe2(m_pipe.data(), O_CLOEXEC) == socket_error) {
+        const auto api_error {get_api_error()};
+        const auto os_error {to_os_error(api_error)};
+        const SystemCall call {
+            .m_name = "::pipe2",
+            .m_arguments = [](std::ostream& os, const SystemCall&) {
+                os << "..., O_CLOEXEC";
+            },
+        };
+        throw Error {OsError {os_error, api_error, call}};
+    }
+}
+
+auto Network::SpliceRelay::splice(const SocketCore& t_sc,
+                                  handle_type t_input,
+                                  handle_type t_output,
+                                  std::size_t t_length) const -> std::size_t
+{
+    constexpr auto flags {SPLICE_F_MOVE | SPLICE_F_MORE};
+
+    trace(m_rt->tracer(), [&](std::ostream& os) {
+        // clang-format off
+        os << "Calling ::splice("
+           << t_input
+           << ", nullptr, "
+           << t_output
+           << ", nullptr, "
+           << t_length
+           << ", "
+           << flags
+           << ')';
+        // clang-format on
+    });
+
+    t_sc.count(IoCounter::system_calls);
+    reset_api_error();
+    const auto ssize {::splice(t_input, nullptr, t_output, nullptr,
+                               t_length, flags)};
+
+    if (ssize == socket_error) {
+        const auto api_error {get_api_error()};
+        const auto os_error {to_os_error(api_error)};
+        t_sc.count_error(os_error);
+        const SystemCall call {
+            .m_name = "::splice",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", nullptr, "
+                   << t_call.m_values[0]
+                   << ", nullptr, "
+                   << t_call.m_values[1]
+                   << ", "
+                   << t_call.m_values[2];
+                // clang-format on
+            },
+            .m_values = {t_output, static_cast<std::int64_t>(t_length), flags},
+            .m_handle = t_input,
+        };
+        throw Error {OsError {os_error, api_error, call}};
+    }
+
+    return static_cast<std::size_t>(ssize);
+}
+
+#endif
@@ -0,0 +1,185 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/assert.hpp"           // assert()
+#include "network/namesymbol.hpp"       // NameSymbol
+#include "network/network.hpp"          // AcceptBatch, Error,
+                                        // IoLatency, SharedRuntime,
+                                        // SockAddrStorage,
+                                        // SocketCore, SocketHints,
+                                        // UniqueSocket, accept_batch(),
+                                        // create_socket(), get_name(),
+                                        // handle_type, run(),
+                                        // to_bytestring()
+#include "network/opensymbol.hpp"       // OpenSymbol
+#include "network/os-features.hpp"      // HAVE_ACCEPT4
+#include "network/parse.hpp"            // parse()
+
+#include <arpa/inet.h>      // htonl()
+#include <fcntl.h>          // FD_CLOEXEC, F_GETFD, F_GETFL, O_NONBLOCK,
+                            // ::fcntl()
+#include <netinet/in.h>     // INADDR_LOOPBACK, sockaddr_in
+#include <sys/socket.h>     // AF_INET, SOCK_STREAM
+#include <unistd.h>         // ::close()
+
+#include <algorithm>    // std::ranges::equal(), std::ranges::find_if()
+#include <array>        // std::array
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <iostream>     // std::cerr, std::endl
+#include <vector>       // std::vector
+
+namespace
+{
+    using Network::Error;
+    using Network::IoLatency;
+    using Network::NameSymbol;
+    using Network::OpenSymbol;
+    using Network::SharedRuntime;
+    using Network::SockAddrStorage;
+    using Network::SocketCore;
+    using Network::SocketHints;
+    using Network::UniqueSocket;
+    using Network::create_socket;
+    using Network::get_name;
+    using Network::handle_type;
+    using Network::parse;
+    using Network::run;
+    using Network::to_bytestring;
+#ifdef HAVE_ACCEPT4
+    using Network::AcceptBatch;
+    using Network::accept_batch;
+#endif
+
+    constexpr std::size_t client_count {3};
+
+    // One call per client, plus one that would block at the end of each
+    // batch that does not fill up.
+    constexpr std::size_t accept_calls {client_count + 2};
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+#ifdef HAVE_ACCEPT4
+    auto get_sockname(const UniqueSocket& socket,
+                      const SharedRuntime& sr) -> SockAddrStorage
+    {
+        // Query the kernel, as the bound port is assigned dynamically.
+        const SocketCore sc {static_cast<handle_type>(*socket),
+                             AF_INET, sr.get()};
+        return get_name(sc, NameSymbol::getsockname);
+    }
+
+    auto test_accept_batch(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_INET, SOCK_STREAM, 0};
+        auto listener {create_socket(hints, sr.get())};
+        sockaddr_in sin {};
+        sin.sin_family = AF_INET;
+        sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        const auto bs {to_bytestring(&sin, sizeof sin)};
+        assert(!listener->open(bs, OpenSymbol::bind));
+        assert(!listener->listen(client_count));
+        assert(!listener->set_nonblocking(true));
+        const auto listener_name {get_sockname(listener, sr)};
+        std::vector<UniqueSocket> clients;
+        std::vector<SockAddrStorage> client_names;
+
+        for (std::size_t i {0}; i < client_count; ++i) {
+            auto& client {clients.emplace_back(create_socket(hints,
+                                                             sr.get()))};
+            assert(!client->open(listener_name, OpenSymbol::connect));
+            client_names.push_back(get_sockname(client, sr));
+        }
+
+        const SocketCore sc {static_cast<handle_type>(*listener),
+                             AF_INET, sr.get()};
+        AcceptBatch batch {client_count - 1};
+        std::vector<handle_type> handles;
+        auto* const stats {sr->stats()};
+        const auto& latency {stats->latency(IoLatency::accept)};
+        const auto before {latency.count()};
+        const auto snapshot_before {stats->snapshot()};
+
+        for (const auto expected_size : std::array {2UZ, 1UZ, 0UZ}) {
+            assert(!accept_batch(sc, batch));
+            assert(batch.size() == expected_size);
+
+            for (std::size_t i {0}; i < batch.size(); ++i) {
+                const auto handle {batch.handle(i)};
+                assert((::fcntl(handle, F_GETFL) & O_NONBLOCK) != 0);
+                assert((::fcntl(handle, F_GETFD) & FD_CLOEXEC) != 0);
+                const auto peer {batch.peer(i)};
+                assert(std::ranges::find_if(client_names, [&](const auto& nm) {
+                    return std::ranges::equal(nm, peer);
+                }) != client_names.end());
+                handles.push_back(handle);
+            }
+        }
+
+        assert(handles.size() == client_count);
+
+        // Only the calls that accepted a connection are timed.
+        assert(latency.count() == before + client_count);
+
+        // Draining the queue is not an error.
+        const auto snapshot {stats->snapshot()};
+        assert(snapshot.m_system_calls ==
+               snapshot_before.m_system_calls + accept_calls);
+        assert(snapshot.m_accepts == snapshot_before.m_accepts + client_count);
+        assert(snapshot.m_again == snapshot_before.m_again + 2);
+        assert(snapshot.m_errors == snapshot_before.m_errors);
+
+        for (const auto handle : handles) {
+            static_cast<void>(::close(handle));
+        }
+    }
+#endif
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+#ifdef HAVE_ACCEPT4
+        test_accept_batch(sr);
+#endif
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
@@ -0,0 +1,226 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/assert.hpp"           // assert()
+#include "network/network.hpp"          // BasicSocket, Error,
+                                        // LogicError, SharedRuntime,
+                                        // SockAddrStorage, SocketCore,
+                                        // TextBuffer, handle_null,
+                                        // handle_type, run(),
+                                        // to_bytestring()
+#include "network/opensymbol.hpp"       // OpenSymbol
+#include "network/parse.hpp"            // parse()
+#include "network/socketdata.hpp"       // SocketData
+
+#include <arpa/inet.h>      // htonl()
+#include <netinet/in.h>     // INADDR_LOOPBACK, sockaddr_in
+#include <sys/socket.h>     // AF_INET, AF_INET6, AF_UNIX, SOCK_STREAM,
+                            // ::socket(), ::socketpair()
+#include <sys/un.h>         // sockaddr_un
+#include <unistd.h>         // ::getpid()
+
+#include <algorithm>    // std::ranges::equal()
+#include <array>        // std::array
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <filesystem>   // std::filesystem
+#include <iostream>     // std::cerr, std::endl
+#include <string>       // std::string
+#include <type_traits>  // std::is_nothrow_move_constructible_v,
+                        // std::is_polymorphic_v
+#include <utility>      // std::move()
+#include <vector>       // std::vector
+
+namespace
+{
+    using Network::BasicSocket;
+    using Network::Error;
+    using Network::LogicError;
+    using Network::OpenSymbol;
+    using Network::SharedRuntime;
+    using Network::SockAddrStorage;
+    using Network::SocketCore;
+    using Network::SocketData;
+    using Network::TextBuffer;
+    using Network::handle_null;
+    using Network::handle_type;
+    using Network::parse;
+    using Network::run;
+    using Network::to_bytestring;
+
+    using InetSocket = BasicSocket<AF_INET>;
+    using LocalSocket = BasicSocket<AF_UNIX>;
+
+    constexpr auto buffer_size {16};
+    constexpr auto socket_count {8};
+
+    static_assert(!std::is_polymorphic_v<LocalSocket>);
+    static_assert(std::is_nothrow_move_constructible_v<LocalSocket>);
+
+    // Only the address a socket was accepted, bound or connected with
+    // is held inline, so that a socket stored by value stays close to
+    // the size of its core.
+    static_assert(sizeof(InetSocket) <=
+                  2 * sizeof(SocketCore) + sizeof(SockAddrStorage));
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto create_handle(int family) -> handle_type
+    {
+        const auto handle {::socket(family, SOCK_STREAM, 0)};
+
+        if (handle == handle_null) {
+            throw Error {"Call to ::socket() failed"};
+        }
+
+        return handle;
+    }
+
+    auto create_pair(const SharedRuntime& sr) -> std::array<LocalSocket, 2>
+    {
+        std::array<handle_type, 2> handles {};
+
+        if (::socketpair(AF_UNIX, SOCK_STREAM, 0, handles.data()) == -1) {
+            throw Error {"Call to ::socketpair() failed"};
+        }
+
+        return {LocalSocket {handles[0], sr.get()},
+                LocalSocket {handles[1], sr.get()}};
+    }
+
+    auto test_accept(const SharedRuntime& sr) -> void
+    {
+        InetSocket listener {create_handle(AF_INET), sr.get()};
+        sockaddr_in sin {};
+        sin.sin_family = AF_INET;
+        sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        assert(!listener.open(to_bytestring(&sin, sizeof sin),
+                              OpenSymbol::bind));
+        assert(!listener.listen(1));
+        InetSocket client {create_handle(AF_INET), sr.get()};
+        assert(!client.open(listener.get_sockname(), OpenSymbol::connect));
+        const InetSocket server {listener.accept()};
+        assert(std::ranges::equal(server.get_peername(),
+                                  client.get_sockname()));
+        static_cast<void>(client.write("Hello"));
+        TextBuffer buffer {buffer_size};
+        static_cast<void>(server.read(buffer));
+        assert(std::string {buffer} == "Hello");
+    }
+
+    auto test_bind(const SharedRuntime& sr) -> void
+    {
+        const auto path {std::filesystem::temp_directory_path() /
+                         ("test-basic-socket-" +
+                          std::to_string(::getpid()))};
+        sockaddr_un sun {};
+        sun.sun_family = AF_UNIX;
+        path.native().copy(sun.sun_path, sizeof sun.sun_path - 1);
+        LocalSocket socket {create_handle(AF_UNIX), sr.get()};
+        assert(!socket.open(to_bytestring(&sun, sizeof sun),
+                            OpenSymbol::bind));
+        assert(std::filesystem::exists(path));
+        LocalSocket moved {std::move(socket)};
+        assert(std::filesystem::exists(path));
+        assert(!moved.close());
+        assert(!std::filesystem::exists(path));
+    }
+
+    auto test_family(const SharedRuntime& sr) -> void
+    {
+        std::string actual_str;
+
+        try {
+            const SocketData sd {create_handle(AF_INET), AF_INET, sr.get()};
+            const BasicSocket<AF_INET6> socket {sd};
+        }
+        catch (const LogicError& error) {
+            actual_str = error.what();
+        }
+
+        assert(actual_str == "Socket domain/family mismatch");
+    }
+
+    auto test_move(const SharedRuntime& sr) -> void
+    {
+        auto sp {create_pair(sr)};
+        const auto handle {static_cast<handle_type>(sp[0])};
+        LocalSocket socket {std::move(sp[0])};
+        assert(!sp[0].is_open());
+        assert(static_cast<handle_type>(sp[0]) == handle_null);
+        assert(static_cast<handle_type>(socket) == handle);
+        sp[0] = std::move(socket);
+        assert(static_cast<handle_type>(sp[0]) == handle);
+        assert(!socket.is_open());
+        assert(!socket.close());
+    }
+
+    auto test_vector(const SharedRuntime& sr) -> void
+    {
+        std::vector<LocalSocket> sockets;
+
+        for (auto i {0}; i < socket_count; ++i) {
+            for (auto& socket : create_pair(sr)) {
+                sockets.push_back(std::move(socket));
+            }
+        }
+
+        assert(sockets.size() == 2 * socket_count);
+
+        for (std::size_t i {0}; i < sockets.size(); i += 2) {
+            static_cast<void>(sockets[i].write("Hello"));
+            TextBuffer buffer {buffer_size};
+            static_cast<void>(sockets[i + 1].read(buffer));
+            assert(std::string {buffer} == "Hello");
+        }
+    }
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+        test_accept(sr);
+        test_bind(sr);
+        test_family(sr);
+        test_move(sr);
+        test_vector(sr);
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
@@ -0,0 +1,207 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/assert.hpp"           // assert()
+#include "network/network.hpp"          // ConnectionTable, Error,
+                                        // HandleGenerations,
+                                        // SharedRuntime, SocketCore,
+                                        // close(), handle_null,
+                                        // handle_type, run()
+#include "network/parse.hpp"            // parse()
+
+#include <sys/socket.h>     // AF_UNIX, SOCK_STREAM, ::socket()
+
+#include <atomic>       // std::atomic
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <iostream>     // std::cerr, std::endl
+#include <thread>       // std::jthread
+#include <vector>       // std::vector
+
+namespace
+{
+    using Network::ConnectionTable;
+    using Network::Error;
+    using Network::HandleGenerations;
+    using Network::SharedRuntime;
+    using Network::SocketCore;
+    using Network::close;
+    using Network::handle_null;
+    using Network::handle_type;
+    using Network::parse;
+    using Network::run;
+
+    struct Connection
+    {
+        std::size_t m_id {0};
+        std::size_t m_check {0};
+    };
+
+    constexpr std::size_t reader_count {4};
+    constexpr std::size_t write_count {10000};
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto create_core(const SharedRuntime& sr) -> SocketCore
+    {
+        const auto handle {::socket(AF_UNIX, SOCK_STREAM, 0)};
+
+        if (handle == handle_null) {
+            throw Error {"Call to ::socket() failed"};
+        }
+
+        return {handle, AF_UNIX, sr.get()};
+    }
+
+    auto test_close(const SharedRuntime& sr) -> void
+    {
+        ConnectionTable<Connection> table;
+        const auto sc {create_core(sr)};
+        assert(table.insert(sc, {1, 1}));
+        assert(table.contains(sc.handle()));
+        const auto generation {HandleGenerations::current(sc.handle())};
+        assert(!close(sc));
+        assert(HandleGenerations::current(sc.handle()) == generation + 1);
+        assert(!table.find(sc));
+
+        // The kernel reuses the lowest free descriptor.
+        const auto reused {create_core(sr)};
+        assert(reused.handle() == sc.handle());
+        assert(!table.find(reused));
+        assert(table.insert(reused, {2, 2}));
+        assert(table.find(reused)->m_id == 2);
+        assert(!close(reused));
+    }
+
+    auto test_concurrent(const SharedRuntime& sr) -> void
+    {
+        ConnectionTable<Connection> table;
+        const auto sc {create_core(sr)};
+        std::atomic<bool> is_done {false};
+        std::atomic<std::size_t> torn_count {0};
+        std::vector<std::jthread> readers;
+
+        for (std::size_t i {0}; i < reader_count; ++i) {
+            readers.emplace_back([&] {
+                while (!is_done.load()) {
+                    const auto value {table.find(sc)};
+
+                    if (value && value->m_id != value->m_check) {
+                        ++torn_count;
+                    }
+                }
+            });
+        }
+
+        for (std::size_t i {0}; i < write_count; ++i) {
+            static_cast<void>(table.insert(sc, {i, i}));
+        }
+
+        is_done = true;
+        readers.clear();
+        assert(torn_count == 0);
+        assert(table.find(sc)->m_id == write_count - 1);
+        assert(!close(sc));
+    }
+
+    auto test_erase(const SharedRuntime& sr) -> void
+    {
+        ConnectionTable<Connection> table;
+        const auto sc {create_core(sr)};
+        assert(!table.erase(sc));
+        assert(table.insert(sc, {1, 1}));
+        assert(table.erase(sc));
+        assert(!table.contains(sc.handle()));
+        assert(!close(sc));
+    }
+
+    auto test_erase_concurrent(const SharedRuntime& sr) -> void
+    {
+        ConnectionTable<Connection> table;
+        const auto sc {create_core(sr)};
+        assert(table.insert(sc, {1, 1}));
+        std::atomic<std::size_t> erase_count {0};
+
+        {
+            std::vector<std::jthread> erasers;
+
+            for (std::size_t i {0}; i < reader_count; ++i) {
+                erasers.emplace_back([&] {
+                    if (table.erase(sc)) {
+                        ++erase_count;
+                    }
+                });
+            }
+        }
+
+        // Only one of the racing erasures finds the entry.
+        assert(erase_count == 1);
+        assert(!table.contains(sc.handle()));
+        assert(!close(sc));
+    }
+
+    auto test_range() -> void
+    {
+        ConnectionTable<Connection> table;
+        assert(table.capacity() == 0);
+        assert(!table.insert(handle_null, {}));
+        const auto handle_max {
+            static_cast<handle_type>(HandleGenerations::index_max)
+        };
+        assert(!table.insert(handle_max, {}));
+        assert(!table.find(handle_max));
+        assert(table.insert(handle_max - 1, {}));
+        assert(table.capacity() == ConnectionTable<Connection>::chunk_size);
+        assert(table.erase(handle_max - 1));
+    }
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+        test_close(sr);
+        test_concurrent(sr);
+        test_erase(sr);
+        test_erase_concurrent(sr);
+        test_range();
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
@@ -0,0 +1,184 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/assert.hpp"           // assert()
+#include "network/namesymbol.hpp"       // NameSymbol
+#include "network/network.hpp"          // DatagramBatch, Error,
+                                        // SharedRuntime,
+                                        // SocketCore, SocketHints,
+                                        // UniqueSocket, create_socket(),
+                                        // get_name(), handle_type,
+                                        // receive_batch(), run(),
+                                        // send_batch(), to_bytestring()
+#include "network/opensymbol.hpp"       // OpenSymbol
+#include "network/os-features.hpp"      // HAVE_RECVMMSG
+#include "network/parse.hpp"            // parse()
+
+#include <arpa/inet.h>      // htonl()
+#include <netinet/in.h>     // INADDR_LOOPBACK, sockaddr_in
+#include <sys/socket.h>     // AF_INET, MSG_WAITFORONE, SOCK_DGRAM
+
+#include <algorithm>    // std::ranges::copy(), std::ranges::equal()
+#include <array>        // std::array
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <iostream>     // std::cerr, std::endl
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <utility>      // std::cmp_equal()
+
+namespace
+{
+    using Network::Error;
+    using Network::NameSymbol;
+    using Network::OpenSymbol;
+    using Network::SharedRuntime;
+    using Network::SockAddrStorage;
+    using Network::SocketCore;
+    using Network::SocketHints;
+    using Network::UniqueSocket;
+    using Network::create_socket;
+    using Network::get_name;
+    using Network::handle_type;
+    using Network::parse;
+    using Network::run;
+    using Network::to_bytestring;
+#ifdef HAVE_RECVMMSG
+    using Network::CharSpan;
+    using Network::DatagramBatch;
+    using Network::receive_batch;
+    using Network::send_batch;
+#endif
+
+    constexpr auto buffer_size {16};
+    constexpr std::string_view hello {"Hello"};
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto bind_loopback(const SharedRuntime& sr) -> UniqueSocket
+    {
+        const SocketHints hints {AF_INET, SOCK_DGRAM, 0};
+        auto socket {create_socket(hints, sr.get())};
+        sockaddr_in sin {};
+        sin.sin_family = AF_INET;
+        sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        const auto bs {to_bytestring(&sin, sizeof sin)};
+        assert(!socket->open(bs, OpenSymbol::bind));
+        return socket;
+    }
+
+    auto get_sockname(const UniqueSocket& socket,
+                      const SharedRuntime& sr) -> SockAddrStorage
+    {
+        // Query the kernel, as the bound port is assigned dynamically.
+        const SocketCore sc {static_cast<handle_type>(*socket),
+                             AF_INET, sr.get()};
+        return get_name(sc, NameSymbol::getsockname);
+    }
+
+#ifdef HAVE_RECVMMSG
+    auto test_batch(const SharedRuntime& sr) -> void
+    {
+        constexpr std::size_t count {4};
+        const auto receiver {bind_loopback(sr)};
+        const auto sender {bind_loopback(sr)};
+        const auto receiver_name {get_sockname(receiver, sr)};
+        const auto sender_name {get_sockname(sender, sr)};
+        std::array<std::array<char, buffer_size>, count> input {};
+        std::array<std::array<char, buffer_size>, count> output {};
+        std::array<CharSpan, count> input_spans {};
+        std::array<CharSpan, count> output_spans {};
+
+        for (std::size_t i {0}; i < count; ++i) {
+            input_spans.at(i) = input.at(i);
+            output_spans.at(i) = output.at(i);
+            const std::string str {hello.substr(0, i + 1)};
+            std::ranges::copy(str, output.at(i).begin());
+        }
+
+        DatagramBatch in_batch {input_spans};
+        DatagramBatch out_batch {output_spans};
+        assert(in_batch.capacity() == count);
+
+        for (std::size_t i {0}; i < count; ++i) {
+            out_batch.prepare(i, i + 1, receiver_name);
+        }
+
+        const SocketCore receiver_sc {static_cast<handle_type>(*receiver),
+                                      AF_INET, sr.get()};
+        const SocketCore sender_sc {static_cast<handle_type>(*sender),
+                                    AF_INET, sr.get()};
+        assert(send_batch(sender_sc, out_batch, count) == count);
+        assert(receive_batch(receiver_sc, in_batch, MSG_WAITFORONE) == count);
+
+        for (std::size_t i {0}; i < count; ++i) {
+            assert(in_batch.data(i) == hello.substr(0, i + 1));
+            assert(std::ranges::equal(in_batch.peer(i), sender_name));
+        }
+    }
+#endif
+
+    auto test_datagram(const SharedRuntime& sr) -> void
+    {
+        const auto receiver {bind_loopback(sr)};
+        const auto sender {bind_loopback(sr)};
+        const auto receiver_name {get_sockname(receiver, sr)};
+        const auto sender_name {get_sockname(sender, sr)};
+        const auto sent {sender->send_to(hello, receiver_name)};
+        assert(std::cmp_equal(sent, hello.size()));
+        std::array<char, buffer_size> buffer {};
+        const auto [peer, size] {receiver->receive_from(buffer)};
+        assert(std::cmp_equal(size, hello.size()));
+        assert(std::string_view(buffer.data(), hello.size()) == hello);
+        assert(peer == sender_name);
+    }
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+        test_datagram(sr);
+#ifdef HAVE_RECVMMSG
+        test_batch(sr);
+#endif
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
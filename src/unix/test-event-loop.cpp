@@ -0,0 +1,294 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/assert.hpp"           // assert()
+#include "network/async.hpp"            // EventLoop, Task,
+                                        // async_read(),
+                                        // async_write(), spawn()
+#include "network/network.hpp"          // Error, LogicError, OsError,
+                                        // SharedRuntime,
+                                        // SocketCore, SocketHints,
+                                        // TextBuffer,
+                                        // create_socketpair(),
+                                        // handle_null, handle_type,
+                                        // run()
+#include "network/os-features.hpp"      // HAVE_EPOLL
+#include "network/parse.hpp"            // parse()
+
+#include <sys/socket.h>     // AF_UNIX, SOCK_STREAM
+
+#include <cerrno>       // EBADF
+#include <coroutine>    // std::noop_coroutine()
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <iostream>     // std::cerr, std::cout, std::endl
+#include <string>       // std::string
+#include <utility>      // std::cmp_equal(), std::move()
+
+namespace
+{
+    using Network::Error;
+    using Network::LogicError;
+    using Network::SharedRuntime;
+    using Network::SocketCore;
+    using Network::SocketHints;
+    using Network::TextBuffer;
+    using Network::create_socketpair;
+    using Network::handle_null;
+    using Network::handle_type;
+    using Network::parse;
+    using Network::run;
+#ifdef HAVE_EPOLL
+    using Network::EventLoop;
+    using Network::Task;
+    using Network::async_read;
+    using Network::async_write;
+    using Network::spawn;
+#endif
+
+    constexpr auto buffer_size {16};
+    constexpr auto timeout {1000};
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+#ifdef HAVE_EPOLL
+    auto print(const Network::OsError& error) -> void
+    {
+        if (is_verbose) {
+            std::cout << "Error: "
+                      << error.string()
+                      << std::endl;
+        }
+    }
+
+    auto echo(EventLoop& loop,
+              SocketCore reader,
+              SocketCore writer,
+              std::string& actual_str) -> Task<>
+    {
+        TextBuffer buffer {buffer_size};
+        const auto length {co_await async_read(loop, reader, buffer)};
+        actual_str = buffer;
+        co_await async_write(loop, writer, actual_str);
+        assert(std::cmp_equal(length, actual_str.size()));
+    }
+
+    auto test_add_invalid(const SharedRuntime& sr) -> void
+    {
+        EventLoop loop {sr.get()};
+        const auto error {loop.add(handle_null,
+                                   EventLoop::events_read,
+                                   [](handle_type, EventLoop::Events) {})};
+        print(error);
+        assert(error.number() == EBADF);
+        assert(loop.size() == 0);
+    }
+
+    auto test_async(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        auto sp {create_socketpair(hints, sr.get())};
+        EventLoop loop {sr.get()};
+        const SocketCore sc0 {static_cast<handle_type>(*sp[0]),
+                              AF_UNIX, sr.get()};
+        assert(!sp[0]->set_nonblocking(true));
+        std::string actual_str;
+        spawn(echo(loop, sc0, sc0, actual_str));
+        assert(loop.size() == 1);
+        static_cast<void>(sp[1]->write("Hello"));
+        assert(!loop.run());
+        assert(actual_str == "Hello");
+        TextBuffer buffer {buffer_size};
+        static_cast<void>(sp[1]->read(buffer));
+        assert(std::string {buffer} == "Hello");
+
+        // The handle stays registered for the next operation.
+        assert(loop.size() == 1);
+        assert(!loop.remove(sc0.handle()));
+        assert(loop.size() == 0);
+    }
+
+    auto test_async_ready(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        auto sp {create_socketpair(hints, sr.get())};
+        EventLoop loop {sr.get()};
+        const SocketCore sc0 {static_cast<handle_type>(*sp[0]),
+                              AF_UNIX, sr.get()};
+        assert(!sp[0]->set_nonblocking(true));
+        static_cast<void>(sp[1]->write("Hello"));
+
+        // Data that is already available is read without suspending
+        // or registering the handle.
+        std::string actual_str;
+        spawn(echo(loop, sc0, sc0, actual_str));
+        assert(actual_str == "Hello");
+        assert(loop.size() == 0);
+    }
+
+    auto test_async_reused(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        EventLoop loop {sr.get()};
+        auto handle {handle_null};
+
+        {
+            auto sp {create_socketpair(hints, sr.get())};
+            const SocketCore sc0 {static_cast<handle_type>(*sp[0]),
+                                  AF_UNIX, sr.get()};
+            assert(!sp[0]->set_nonblocking(true));
+            std::string actual_str;
+            spawn(echo(loop, sc0, sc0, actual_str));
+            static_cast<void>(sp[1]->write("Hello"));
+            assert(!loop.run());
+            handle = sc0.handle();
+        }
+
+        // A registration left by a closed socket does not hide a new
+        // socket that reuses its descriptor.
+        auto sp {create_socketpair(hints, sr.get())};
+        const std::size_t index {
+            static_cast<handle_type>(*sp[0]) == handle ? 0U : 1U
+        };
+        auto& reader {*sp[index]};
+        auto& writer {*sp[1 - index]};
+        assert(static_cast<handle_type>(reader) == handle);
+        const SocketCore sc {handle, AF_UNIX, sr.get()};
+        assert(!reader.set_nonblocking(true));
+        std::string actual_str;
+        spawn(echo(loop, sc, sc, actual_str));
+        static_cast<void>(writer.write("World"));
+        assert(!loop.run());
+        assert(actual_str == "World");
+    }
+
+    auto test_readiness(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        auto sp {create_socketpair(hints, sr.get())};
+        const auto& writer {*sp[1]};
+        EventLoop loop {sr.get()};
+        std::string actual_str;
+        auto calls {0};
+        auto& reader {*sp[0]};
+        const auto on_read = [&](handle_type handle,
+                                 EventLoop::Events events) {
+            assert(handle == static_cast<handle_type>(reader));
+            assert((events & EventLoop::events_read) != 0);
+            TextBuffer buffer {buffer_size};
+            static_cast<void>(reader.read(buffer));
+            actual_str = buffer;
+            ++calls;
+            // Removing the registration from within its own callback
+            // destroys the socket only after dispatching finishes.
+            static_cast<void>(loop.remove(handle));
+        };
+        assert(!loop.add(std::move(sp[0]), EventLoop::events_read, on_read));
+        assert(loop.size() == 1);
+        assert(!loop.run_once(0));
+        assert(calls == 0);
+        static_cast<void>(writer.write("Hello"));
+        assert(!loop.run_once(timeout));
+        assert(calls == 1);
+        assert(actual_str == "Hello");
+        assert(loop.size() == 0);
+        assert(!loop.run());
+    }
+
+    auto test_wait_registered(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        auto sp {create_socketpair(hints, sr.get())};
+        EventLoop loop {sr.get()};
+        const auto handle {static_cast<handle_type>(*sp[0])};
+        assert(!loop.add(handle, EventLoop::events_read,
+                         [](handle_type, EventLoop::Events) {}));
+        std::string actual_str;
+
+        try {
+            static_cast<void>(loop.wait(handle, EventLoop::events_read,
+                                        std::noop_coroutine()));
+        }
+        catch (const LogicError& error) {
+            actual_str = error.what();
+        }
+
+        assert(actual_str == "Handle is registered with a callback");
+        assert(!loop.remove(handle));
+        assert(loop.size() == 0);
+    }
+
+    auto test_stop(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        auto sp {create_socketpair(hints, sr.get())};
+        EventLoop loop {sr.get()};
+        auto calls {0};
+        const auto on_write = [&](handle_type, EventLoop::Events events) {
+            assert((events & EventLoop::events_write) != 0);
+            ++calls;
+            loop.stop();
+        };
+        const auto handle {static_cast<handle_type>(*sp[1])};
+        assert(!loop.add(handle, EventLoop::events_write, on_write));
+        assert(!loop.run());
+        assert(calls == 1);
+        assert(!loop.remove(handle));
+        assert(loop.size() == 0);
+    }
+#endif
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+#ifdef HAVE_EPOLL
+        test_add_invalid(sr);
+        test_async(sr);
+        test_async_ready(sr);
+        test_async_reused(sr);
+        test_readiness(sr);
+        test_stop(sr);
+        test_wait_registered(sr);
+#endif
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
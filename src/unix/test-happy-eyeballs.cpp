@@ -0,0 +1,333 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/assert.hpp"           // assert()
+#include "network/network.hpp"          // ApiOptions, ConnectOptions,
+                                        // Error, HostnameView,
+                                        // IoLatency,
+                                        // NameService, OpenInputs,
+                                        // OptionalHints, OsError,
+                                        // ResolveResult,
+                                        // Resolver, Runtime,
+                                        // RuntimeScope, ServiceView,
+                                        // SharedRuntime, SocketHints,
+                                        // SocketTemplate,
+                                        // SocketTemplateVector,
+                                        // TcpFastOpen, TextBuffer,
+                                        // UniqueSocket, accept(),
+                                        // create_socket(), open(), run(),
+                                        // to_bytestring()
+#include "network/opensymbol.hpp"       // OpenSymbol
+#include "network/parse.hpp"            // parse()
+
+#include <arpa/inet.h>      // htonl()
+#include <netdb.h>          // addrinfo
+#include <netinet/in.h>     // INADDR_LOOPBACK, in6addr_loopback,
+                            // sockaddr_in, sockaddr_in6
+#include <sys/socket.h>     // AF_INET, AF_INET6, AF_UNSPEC,
+                            // SOCK_STREAM, sockaddr
+
+#include <algorithm>    // std::ranges::equal()
+#include <cerrno>       // ECONNREFUSED, ENOENT
+#include <chrono>       // std::chrono::milliseconds,
+                        // std::chrono::steady_clock
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <cstring>      // std::memcpy()
+#include <expected>     // std::unexpected
+#include <iostream>     // std::cerr, std::cout, std::endl
+#include <memory>       // std::make_shared()
+#include <string>       // std::string
+#include <utility>      // std::move()
+
+namespace
+{
+    using Network::ApiOptions;
+    using Network::ConnectOptions;
+    using Network::Error;
+    using Network::HostnameView;
+    using Network::IoLatency;
+    using Network::NameService;
+    using Network::OpenInputs;
+    using Network::OpenSymbol;
+    using Network::OptionalHints;
+    using Network::OsError;
+    using Network::ResolveResult;
+    using Network::Resolver;
+    using Network::Runtime;
+    using Network::RuntimeScope;
+    using Network::ServiceView;
+    using Network::SharedRuntime;
+    using Network::SocketHints;
+    using Network::SocketTemplate;
+    using Network::SocketTemplateVector;
+    using Network::TcpFastOpen;
+    using Network::TextBuffer;
+    using Network::UniqueSocket;
+    using Network::accept;
+    using Network::create_socket;
+    using Network::open;
+    using Network::parse;
+    using Network::run;
+    using Network::to_bytestring;
+
+    using Clock = std::chrono::steady_clock;
+
+    constexpr HostnameView host {"dual-stack.test"};
+    constexpr ServiceView service {"0"};
+    constexpr SocketHints hints {AF_UNSPEC, SOCK_STREAM, 0};
+    constexpr SocketHints inet_hints {AF_INET, SOCK_STREAM, 0};
+    constexpr std::chrono::milliseconds attempt_delay {100};
+    constexpr auto fastopen_queue {5};
+
+    auto is_verbose {false};  // NOLINT
+
+    // Answer every lookup with a fixed list of addresses or error.
+    class FakeService final : public NameService
+    {
+    public:
+        explicit FakeService(ResolveResult t_result) :
+            m_result(std::move(t_result))
+        {
+        }
+
+        FakeService(const FakeService&) noexcept = delete;
+        FakeService(FakeService&&) noexcept = delete;
+        ~FakeService() noexcept final = default;
+        auto operator=(const FakeService&) noexcept -> FakeService& = delete;
+        auto operator=(FakeService&&) noexcept -> FakeService& = delete;
+
+        [[nodiscard]] auto lookup(const HostnameView& t_hostname,
+                                  const ServiceView& t_service,
+                                  const OptionalHints& t_hints,
+                                  const Runtime* t_rt) const ->
+            ResolveResult final
+        {
+            static_cast<void>(t_hostname);
+            static_cast<void>(t_service);
+            static_cast<void>(t_hints);
+            static_cast<void>(t_rt);
+            return m_result;
+        }
+
+    private:
+        ResolveResult m_result;
+    };
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto create_listener(const SharedRuntime& sr,
+                         int backlog) -> UniqueSocket
+    {
+        auto listener {create_socket(inet_hints, sr.get())};
+        sockaddr_in sin {};
+        sin.sin_family = AF_INET;
+        sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        const auto bs {to_bytestring(&sin, sizeof sin)};
+        assert(!listener->open(bs, OpenSymbol::bind));
+
+        if (backlog >= 0) {
+            assert(!listener->listen(backlog));
+        }
+
+        return listener;
+    }
+
+    auto to_template(const UniqueSocket& listener) -> SocketTemplate
+    {
+        const auto bs {listener->get_sockname()};
+        sockaddr_in sin {};
+        std::memcpy(&sin, bs.data(), sizeof sin);
+        void* pointer {&sin};
+        addrinfo ai {};
+        ai.ai_family = AF_INET;
+        ai.ai_socktype = SOCK_STREAM;
+        ai.ai_addr = static_cast<sockaddr*>(pointer);
+        ai.ai_addrlen = sizeof sin;
+        return SocketTemplate {ai};
+    }
+
+    auto to_template6(const UniqueSocket& listener) -> SocketTemplate
+    {
+        const auto bs {listener->get_sockname()};
+        sockaddr_in sin {};
+        std::memcpy(&sin, bs.data(), sizeof sin);
+        sockaddr_in6 sin6 {};
+        sin6.sin6_family = AF_INET6;
+        sin6.sin6_addr = in6addr_loopback;
+        sin6.sin6_port = sin.sin_port;
+        void* pointer {&sin6};
+        addrinfo ai {};
+        ai.ai_family = AF_INET6;
+        ai.ai_socktype = SOCK_STREAM;
+        ai.ai_addr = static_cast<sockaddr*>(pointer);
+        ai.ai_addrlen = sizeof sin6;
+        return SocketTemplate {ai};
+    }
+
+    auto connect(const SocketTemplateVector& stv,
+                 const ConnectOptions& options) -> Network::SocketResult
+    {
+        const auto fake {std::make_shared<FakeService>(stv)};
+        const auto resolver {std::make_shared<Resolver>(fake)};
+        const auto sr {run(ApiOptions {resolver}, RuntimeScope::shared)};
+        const OpenInputs oi {{host, service}, hints, sr.get()};
+        return open(oi, options);
+    }
+
+    auto is_connected(const UniqueSocket& client,
+                      const UniqueSocket& listener) -> bool
+    {
+        return std::ranges::equal(client->get_peername(),
+                                  listener->get_sockname());
+    }
+
+    auto test_fallback(const SharedRuntime& sr) -> void
+    {
+        // Nothing listens on the IPv6 loopback address at this port,
+        // or IPv6 is unavailable, so that attempt fails at once.
+        const auto listener {create_listener(sr, 1)};
+        const auto result {connect({to_template6(listener),
+                                    to_template(listener)}, {})};
+        assert(result);
+        assert(is_connected(*result, listener));
+    }
+
+    auto test_fastopen(const SharedRuntime& sr) -> void
+    {
+        const auto listener {create_listener(sr, 1)};
+
+        // The kernel may not allow server-side Fast Open.
+        static_cast<void>(listener->set_option<TcpFastOpen>(fastopen_queue));
+        ConnectOptions options;
+        options.m_data = "Hello";
+        options.m_is_fastopen = true;
+        const auto result {connect({to_template(listener)}, options)};
+        assert(result);
+        const auto server {accept(*listener)};
+        TextBuffer buffer {options.m_data.size()};
+        assert(server->read(buffer) > 0);
+        assert(std::string {buffer} == options.m_data);
+    }
+
+    auto test_latency(const SharedRuntime& sr) -> void
+    {
+        // The connect latency is recorded once the attempt completes,
+        // not when the non-blocking call returns.
+        const auto listener {create_listener(sr, 1)};
+        const auto fake {std::make_shared<FakeService>(
+            SocketTemplateVector {to_template(listener)})};
+        const auto resolver {std::make_shared<Resolver>(fake)};
+        const auto rt {run(ApiOptions {resolver}, RuntimeScope::shared)};
+        auto* const stats {rt->stats()};
+        assert(stats != nullptr);
+        const auto before {stats->snapshot()};
+        const OpenInputs oi {{host, service}, hints, rt.get()};
+        const auto result {open(oi, ConnectOptions {})};
+        assert(result);
+        const auto after {stats->snapshot()};
+        assert(after.m_connects == before.m_connects + 1);
+        const auto index {static_cast<std::size_t>(IoLatency::connect)};
+        assert(after.m_latencies[index].m_count ==
+               before.m_latencies[index].m_count + 1);
+    }
+
+    auto test_race(const SharedRuntime& sr) -> void
+    {
+        // A listener whose accept queue is full drops further SYNs,
+        // so an attempt to connect to it stalls.
+        const auto stalled {create_listener(sr, 0)};
+        const auto filler {create_socket(inet_hints, sr.get())};
+        assert(!filler->set_nonblocking(true));
+        static_cast<void>(filler->open(stalled->get_sockname(),
+                                       OpenSymbol::connect));
+        const auto listener {create_listener(sr, 1)};
+        ConnectOptions options;
+        options.m_attempt_delay = attempt_delay;
+        const auto start {Clock::now()};
+        const auto result {connect({to_template(stalled),
+                                    to_template(listener)}, options)};
+        assert(result);
+        assert(Clock::now() - start >= attempt_delay);
+        assert(is_connected(*result, listener));
+    }
+
+    auto test_refused(const SharedRuntime& sr) -> void
+    {
+        // A bound socket that is not listening refuses connections.
+        const auto closed {create_listener(sr, -1)};
+        const auto result {connect({to_template(closed)}, {})};
+        assert(!result);
+
+        if (is_verbose) {
+            std::cout << "Error: "
+                      << result.error().string()
+                      << std::endl;
+        }
+
+        assert(result.error().number() == ECONNREFUSED);
+    }
+
+    auto test_unresolved() -> void
+    {
+        // A failed lookup is returned rather than thrown.
+        const OsError lookup_error {ENOENT, "No such host"};
+        const auto fake {std::make_shared<FakeService>(
+            std::unexpected {lookup_error})};
+        const auto resolver {std::make_shared<Resolver>(fake)};
+        const auto sr {run(ApiOptions {resolver}, RuntimeScope::shared)};
+        const OpenInputs oi {{host, service}, hints, sr.get()};
+        const auto result {open(oi, ConnectOptions {})};
+        assert(!result);
+        assert(result.error().number() == ENOENT);
+    }
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+        test_fallback(sr);
+        test_fastopen(sr);
+        test_latency(sr);
+        test_race(sr);
+        test_refused(sr);
+        test_unresolved();
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
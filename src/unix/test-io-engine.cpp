@@ -0,0 +1,269 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/assert.hpp"           // assert()
+#include "network/ioengine.hpp"         // IoEngine
+#include "network/network.hpp"          // ApiOptions, Error, IoMode,
+                                        // Runtime, RuntimeScope,
+                                        // SocketCore, SocketHints,
+                                        // UnixSocketHints,
+                                        // create_socket(),
+                                        // create_socketpair(),
+                                        // handle_type, run()
+#include "network/parse.hpp"            // parse()
+
+#include <sys/socket.h>     // AF_UNIX, SOCK_STREAM
+
+#include <cerrno>       // EBADF
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <iostream>     // std::cerr, std::cout, std::endl
+#include <string>       // std::string
+#include <vector>       // std::vector
+
+namespace
+{
+    using Network::ApiOptions;
+    using Network::CharSpan;
+    using Network::Error;
+    using Network::IoCompletion;
+    using Network::IoEngine;
+    using Network::IoMode;
+    using Network::Runtime;
+    using Network::RuntimeScope;
+    using Network::SocketCore;
+    using Network::SocketHints;
+    using Network::UnixSocketHints;
+    using Network::create_socket;
+    using Network::create_socketpair;
+    using Network::handle_type;
+    using Network::parse;
+    using Network::run;
+
+    constexpr auto buffer_size {16};
+    constexpr std::size_t overflow_count {64};
+    constexpr unsigned ring_size_small {4};
+    constexpr auto socket_path {"/tmp/test-io-engine.socket"};
+
+    auto is_verbose {false};  // NOLINT
+
+    auto get_core(const Network::Socket& s, const Runtime* rt) -> SocketCore
+    {
+        return {static_cast<handle_type>(s), AF_UNIX, rt};
+    }
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto print(const IoEngine& engine) -> void
+    {
+        if (is_verbose) {
+            std::cout << "Engine mode: "
+                      << (engine.mode() == IoMode::io_uring ?
+                          "io_uring" : "standard")
+                      << std::endl;
+        }
+    }
+
+    auto wait(IoEngine& engine, std::size_t count) -> std::vector<IoCompletion>
+    {
+        std::vector<IoCompletion> completions;
+
+        while (completions.size() < count) {
+            const auto batch {engine.submit()};
+            completions.insert(completions.end(), batch.begin(), batch.end());
+        }
+
+        return completions;
+    }
+
+    auto test_accept(const Runtime* rt) -> void
+    {
+        const UnixSocketHints hints {SOCK_STREAM};
+        const auto listener {create_socket(hints, rt)};
+        assert(!listener->bind(socket_path));
+        assert(!listener->listen(2));
+        const auto client_1 {create_socket(hints, rt)};
+        const auto client_2 {create_socket(hints, rt)};
+        assert(!client_1->connect(socket_path));
+        assert(!client_2->connect(socket_path));
+        IoEngine engine {rt};
+        const auto sc {get_core(*listener, rt)};
+        const auto is_ring {engine.mode() == IoMode::io_uring};
+        std::size_t count {0};
+
+        while (count < 2) {
+            // Only a ring keeps a multishot accept armed.
+            if (engine.pending() == 0) {
+                engine.accept(sc, 1, true);
+            }
+
+            for (const auto& completion : engine.submit()) {
+                assert(!completion.error());
+                assert(completion.data() == 1);
+                assert(completion.is_more() == is_ring);
+                assert(completion.result() >= 0);
+                const auto handle {
+                    static_cast<handle_type>(completion.result())
+                };
+                static_cast<void>(create_socket(handle, AF_UNIX, rt));
+                ++count;
+            }
+        }
+
+        assert(engine.pending() == (is_ring ? 1U : 0U));
+    }
+
+    auto test_invalid(const Runtime* rt) -> void
+    {
+        const UnixSocketHints hints {SOCK_STREAM};
+        IoEngine engine {rt};
+        // The handle of a socket which has already been closed
+        const auto handle {
+            static_cast<handle_type>(*create_socket(hints, rt))
+        };
+        std::string buffer(buffer_size, '\0');
+        engine.read({handle, AF_UNIX, rt}, buffer, 1);
+        const auto completions {wait(engine, 1)};
+        const auto& error {completions.front().error()};
+
+        if (is_verbose) {
+            std::cout << "Error: " << error.string() << std::endl;
+        }
+
+        assert(error.number() == EBADF);
+        assert(error.string().starts_with("Call to "));
+        assert(engine.pending() == 0);
+    }
+
+    auto test_overflow(const Runtime* rt) -> void
+    {
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        const auto sp {create_socketpair(hints, rt)};
+
+        // Queue many more writes than a small ring's completion queue
+        // holds, so that completions overflow it.
+        IoEngine engine {rt, ring_size_small};
+
+        for (std::size_t i {0}; i < overflow_count; ++i) {
+            engine.write(get_core(*sp[1], rt), "!", i);
+        }
+
+        const auto completions {wait(engine, overflow_count)};
+        assert(completions.size() == overflow_count);
+
+        for (const auto& completion : completions) {
+            assert(!completion.error());
+            assert(completion.result() == 1);
+        }
+
+        assert(engine.pending() == 0);
+    }
+
+    auto test_read_write(const Runtime* rt) -> void
+    {
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        const auto sp {create_socketpair(hints, rt)};
+        IoEngine engine {rt};
+        print(engine);
+        std::string buffer(buffer_size, '\0');
+        engine.write(get_core(*sp[1], rt), "Hello", 1);
+        engine.read(get_core(*sp[0], rt), buffer, 2);
+        assert(engine.pending() != 0);
+
+        for (const auto& completion : wait(engine, 2)) {
+            assert(!completion.error());
+            assert(completion.result() == 5);
+            assert(!completion.is_more());
+        }
+
+        assert(buffer.starts_with("Hello"));
+        assert(engine.pending() == 0);
+    }
+
+    auto test_registered(const Runtime* rt) -> void
+    {
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        const auto sp {create_socketpair(hints, rt)};
+        IoEngine engine {rt};
+        std::string buffer_0(buffer_size, '\0');
+        std::string buffer_1(buffer_size, '\0');
+        const std::vector<CharSpan> buffers {buffer_0, buffer_1};
+        const auto error {engine.register_buffers(buffers)};
+
+        if (is_verbose && error) {
+            std::cout << "Error: " << error.string() << std::endl;
+        }
+
+        engine.write(get_core(*sp[1], rt), "World", 1);
+        engine.read(get_core(*sp[0], rt), 1, 2);
+        const auto completions {wait(engine, 2)};
+        assert(completions.size() == 2);
+        assert(buffer_1.starts_with("World"));
+
+        try {
+            engine.read(get_core(*sp[0], rt), 2, 3);
+            assert(false);
+        }
+        catch (const Error& read_error) {
+            if (is_verbose) {
+                std::cout << "Error: " << read_error.what() << std::endl;
+            }
+        }
+    }
+
+    auto test(IoMode mode) -> void
+    {
+        const auto sr {run(ApiOptions {mode, is_verbose},
+                           RuntimeScope::shared)};
+        const auto* rt {sr.get()};
+        test_read_write(rt);
+        test_registered(rt);
+        test_accept(rt);
+        test_invalid(rt);
+        test_overflow(rt);
+    }
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        test(IoMode::standard);
+        test(IoMode::io_uring);
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
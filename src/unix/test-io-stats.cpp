@@ -0,0 +1,337 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/assert.hpp"           // assert()
+#include "network/network.hpp"          // ApiOptions, Error, IoCounter,
+                                        // IoLatency, IoStats,
+                                        // IoStatsSnapshot,
+                                        // LatencyHistogram,
+                                        // RuntimeScope, SharedRuntime,
+                                        // SocketCore, SocketHints,
+                                        // SocketStats, accept_result(),
+                                        // create_socketpair(),
+                                        // CharSpan, handle_type,
+                                        // read_result(),
+                                        // receive_message(), run(),
+                                        // send_message(),
+                                        // set_nonblocking(),
+                                        // write_result()
+#include "network/parse.hpp"            // parse()
+
+#include <sys/socket.h>     // AF_UNIX, SOCK_STREAM
+
+#include <array>        // std::array
+#include <chrono>       // std::chrono::microseconds
+#include <cerrno>       // EAGAIN
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <iostream>     // std::cerr, std::cout, std::endl
+#include <sstream>      // std::ostringstream
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <thread>       // std::jthread
+#include <vector>       // std::vector
+
+namespace
+{
+    using Network::ApiOptions;
+    using Network::CharSpan;
+    using Network::Error;
+    using Network::IoCounter;
+    using Network::IoLatency;
+    using Network::IoStats;
+    using Network::IoStatsSnapshot;
+    using Network::LatencyHistogram;
+    using Network::RuntimeScope;
+    using Network::SharedRuntime;
+    using Network::SocketCore;
+    using Network::SocketHints;
+    using Network::SocketStats;
+    using Network::accept_result;
+    using Network::create_socketpair;
+    using Network::handle_type;
+    using Network::parse;
+    using Network::read_result;
+    using Network::receive_message;
+    using Network::run;
+    using Network::send_message;
+    using Network::set_nonblocking;
+    using Network::write_result;
+
+    constexpr auto latency_count {1000};
+    constexpr auto thread_count {8};
+    constexpr auto thread_iterations {10000};
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto print(const IoStatsSnapshot& snapshot) -> void
+    {
+        if (is_verbose) {
+            std::cout << snapshot;
+        }
+    }
+
+    auto test_concurrent() -> void
+    {
+        IoStats stats;
+
+        {
+            std::vector<std::jthread> threads;
+
+            for (auto i {0}; i < thread_count; ++i) {
+                threads.emplace_back([&] {
+                    for (auto j {0}; j < thread_iterations; ++j) {
+                        stats.add(IoCounter::bytes_read, 2);
+                        stats.add(IoCounter::system_calls);
+                    }
+                });
+            }
+        }
+
+        const auto snapshot {stats.snapshot()};
+        assert(snapshot.m_bytes_read == 2ULL * thread_count *
+               thread_iterations);
+        assert(snapshot.m_system_calls == 1ULL * thread_count *
+               thread_iterations);
+        assert(snapshot.m_errors == 0);
+    }
+
+    auto is_near(std::chrono::microseconds actual,
+                 std::chrono::microseconds expected) -> bool
+    {
+        // Buckets are one eighth of a power of two wide.
+        return actual >= expected && actual <= expected + expected / 8;
+    }
+
+    auto test_histogram() -> void
+    {
+        using std::chrono::microseconds;
+
+        LatencyHistogram histogram;
+        assert(histogram.count() == 0);
+        assert(histogram.percentile(50).count() == 0);
+
+        for (auto i {1}; i <= latency_count; ++i) {
+            histogram.record(microseconds {i});
+        }
+
+        assert(histogram.count() == latency_count);
+        assert(histogram.max() == microseconds {latency_count});
+        assert(is_near(std::chrono::duration_cast<microseconds>
+                       (histogram.percentile(50)), microseconds {500}));
+        assert(is_near(std::chrono::duration_cast<microseconds>
+                       (histogram.percentile(99)), microseconds {990}));
+        assert(histogram.percentile(100) == histogram.max());
+
+        const auto summary {histogram.summary()};
+        assert(summary.m_count == latency_count);
+        assert(summary.m_p50 <= summary.m_p99);
+        assert(summary.m_p99 <= summary.m_p999);
+        assert(summary.m_p999 <= summary.m_max);
+
+        for (std::size_t i {0}; i < LatencyHistogram::bucket_count; ++i) {
+            const auto value {LatencyHistogram::to_value(i)};
+            assert(LatencyHistogram::to_index(value) == i);
+        }
+    }
+
+    auto test_merge() -> void
+    {
+        LatencyHistogram total;
+
+        {
+            std::vector<std::jthread> threads;
+
+            for (auto i {0}; i < thread_count; ++i) {
+                threads.emplace_back([&, i] {
+                    LatencyHistogram local;
+
+                    for (auto j {0}; j < thread_iterations; ++j) {
+                        local.record(std::chrono::nanoseconds {i + j});
+                    }
+
+                    total.merge(local);
+                });
+            }
+        }
+
+        assert(total.count() == 1ULL * thread_count * thread_iterations);
+        assert(total.max().count() == thread_count + thread_iterations - 2);
+    }
+
+    auto test_latency(const SharedRuntime& sr) -> void
+    {
+        auto* const stats {sr->stats()};
+        const auto before {stats->snapshot()};
+        const auto index {static_cast<std::size_t>(IoLatency::accept)};
+
+        {
+            const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+            auto sp {create_socketpair(hints, sr.get())};
+            const SocketCore sc {static_cast<handle_type>(*sp[0]),
+                                 AF_UNIX, sr.get()};
+
+            // A blocking accept would time the wait for a client, so
+            // its latency is not recorded.
+            assert(!accept_result(sc));
+            assert(stats->latency(IoLatency::accept).count() ==
+                   before.m_latencies[index].m_count);
+
+            // A connected socket cannot accept, but the failed
+            // non-blocking call still has its latency recorded.
+            assert(!set_nonblocking(sc));
+            assert(!accept_result(sc));
+        }
+
+        const auto snapshot {stats->snapshot()};
+        print(snapshot);
+        const auto& accept {snapshot.m_latencies[index]};
+        assert(accept.m_count == before.m_latencies[index].m_count + 1);
+        assert(accept.m_p50 <= accept.m_max);
+        assert(stats->latency(IoLatency::connect).count() == 0);
+
+        std::ostringstream oss;
+        oss << snapshot;
+        const auto str {oss.str()};
+        assert(str.find("accept_count 1\n") != std::string::npos);
+        assert(str.find("accept_p99_ns ") != std::string::npos);
+    }
+
+    auto test_message(const SharedRuntime& sr) -> void
+    {
+        SocketStats stats_0;
+        SocketStats stats_1;
+
+        {
+            const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+            auto sp {create_socketpair(hints, sr.get())};
+            const SocketCore sc0 {
+                SocketCore {static_cast<handle_type>(*sp[0]),
+                            AF_UNIX, sr.get()},
+                &stats_0
+            };
+            const SocketCore sc1 {
+                SocketCore {static_cast<handle_type>(*sp[1]),
+                            AF_UNIX, sr.get()},
+                &stats_1
+            };
+            const std::array<std::string_view, 2> svs {"Hello", ", world"};
+            assert(send_message(sc0, svs) == 12);
+            std::array<char, 6> buffer_0 {};
+            std::array<char, 6> buffer_1 {};
+            const std::array<CharSpan, 2> css {buffer_0, buffer_1};
+            assert(receive_message(sc1, css).m_size == 12);
+        }
+
+        const auto snapshot_0 {stats_0.snapshot()};
+        print(snapshot_0);
+        assert(snapshot_0.m_bytes_written == 12);
+        assert(snapshot_0.m_system_calls == 1);
+        const auto snapshot_1 {stats_1.snapshot()};
+        print(snapshot_1);
+        assert(snapshot_1.m_bytes_read == 12);
+        assert(snapshot_1.m_system_calls == 1);
+    }
+
+    auto test_runtime(const SharedRuntime& sr) -> void
+    {
+        auto* const stats {sr->stats()};
+        assert(stats != nullptr);
+        assert(stats->snapshot().m_system_calls == 0);
+        SocketStats socket_stats;
+
+        {
+            const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+            auto sp {create_socketpair(hints, sr.get())};
+            const SocketCore sc0 {
+                SocketCore {static_cast<handle_type>(*sp[0]),
+                            AF_UNIX, sr.get()},
+                &socket_stats
+            };
+            const SocketCore sc1 {static_cast<handle_type>(*sp[1]),
+                                  AF_UNIX, sr.get()};
+            assert(sc0.socket_stats() == &socket_stats);
+            assert(sc1.socket_stats() == nullptr);
+            assert(!set_nonblocking(sc1));
+            std::array<char, 5> buffer {};
+            assert(!read_result(sc1, buffer));
+            assert(write_result(sc0, "Hello").value_or(0) == 5);
+            assert(read_result(sc1, buffer).value_or(0) == 5);
+        }
+
+        const auto socket_snapshot {socket_stats.snapshot()};
+        print(socket_snapshot);
+        assert(socket_snapshot.m_bytes_written == 5);
+        assert(socket_snapshot.m_bytes_read == 0);
+        assert(socket_snapshot.m_system_calls == 1);
+        assert(socket_snapshot.m_errors == 0);
+
+        const auto snapshot {stats->snapshot()};
+        print(snapshot);
+        assert(snapshot.m_again == 1);
+        assert(snapshot.m_bytes_read == 5);
+        assert(snapshot.m_bytes_written == 5);
+        assert(snapshot.m_closes == 2);
+        assert(snapshot.m_errors == 1);
+        assert(snapshot.m_errors_by_number[EAGAIN] == 1);
+
+        std::ostringstream oss;
+        oss << snapshot;
+        const auto str {oss.str()};
+        assert(str.find("bytes_written 5\n") != std::string::npos);
+        assert(str.find("closes 2\n") != std::string::npos);
+        assert(str.find("error " + std::to_string(EAGAIN) + " 1\n") !=
+               std::string::npos);
+    }
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(ApiOptions {is_verbose}, RuntimeScope::shared)};
+        test_concurrent();
+        test_histogram();
+        test_merge();
+        test_runtime(sr);
+        test_latency(sr);
+        test_message(sr);
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
@@ -0,0 +1,242 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/assert.hpp"           // assert()
+#include "network/network.hpp"          // Error, SharedRuntime,
+                                        // Socket, SocketCore,
+                                        // SocketHints, SpliceRelay,
+                                        // TextBuffer,
+                                        // create_socketpair(),
+                                        // handle_type, run()
+#include "network/os-features.hpp"      // HAVE_SENDFILE, HAVE_SPLICE
+#include "network/parse.hpp"            // parse()
+
+#include <sys/socket.h>     // AF_UNIX, SOCK_STREAM
+#include <unistd.h>         // ::close(), ::unlink(), ::write()
+
+#include <csignal>      // SIGPIPE, SIG_IGN, std::signal()
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit(), ::mkstemp()
+#include <filesystem>   // std::filesystem::temp_directory_path()
+#include <iostream>     // std::cerr, std::cout, std::endl
+#include <regex>        // std::regex, std::regex_match
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <utility>      // std::cmp_equal(), std::cmp_less()
+
+namespace
+{
+    using Network::Error;
+    using Network::SharedRuntime;
+    using Network::Socket;
+    using Network::SocketHints;
+    using Network::TextBuffer;
+    using Network::create_socketpair;
+    using Network::parse;
+    using Network::run;
+#ifdef HAVE_SPLICE
+    using Network::SocketCore;
+    using Network::SpliceRelay;
+    using Network::handle_type;
+#endif
+
+    constexpr auto buffer_size {16};
+    constexpr std::size_t file_size {1 << 24};
+    constexpr std::string_view contents {"Hello, World!"};
+    constexpr auto expected_open_re {
+        R"(Call to ::open\(.+\) failed with error \d+: .+)"
+    };
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto read_string(const Socket& socket) -> std::string
+    {
+        TextBuffer buffer {buffer_size};
+        static_cast<void>(socket.read(buffer));
+        return buffer;
+    }
+
+#ifdef HAVE_SENDFILE
+    auto print(const Error& error) -> void
+    {
+        if (is_verbose) {
+            std::cout << "Exception: "
+                      << error.what()
+                      << std::endl;
+        }
+    }
+
+    auto test_send_file(const SharedRuntime& sr) -> void
+    {
+        auto path {(std::filesystem::temp_directory_path() /
+                    "test-send-file-XXXXXX").string()};
+        const auto handle {::mkstemp(path.data())};
+        assert(handle != -1);
+        assert(std::cmp_equal(::write(handle,
+                                      contents.data(),
+                                      contents.size()),
+                              contents.size()));
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        auto sp {create_socketpair(hints, sr.get())};
+        assert(sp[0]->send_file(handle, 7, 5) == 5);
+        assert(read_string(*sp[1]) == "World");
+        assert(sp[0]->send_file(path, 0, 5) == 5);
+        assert(read_string(*sp[1]) == "Hello");
+
+        // Requesting more than the file holds stops at the end of file.
+        assert(sp[0]->send_file(handle, 7, buffer_size) == 6);
+        assert(read_string(*sp[1]) == "World!");
+        static_cast<void>(::close(handle));
+        static_cast<void>(::unlink(path.c_str()));
+    }
+
+    auto test_send_file_partial(const SharedRuntime& sr) -> void
+    {
+        auto path {(std::filesystem::temp_directory_path() /
+                    "test-send-file-XXXXXX").string()};
+        const auto handle {::mkstemp(path.data())};
+        assert(handle != -1);
+        const std::string data(file_size, 'x');
+        assert(std::cmp_equal(::write(handle, data.data(), data.size()),
+                              data.size()));
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        auto sp {create_socketpair(hints, sr.get())};
+        assert(!sp[0]->set_nonblocking(true));
+
+        // The file is larger than the socket buffer, so the transfer
+        // stops short once the buffer fills, without throwing.
+        const auto sent {sp[0]->send_file(handle, 0, file_size)};
+        assert(sent > 0);
+        assert(std::cmp_less(sent, file_size));
+        static_cast<void>(::close(handle));
+        static_cast<void>(::unlink(path.c_str()));
+    }
+
+    auto test_send_file_invalid(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        auto sp {create_socketpair(hints, sr.get())};
+        std::string actual_str;
+
+        try {
+            static_cast<void>(sp[0]->send_file("/nonexistent", 0, 1));
+        }
+        catch (const Error& error) {
+            print(error);
+            actual_str = error.what();
+        }
+
+        const std::regex expected_regex {expected_open_re};
+        assert(std::regex_match(actual_str, expected_regex));
+    }
+#endif
+
+#ifdef HAVE_SPLICE
+    auto test_splice_relay(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        auto input {create_socketpair(hints, sr.get())};
+        auto output {create_socketpair(hints, sr.get())};
+        const SocketCore input_sc {static_cast<handle_type>(*input[0]),
+                                   AF_UNIX, sr.get()};
+        const SocketCore output_sc {static_cast<handle_type>(*output[1]),
+                                    AF_UNIX, sr.get()};
+        SpliceRelay relay {sr.get()};
+        static_cast<void>(input[1]->write(contents));
+        assert(relay.relay(input_sc, output_sc, contents.size()) ==
+               contents.size());
+        assert(read_string(*output[0]) == contents);
+    }
+
+    auto test_splice_relay_reuse(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        auto input {create_socketpair(hints, sr.get())};
+        const SocketCore input_sc {static_cast<handle_type>(*input[0]),
+                                   AF_UNIX, sr.get()};
+        SpliceRelay relay {sr.get()};
+        std::string actual_str;
+
+        {
+            // The output peer closes before the relay, so the bytes
+            // spliced into the pipe cannot be delivered.
+            auto output {create_socketpair(hints, sr.get())};
+            const SocketCore output_sc {static_cast<handle_type>(*output[1]),
+                                        AF_UNIX, sr.get()};
+            output[0].reset();
+            static_cast<void>(input[1]->write(contents));
+
+            try {
+                static_cast<void>(relay.relay(input_sc, output_sc,
+                                              contents.size()));
+            }
+            catch (const Error& error) {
+                actual_str = error.what();
+            }
+        }
+
+        assert(!actual_str.empty());
+        auto output {create_socketpair(hints, sr.get())};
+        const SocketCore output_sc {static_cast<handle_type>(*output[1]),
+                                    AF_UNIX, sr.get()};
+        static_cast<void>(input[1]->write("Bye"));
+        assert(relay.relay(input_sc, output_sc, 3) == 3);
+        assert(read_string(*output[0]) == "Bye");
+    }
+#endif
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        static_cast<void>(std::signal(SIGPIPE, SIG_IGN));
+        const auto sr {run(is_verbose)};
+#ifdef HAVE_SENDFILE
+        test_send_file(sr);
+        test_send_file_partial(sr);
+        test_send_file_invalid(sr);
+#endif
+#ifdef HAVE_SPLICE
+        test_splice_relay(sr);
+        test_splice_relay_reuse(sr);
+#endif
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
@@ -0,0 +1,186 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/assert.hpp"           // assert()
+#include "network/inetsocket.hpp"       // InetSocket
+#include "network/network.hpp"          // Error, SharedRuntime,
+                                        // SocketHints,
+                                        // UniqueSocket, ZeroCopy,
+                                        // ZeroCopyCompletion, accept(),
+                                        // create_socket(), run(),
+                                        // to_bytestring(), to_size()
+#include "network/opensymbol.hpp"       // OpenSymbol
+#include "network/os-features.hpp"      // HAVE_ZEROCOPY
+#include "network/parse.hpp"            // parse()
+
+#include <arpa/inet.h>      // htonl()
+#include <netinet/in.h>     // INADDR_LOOPBACK, sockaddr_in
+#include <sys/socket.h>     // AF_INET, SOCK_STREAM
+
+#include <array>        // std::array
+#include <chrono>       // std::chrono::seconds,
+                        // std::chrono::steady_clock
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <iostream>     // std::cerr, std::cout, std::endl
+#include <string_view>  // std::string_view
+#include <thread>       // std::this_thread::yield()
+
+namespace
+{
+    using Network::Error;
+    using Network::InetSocket;
+    using Network::OpenSymbol;
+    using Network::SharedRuntime;
+    using Network::SocketHints;
+    using Network::UniqueSocket;
+    using Network::accept;
+    using Network::create_socket;
+    using Network::parse;
+    using Network::run;
+    using Network::to_bytestring;
+    using Network::to_size;
+#ifdef HAVE_ZEROCOPY
+    using Network::ZeroCopy;
+    using Network::ZeroCopyCompletion;
+#endif
+
+    using Clock = std::chrono::steady_clock;
+
+    constexpr std::string_view message {"Hello"};
+    constexpr std::size_t send_count {4};
+    constexpr std::chrono::seconds timeout {5};
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+#ifdef HAVE_ZEROCOPY
+    auto create_listener(const SharedRuntime& sr) -> UniqueSocket
+    {
+        const SocketHints hints {AF_INET, SOCK_STREAM, 0};
+        auto listener {create_socket(hints, sr.get())};
+        sockaddr_in sin {};
+        sin.sin_family = AF_INET;
+        sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        const auto bs {to_bytestring(&sin, sizeof sin)};
+        assert(!listener->open(bs, OpenSymbol::bind));
+        assert(!listener->listen(1));
+        return listener;
+    }
+
+    auto test_empty(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_INET, SOCK_STREAM, 0};
+        const auto socket {create_socket(hints, sr.get())};
+        const auto& inet {dynamic_cast<const InetSocket&>(*socket)};
+        std::array<ZeroCopyCompletion, send_count> completions {};
+        assert(inet.reap_zerocopy(completions) == 0);
+    }
+
+    auto test_send(const SharedRuntime& sr) -> void
+    {
+        const auto listener {create_listener(sr)};
+        const SocketHints hints {AF_INET, SOCK_STREAM, 0};
+        const auto client {create_socket(hints, sr.get())};
+
+        if (const auto error {client->set_option<ZeroCopy>(true)}) {
+            // Kernels before 4.14 do not support SO_ZEROCOPY.
+            if (is_verbose) {
+                std::cout << "Error: "
+                          << error.string()
+                          << std::endl;
+            }
+
+            return;
+        }
+
+        assert(client->get_option<ZeroCopy>() == true);
+        assert(!client->open(listener->get_sockname(), OpenSymbol::connect));
+        const auto server {accept(*listener)};
+        const auto& inet {dynamic_cast<const InetSocket&>(*client)};
+
+        for (std::size_t i {0}; i < send_count; ++i) {
+            assert(to_size(inet.send_zerocopy(message)) == message.size());
+        }
+
+        std::array<char, message.size() * send_count> buffer {};
+
+        for (std::size_t total {0}; total < buffer.size();) {
+            const auto ssize {server->read({buffer.data() + total,
+                                            buffer.size() - total})};
+            assert(ssize > 0);
+            total += to_size(ssize);
+        }
+
+        std::array<ZeroCopyCompletion, send_count> completions {};
+        const auto deadline {Clock::now() + timeout};
+        std::size_t count {0};
+        std::size_t completed {0};
+
+        // Notifications arrive asynchronously, and ranges are
+        // reported in ascending order without gaps.
+        while (completed < send_count && Clock::now() < deadline) {
+            const auto size {inet.reap_zerocopy({completions.data() + count,
+                                                 send_count - count})};
+
+            for (std::size_t i {count}; i < count + size; ++i) {
+                assert(completions[i].m_first == completed);
+                completed += completions[i].size();
+            }
+
+            count += size;
+            std::this_thread::yield();
+        }
+
+        assert(completed == send_count);
+    }
+#endif
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+#ifdef HAVE_ZEROCOPY
+        test_empty(sr);
+        test_send(sr);
+#endif
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
@@ -0,0 +1,236 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/assert.hpp"           // assert()
+#include "network/network.hpp"          // Error, LogicError,
+                                        // SharedRuntime,
+                                        // ShardedListener, SocketHints,
+                                        // UniqueSocket, create_socket(),
+                                        // run()
+#include "network/opensymbol.hpp"       // OpenSymbol
+#include "network/os-features.hpp"      // HAVE_ACCEPT4, HAVE_REUSEPORT
+#include "network/parse.hpp"            // parse()
+
+#include <netdb.h>          // AI_PASSIVE
+#include <sys/resource.h>   // RLIMIT_NOFILE, ::getrlimit(),
+                            // ::setrlimit(), rlimit
+#include <sys/socket.h>     // AF_INET, SOCK_STREAM
+#include <unistd.h>         // ::close(), ::dup()
+
+#include <algorithm>    // std::min()
+#include <atomic>       // std::atomic
+#include <chrono>       // std::chrono::milliseconds,
+                        // std::chrono::seconds,
+                        // std::chrono::steady_clock
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <iostream>     // std::cerr, std::endl
+#include <string>       // std::string
+#include <thread>       // std::this_thread::sleep_for(),
+                        // std::this_thread::yield()
+#include <vector>       // std::vector
+
+namespace
+{
+    using Network::Error;
+    using Network::LogicError;
+    using Network::OpenSymbol;
+    using Network::SharedRuntime;
+    using Network::SocketHints;
+    using Network::UniqueSocket;
+    using Network::create_socket;
+    using Network::parse;
+    using Network::run;
+#if defined(HAVE_ACCEPT4) && defined(HAVE_REUSEPORT)
+    using Network::ShardedListener;
+#endif
+
+    using Clock = std::chrono::steady_clock;
+
+    constexpr std::size_t client_count {32};
+    constexpr rlim_t descriptor_limit {256};
+    constexpr std::size_t shard_count {2};
+    constexpr std::chrono::seconds timeout {5};
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+#if defined(HAVE_ACCEPT4) && defined(HAVE_REUSEPORT)
+    auto test_accept(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_INET, SOCK_STREAM, 0, AI_PASSIVE};
+        ShardedListener listener {{"127.0.0.1", "0"}, hints, sr.get(),
+                                  shard_count};
+        assert(listener.shard_count() == shard_count);
+        std::atomic<std::size_t> handled {0};
+        listener.start([&](UniqueSocket socket, std::size_t shard) {
+            if (socket && shard < shard_count) {
+                ++handled;
+            }
+        });
+        std::vector<UniqueSocket> clients;
+
+        for (std::size_t i {0}; i < client_count; ++i) {
+            auto& client {clients.emplace_back(create_socket(hints,
+                                                             sr.get()))};
+            assert(!client->open(listener.name(), OpenSymbol::connect));
+        }
+
+        const auto deadline {Clock::now() + timeout};
+
+        while (listener.accepted() < client_count && Clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+
+        listener.stop();
+        assert(listener.accepted() == client_count);
+        assert(handled == client_count);
+        assert(listener.accepted(0) + listener.accepted(1) == client_count);
+        assert(!listener.error(0));
+        assert(!listener.error(1));
+    }
+
+    auto test_restart(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_INET, SOCK_STREAM, 0, AI_PASSIVE};
+        ShardedListener listener {{"127.0.0.1", "0"}, hints, sr.get(), 1};
+        listener.start([](UniqueSocket, std::size_t) {});
+        std::string actual_str;
+
+        try {
+            listener.start([](UniqueSocket, std::size_t) {});
+        }
+        catch (const LogicError& error) {
+            actual_str = error.what();
+        }
+
+        assert(actual_str == "Sharded listener is already running");
+        listener.stop();
+        listener.start([](UniqueSocket, std::size_t) {});
+    }
+
+    auto test_throw(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_INET, SOCK_STREAM, 0, AI_PASSIVE};
+        ShardedListener listener {{"127.0.0.1", "0"}, hints, sr.get(), 1};
+        listener.start([](UniqueSocket, std::size_t) {
+            throw Error {"Handler failed"};
+        });
+        auto client {create_socket(hints, sr.get())};
+        assert(!client->open(listener.name(), OpenSymbol::connect));
+        const auto deadline {Clock::now() + timeout};
+
+        while (!listener.error(0) && Clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+
+        listener.stop();
+        assert(listener.accepted() == 1);
+        assert(listener.error(0).string() == "Handler failed");
+
+        // The closed shard is skipped rather than restarted.
+        listener.start([](UniqueSocket, std::size_t) {});
+        listener.stop();
+        assert(listener.error(0).string() == "Handler failed");
+    }
+
+    auto test_transient(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_INET, SOCK_STREAM, 0, AI_PASSIVE};
+        ShardedListener listener {{"127.0.0.1", "0"}, hints, sr.get(), 1};
+        std::vector<UniqueSocket> clients;
+
+        for (std::size_t i {0}; i < client_count; ++i) {
+            clients.emplace_back(create_socket(hints, sr.get()));
+        }
+
+        // Use up every descriptor, so that accepting fails with
+        // EMFILE until some are released again.
+        rlimit limit {};
+        assert(::getrlimit(RLIMIT_NOFILE, &limit) == 0);
+        const auto saved {limit};
+        limit.rlim_cur = std::min(limit.rlim_cur, descriptor_limit);
+        assert(::setrlimit(RLIMIT_NOFILE, &limit) == 0);
+        std::vector<int> fillers;
+
+        for (auto fd {::dup(0)}; fd != -1; fd = ::dup(0)) {
+            fillers.push_back(fd);
+        }
+
+        listener.start([](UniqueSocket, std::size_t) {});
+
+        for (auto& client : clients) {
+            assert(!client->open(listener.name(), OpenSymbol::connect));
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds {200});
+        assert(listener.accepted() == 0);
+        assert(!listener.error(0));
+
+        for (const auto fd : fillers) {
+            static_cast<void>(::close(fd));
+        }
+
+        assert(::setrlimit(RLIMIT_NOFILE, &saved) == 0);
+        const auto deadline {Clock::now() + timeout};
+
+        while (listener.accepted() < client_count && Clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+
+        listener.stop();
+        assert(listener.accepted() == client_count);
+        assert(!listener.error(0));
+    }
+#endif
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+#if defined(HAVE_ACCEPT4) && defined(HAVE_REUSEPORT)
+        test_accept(sr);
+        test_restart(sr);
+        test_throw(sr);
+        test_transient(sr);
+#endif
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
@@ -0,0 +1,176 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/assert.hpp"           // assert()
+#include "network/network.hpp"          // Error, OsError, ReceiveBuffer,
+                                        // SendBuffer, SharedRuntime,
+                                        // SocketCore, SocketHints,
+                                        // TcpNoDelay, create_socket(),
+                                        // get_option(), handle_type,
+                                        // run(), set_option()
+#include "network/parse.hpp"            // parse()
+
+#include <netinet/in.h>     // IPPROTO_TCP
+#include <sys/socket.h>     // AF_INET, SOCK_STREAM
+
+#include <cerrno>       // EBADF, ENOPROTOOPT
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <iostream>     // std::cerr, std::cout, std::endl
+
+namespace
+{
+    using Network::Error;
+    using Network::OsError;
+    using Network::ReceiveBuffer;
+    using Network::SendBuffer;
+    using Network::SharedRuntime;
+    using Network::SocketCore;
+    using Network::SocketHints;
+    using Network::TcpNoDelay;
+    using Network::create_socket;
+    using Network::get_option;
+    using Network::handle_type;
+    using Network::parse;
+    using Network::run;
+    using Network::set_option;
+#ifdef SO_REUSEPORT
+    using Network::ReusePort;
+#endif
+#ifdef TCP_CORK
+    using Network::TcpCork;
+#endif
+#ifdef TCP_QUICKACK
+    using Network::TcpQuickAck;
+#endif
+
+    constexpr auto buffer_size {65536};
+    constexpr handle_type handle_bad {1000};
+    constexpr auto level_bad {IPPROTO_TCP};
+    constexpr auto name_bad {-1};
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto print(const OsError& error) -> void
+    {
+        if (is_verbose) {
+            std::cout << "Error: "
+                      << error.string()
+                      << std::endl;
+        }
+    }
+
+    auto test_bad_handle(const SharedRuntime& sr) -> void
+    {
+        const SocketCore sc {handle_bad, AF_INET, sr.get()};
+        const auto error {set_option<TcpNoDelay>(sc, true)};
+        print(error);
+        assert(error.number() == EBADF);
+        const auto result {get_option<TcpNoDelay>(sc)};
+        assert(!result);
+        print(result.error());
+        assert(result.error().number() == EBADF);
+    }
+
+    auto test_bad_name(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_INET, SOCK_STREAM, 0};
+        const auto socket {create_socket(hints, sr.get())};
+        const auto& sc {socket->core()};
+        const auto error {set_option(sc, level_bad, name_bad,
+                                     "IPPROTO_TCP, -1", 1)};
+        print(error);
+        assert(error.number() == ENOPROTOOPT);
+        const auto result {get_option(sc, level_bad, name_bad,
+                                      "IPPROTO_TCP, -1")};
+        assert(!result);
+        assert(result.error().number() == ENOPROTOOPT);
+    }
+
+    auto test_buffers(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_INET, SOCK_STREAM, 0};
+        const auto socket {create_socket(hints, sr.get())};
+        assert(!socket->set_option<ReceiveBuffer>(buffer_size));
+        assert(!socket->set_option<SendBuffer>(buffer_size));
+        const auto receive {socket->get_option<ReceiveBuffer>()};
+        const auto send {socket->get_option<SendBuffer>()};
+
+        // The kernel may round or double the requested size.
+        assert(receive && *receive >= buffer_size);
+        assert(send && *send >= buffer_size);
+    }
+
+    auto test_flags(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_INET, SOCK_STREAM, 0};
+        const auto socket {create_socket(hints, sr.get())};
+        assert(socket->get_option<TcpNoDelay>() == false);
+        assert(!socket->set_option<TcpNoDelay>(true));
+        assert(socket->get_option<TcpNoDelay>() == true);
+        assert(!socket->set_option<TcpNoDelay>(false));
+        assert(socket->get_option<TcpNoDelay>() == false);
+#ifdef SO_REUSEPORT
+        assert(!socket->set_option<ReusePort>(true));
+        assert(socket->get_option<ReusePort>() == true);
+#endif
+#ifdef TCP_CORK
+        assert(!socket->set_option<TcpCork>(true));
+        assert(socket->get_option<TcpCork>() == true);
+        assert(!socket->set_option<TcpCork>(false));
+        assert(socket->get_option<TcpCork>() == false);
+#endif
+#ifdef TCP_QUICKACK
+        assert(!socket->set_option<TcpQuickAck>(true));
+        assert(socket->get_option<TcpQuickAck>().has_value());
+#endif
+    }
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+        test_bad_handle(sr);
+        test_bad_name(sr);
+        test_buffers(sr);
+        test_flags(sr);
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
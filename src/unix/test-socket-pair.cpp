@@ -16,44 +16,79 @@
 #ifndef _WIN32
 
 #include "network/assert.hpp"           // assert()
-#include "network/network.hpp"          // Address, ByteString, Error,
+#include "network/network.hpp"          // Address, ByteString,
+                                        // CharSpan, Error,
                                         // LogicError, OsError,
                                         // Pathname, Socket,
-                                        // SocketHints, SocketPair,
-                                        // UnixSocketHints, close(),
+                                        // SocketCore, SocketHints,
+                                        // SocketPair,
+                                        // UnixSocketHints,
+                                        // accept_result(), close(),
                                         // create_socketpair(),
                                         // handle_null, handle_type,
                                         // os_error_type,
-                                        // path_length_max, run(),
-                                        // to_bytestring(), to_path()
+                                        // path_length_max,
+                                        // read_result(),
+                                        // receive_message(), run(),
+                                        // send_message(),
+                                        // set_nonblocking(),
+                                        // to_bytestring(), to_path(),
+                                        // write_result()
 #include "network/parse.hpp"            // parse()
 
-#include <sys/socket.h>     // AF_UNIX, AF_UNSPEC, SOCK_STREAM
+#include <sys/socket.h>     // AF_UNIX, AF_UNSPEC, CMSG_DATA(),
+                            // CMSG_FIRSTHDR(), CMSG_LEN(),
+                            // CMSG_SPACE(), MSG_CTRUNC, SCM_RIGHTS,
+                            // SOCK_STREAM, SOL_SOCKET, cmsghdr,
+                            // msghdr
+#include <unistd.h>         // ::close()
 
+#include <array>        // std::array
+#include <cerrno>       // EAGAIN, EINVAL, EOPNOTSUPP,
+                        // EWOULDBLOCK
+#include <cstddef>      // std::byte
 #include <cstdlib>      // EXIT_FAILURE, std::exit(),
                         // std::size_t
+#include <cstring>      // std::memcpy()
 #include <iomanip>      // std::right, std::setw()
 #include <iostream>     // std::cerr, std::cout, std::endl
 #include <regex>        // std::regex, std::regex_match
 #include <set>          // std::set
 #include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <utility>      // std::cmp_equal()
+#include <vector>       // std::vector
 
 namespace
 {
     using Network::ByteString;
+    using Network::CharSpan;
     using Network::Error;
     using Network::Pathname;
     using Network::SharedRuntime;
+    using Network::SocketCore;
     using Network::SocketHints;
     using Network::SocketPair;
+    using Network::accept_result;
     using Network::create_socketpair;
     using Network::family_type;
     using Network::handle_type;
     using Network::os_error_type;
     using Network::parse;
+    using Network::read_result;
+    using Network::receive_message;
+    using Network::run;
+    using Network::send_message;
+    using Network::set_nonblocking;
+    using Network::write_result;
+
+    using ControlBuffer = std::array<std::byte, CMSG_SPACE(sizeof(int))>;
 
     using ErrorCodeSet = std::set<os_error_type>;
 
+    constexpr auto expected_read_re {
+        R"(Call to ::read\(.+\) failed with error \d+: .+)"
+    };
     constexpr auto expected_socketpair_re {
         R"(Call to ::socketpair\(.+\) failed with error \d+: .+)"
     };
@@ -123,20 +158,127 @@ namespace
         test_socketpair(hints, expected_socketpair_re);
     }
 
+    auto test_socketpair_message(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        auto sp {create_socketpair(hints, sr.get())};
+        const SocketCore sc0 {static_cast<handle_type>(*sp[0]),
+                              AF_UNIX, sr.get()};
+        const SocketCore sc1 {static_cast<handle_type>(*sp[1]),
+                              AF_UNIX, sr.get()};
+        const auto handle {static_cast<handle_type>(*sp[0])};
+        alignas(cmsghdr) ControlBuffer send_control {};
+        msghdr msg {};
+        msg.msg_control = send_control.data();
+        msg.msg_controllen = send_control.size();
+        auto* const cmsg {CMSG_FIRSTHDR(&msg)};
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof handle);
+        std::memcpy(CMSG_DATA(cmsg), &handle, sizeof handle);
+        const std::array<std::string_view, 1> svs {"Hello"};
+        assert(std::cmp_equal(send_message(sc0, svs, send_control),
+                              svs[0].size()));
+        std::array<char, 5> buffer {};
+        const std::array<CharSpan, 1> css {buffer};
+        alignas(cmsghdr) ControlBuffer receive_control {};
+        const auto md {receive_message(sc1, css, receive_control)};
+        assert(std::cmp_equal(md.m_size, svs[0].size()));
+        assert(md.m_control_length == receive_control.size());
+        assert((md.m_flags & MSG_CTRUNC) == 0);
+        assert(std::string_view(buffer.data(), buffer.size()) == svs[0]);
+        handle_type received {};
+        std::memcpy(&received,
+                    receive_control.data() + CMSG_LEN(0),
+                    sizeof received);
+        assert(received != handle);
+        static_cast<void>(::close(received));
+    }
+
+    auto test_socketpair_result(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        auto sp {create_socketpair(hints, sr.get())};
+        const SocketCore sc0 {static_cast<handle_type>(*sp[0]),
+                              AF_UNIX, sr.get()};
+        const SocketCore sc1 {static_cast<handle_type>(*sp[1]),
+                              AF_UNIX, sr.get()};
+        assert(!set_nonblocking(sc1));
+        std::array<char, 5> buffer {};
+        const auto empty_result {read_result(sc1, buffer)};
+        assert(!empty_result);
+        const ErrorCodeSet again_codes {EAGAIN, EWOULDBLOCK};
+        assert(again_codes.contains(empty_result.error().number()));
+        const std::regex expected_regex {expected_read_re};
+        assert(std::regex_match(empty_result.error().string(),
+                                expected_regex));
+        const auto write_size {write_result(sc0, "Hello")};
+        assert(write_size && *write_size == 5);
+        const auto read_size {read_result(sc1, buffer)};
+        assert(read_size && std::cmp_equal(*read_size, buffer.size()));
+        assert(std::string_view(buffer.data(), buffer.size()) == "Hello");
+        const auto accepted {accept_result(sc0)};
+        assert(!accepted);
+        const ErrorCodeSet accept_codes {EINVAL, EOPNOTSUPP};
+        assert(accept_codes.contains(accepted.error().number()));
+    }
+
     auto test_socketpair_valid() -> void
     {
         const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
         test_socketpair(hints, "");
     }
+
+    auto test_socketpair_vectored(const SharedRuntime& sr) -> void
+    {
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        auto sp {create_socketpair(hints, sr.get())};
+        const std::array<std::string_view, 2> svs {"Head", "Payload"};
+        assert(std::cmp_equal(sp[0]->write(svs),
+                              svs[0].size() + svs[1].size()));
+        std::array<char, 4> header {};
+        std::array<char, 7> payload {};
+        const std::array<CharSpan, 2> css {header, payload};
+        assert(std::cmp_equal(sp[1]->read(css),
+                              header.size() + payload.size()));
+        assert(std::string_view(header.data(), header.size()) == svs[0]);
+        assert(std::string_view(payload.data(), payload.size()) == svs[1]);
+    }
+
+    auto test_socketpair_vectored_many(const SharedRuntime& sr) -> void
+    {
+        // More buffers than SmallVector holds inline, so the iovec
+        // list falls back to the heap.
+        constexpr std::size_t count {100};
+        const SocketHints hints {AF_UNIX, SOCK_STREAM, 0};
+        auto sp {create_socketpair(hints, sr.get())};
+        const std::vector<std::string_view> svs(count, "x");
+        assert(std::cmp_equal(sp[0]->write(svs), count));
+        std::vector<char> buffer(count);
+        std::vector<CharSpan> css;
+
+        for (auto& ch : buffer) {
+            css.emplace_back(&ch, 1);
+        }
+
+        assert(std::cmp_equal(sp[1]->read(css), count));
+        assert(std::string_view(buffer.data(), buffer.size()) ==
+               std::string(count, 'x'));
+    }
 }
 
 auto main(int argc, char* argv[]) -> int
 {
     try {
         parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
         test_socketpair_invalid_socktype();
         test_socketpair_invalid_protocol();
+        test_socketpair_message(sr);
+        test_socketpair_result(sr);
         test_socketpair_valid();
+        test_socketpair_vectored(sr);
+        test_socketpair_vectored_many(sr);
     }
     catch (const Error& error) {
         std::cerr << error.what()
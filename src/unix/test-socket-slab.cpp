@@ -0,0 +1,155 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+
+#include "network/assert.hpp"           // assert()
+#include "network/network.hpp"          // Error, SharedRuntime,
+                                        // SocketSlab, TextBuffer,
+                                        // UniqueSocket,
+                                        // create_socket(), handle_type,
+                                        // run()
+#include "network/parse.hpp"            // parse()
+#include "network/socketdata.hpp"       // SocketData
+
+#include <sys/socket.h>     // AF_UNIX, SOCK_STREAM, ::socketpair()
+
+#include <array>        // std::array
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <iostream>     // std::cerr, std::endl
+#include <string>       // std::string
+#include <utility>      // std::move()
+#include <vector>       // std::vector
+
+namespace
+{
+    using Network::Error;
+    using Network::SharedRuntime;
+    using Network::SocketData;
+    using Network::SocketSlab;
+    using Network::TextBuffer;
+    using Network::UniqueSocket;
+    using Network::create_socket;
+    using Network::handle_type;
+    using Network::parse;
+    using Network::run;
+
+    using SlabPair = std::array<UniqueSocket, 2>;
+
+    constexpr auto buffer_size {16};
+
+    auto is_verbose {false};  // NOLINT
+
+    auto parse_arguments(int argc, char** argv) -> void
+    {
+        [[maybe_unused]] const auto [args, options] {parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto create_pair(const SharedRuntime& sr, SocketSlab& slab) -> SlabPair
+    {
+        std::array<handle_type, 2> handles {};
+
+        if (::socketpair(AF_UNIX, SOCK_STREAM, 0, handles.data()) == -1) {
+            throw Error {"Call to ::socketpair() failed"};
+        }
+
+        return {
+            create_socket(SocketData {handles[0], AF_UNIX, sr.get()}, slab),
+            create_socket(SocketData {handles[1], AF_UNIX, sr.get()}, slab)
+        };
+    }
+
+    auto test_grow(const SharedRuntime& sr) -> void
+    {
+        SocketSlab slab;
+        std::vector<SlabPair> pairs;
+
+        for (std::size_t i {0}; i <= SocketSlab::chunk_slots / 2; ++i) {
+            pairs.push_back(create_pair(sr, slab));
+        }
+
+        assert(slab.size() == SocketSlab::chunk_slots + 2);
+        assert(slab.capacity() == 2 * SocketSlab::chunk_slots);
+        pairs.clear();
+        assert(slab.size() == 0);
+        assert(slab.capacity() == 2 * SocketSlab::chunk_slots);
+    }
+
+    auto test_move(const SharedRuntime& sr) -> void
+    {
+        SocketSlab slab;
+        auto sp {create_pair(sr, slab)};
+        const UniqueSocket socket {std::move(sp[0])};
+        assert(socket.get_deleter().slab() == &slab);
+        sp[1].reset();
+        assert(slab.size() == 1);
+    }
+
+    auto test_read_write(const SharedRuntime& sr) -> void
+    {
+        SocketSlab slab;
+        const auto sp {create_pair(sr, slab)};
+        assert(slab.size() == 2);
+        assert(slab.capacity() == SocketSlab::chunk_slots);
+        static_cast<void>(sp[1]->write("Hello"));
+        TextBuffer buffer {buffer_size};
+        static_cast<void>(sp[0]->read(buffer));
+        assert(std::string {buffer} == "Hello");
+    }
+
+    auto test_reuse(const SharedRuntime& sr) -> void
+    {
+        SocketSlab slab;
+        const void* slot {nullptr};
+        {
+            const auto sp {create_pair(sr, slab)};
+            slot = sp[0].get();
+        }
+        assert(slab.size() == 0);
+        const auto sp {create_pair(sr, slab)};
+        assert(sp[0].get() == slot);
+    }
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    try {
+        parse_arguments(argc, argv);
+        const auto sr {run(is_verbose)};
+        test_grow(sr);
+        test_move(sr);
+        test_read_write(sr);
+        test_reuse(sr);
+    }
+    catch (const Error& error) {
+        std::cerr << error.what()
+                  << std::endl;
+    }
+}
+
+#endif
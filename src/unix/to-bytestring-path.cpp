@@ -16,9 +16,9 @@
 #ifndef _WIN32
 
 #include "network/to-bytestring-path.hpp"       // to_bytestring()
-#include "network/bytestring.hpp"               // ByteString
 #include "network/get-path-pointer.hpp"         // get_path_pointer()
 #include "network/os-features.hpp"              // HAVE_SOCKADDR_SA_LEN
+#include "network/sockaddrstorage.hpp"          // SockAddrStorage
 #include "network/sun-offsets.hpp"              // sun_path_offset
 #include "network/to-bytestring-void.hpp"       // to_bytestring()
 #include "network/to-path-length.hpp"           // to_path_length()
@@ -28,7 +28,7 @@
 
 #include <string_view>  // std::string_view
 
-auto Network::to_bytestring(std::string_view path) -> ByteString
+auto Network::to_bytestring(std::string_view path) -> SockAddrStorage
 {
     sockaddr_un sun {};
     auto sun_len {sun_path_offset};
@@ -0,0 +1,171 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// This is the UNIX domain sequenced-packet socket example from
+// unix-client.cpp, rewritten to connect, send and receive from a
+// coroutine that suspends on an event loop.
+
+#include "network/async.hpp"            // EventLoop, Task,
+                                        // async_open(), async_read(),
+                                        // async_write(), spawn()
+#include "network/network.hpp"          // Error, OpenSymbol,
+                                        // PooledBuffer, Runtime,
+                                        // Socket, SocketCore,
+                                        // create_socket(),
+                                        // handle_type, run(),
+                                        // to_bytestring(), to_size()
+#include "network/os-features.hpp"      // HAVE_EPOLL
+#include "network/parse.hpp"            // parse()
+#include "unix/connection.hpp"          // BUFFER_SIZE, SOCKET_HINTS,
+                                        // SOCKET_NAME
+
+#include <sys/socket.h>     // AF_UNIX, SHUT_WR
+
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <cstring>      // std::strcmp()
+#include <iostream>     // std::cerr, std::cout, std::endl
+#include <string>       // std::string
+
+#ifdef HAVE_EPOLL
+
+namespace
+{
+    using Network::Error;
+    using Network::EventLoop;
+    using Network::OpenSymbol;
+    using Network::PooledBuffer;
+    using Network::Runtime;
+    using Network::Socket;
+    using Network::SocketCore;
+    using Network::Task;
+    using Network::async_open;
+    using Network::async_read;
+    using Network::async_write;
+    using Network::create_socket;
+    using Network::handle_type;
+    using Network::run;
+    using Network::spawn;
+    using Network::to_bytestring;
+    using Network::to_size;
+
+    auto is_verbose {false};  // NOLINT
+
+    auto get_core(const Socket& s, const Runtime* rt) -> SocketCore
+    {
+        return {static_cast<handle_type>(s), AF_UNIX, rt};
+    }
+
+    auto parse(int argc, char** argv)
+    {
+        const auto [operands, options] {Network::parse(argc, argv, "v")};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+
+        return operands;
+    }
+
+    auto exchange(EventLoop& loop,
+                  const Socket& s,
+                  const auto& args) -> Task<>
+    {
+        const auto core {get_core(s, loop.runtime())};
+        const auto path {to_bytestring(SOCKET_NAME)};
+
+        try {
+            // Connect Unix domain socket to pathname.
+            if (const auto error {
+                    co_await async_open(loop, core, path, OpenSymbol::connect)
+                }) {
+                std::cerr << error.string() << std::endl;
+                co_return;
+            }
+
+            // Send arguments to server.
+            for (const auto& arg : args) {
+                co_await async_write(loop, core, arg);
+
+                if (std::strcmp(arg, "DOWN") == 0) {
+                    if (const auto error {s.shutdown(SHUT_WR)}) {
+                        std::cerr << error.string() << std::endl;
+                    }
+
+                    co_return;
+                }
+            }
+
+            // Request result.
+            co_await async_write(loop, core, "END");
+
+            // Receive result.
+            PooledBuffer buffer {BUFFER_SIZE};
+            const auto length {co_await async_read(loop, core, buffer)};
+            const std::string read_str {buffer.view(to_size(length))};
+            std::cout << "Result: " << read_str << std::endl;
+        }
+        catch (const Error& error) {
+            std::cerr << error.what() << std::endl;
+        }
+    }
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    // Fetch arguments from command line.
+    const auto args {parse(argc, argv)};
+
+    try {
+        const auto sr {run(is_verbose)};
+        EventLoop loop {sr.get()};
+        const auto s {create_socket(SOCKET_HINTS, sr.get())};
+
+        if (const auto error {s->set_nonblocking(true)}) {
+            std::cerr << error.string() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        spawn(exchange(loop, *s, args));
+
+        if (const auto error {loop.run()}) {
+            std::cerr << error.string() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    catch (const Error& error) {
+        std::cerr << error.what() << std::endl;
+    }
+}
+
+#else
+
+auto main(int argc, char* argv[]) -> int
+{
+    static_cast<void>(argc);
+    std::cerr << *argv
+              << ": Event loop is not supported on this platform"
+              << std::endl;
+    return EXIT_FAILURE;
+}
+
+#endif
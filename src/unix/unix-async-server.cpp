@@ -0,0 +1,277 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// This is the UNIX domain sequenced-packet socket example from
+// unix-server.cpp, rewritten to serve all of its clients concurrently
+// from coroutines that suspend on an event loop.
+
+#include "network/assert.hpp"                   // assert()
+#include "network/async.hpp"                    // EventLoop, Task,
+                                                // async_accept(),
+                                                // async_read(),
+                                                // async_write(), spawn()
+#include "network/create-socket-acceptdata.hpp" // create_socket()
+#include "network/network.hpp"                  // Address, Error,
+                                                // PooledBuffer, Runtime,
+                                                // Socket, SocketCore, Symbol,
+                                                // UniqueSocket, bind(),
+                                                // handle_type, run(),
+                                                // to_size()
+#include "network/os-features.hpp"              // HAVE_EPOLL
+#include "network/parse.hpp"                    // parse()
+#include "unix/connection.hpp"                  // BUFFER_SIZE, SOCKET_HINTS,
+                                                // SOCKET_NAME
+
+#include <sys/socket.h>     // AF_UNIX, SHUT_RDWR
+
+#include <cstdlib>      // EXIT_FAILURE, std::exit()
+#include <iomanip>      // std::right, std::setw()
+#include <iostream>     // std::cerr, std::cout, std::endl
+#include <string>       // std::stoll(), std::string, std::to_string()
+#include <utility>      // std::move()
+
+#ifdef HAVE_EPOLL
+
+namespace
+{
+    using Network::Address;
+    using Network::Error;
+    using Network::EventLoop;
+    using Network::PooledBuffer;
+    using Network::Runtime;
+    using Network::Socket;
+    using Network::SocketCore;
+    using Network::Symbol;
+    using Network::Task;
+    using Network::UniqueSocket;
+    using Network::async_accept;
+    using Network::async_read;
+    using Network::async_write;
+    using Network::bind;
+    using Network::create_socket;
+    using Network::handle_type;
+    using Network::run;
+    using Network::spawn;
+    using Network::to_size;
+
+    using Number = long long;
+
+    constexpr auto backlog_size {20};
+    constexpr auto handle_width {6};
+    constexpr auto indent_width {handle_width + 18};
+
+    auto is_shutdown_pending {false};  // NOLINT
+    auto is_verbose {false};  // NOLINT
+
+    auto bind()
+    {
+        auto result {bind(SOCKET_NAME, SOCKET_HINTS, is_verbose)};
+
+        if (!result) {
+            std::cerr << result.error().string() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        auto& s {*result};
+
+        if (is_verbose) {
+            const Address self {s->get_sockname()};
+            // clang-format off
+            std::cout << "Socket "
+                      << std::right << std::setw(handle_width) << *s
+                      << " bound to "
+                      << self
+                      << std::endl;
+            // clang-format on
+        }
+
+        return std::move(s);
+    }
+
+    auto get_core(const Socket& s, const Runtime* rt) -> SocketCore
+    {
+        return {static_cast<handle_type>(s), AF_UNIX, rt};
+    }
+
+    auto listen(const Socket& s)
+    {
+        if (const auto error {s.listen(backlog_size)}) {
+            std::cerr << error.string() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (const auto error {s.set_nonblocking(true)}) {
+            std::cerr << error.string() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (is_verbose) {
+            // clang-format off
+            std::cout << "Socket "
+                      << std::right << std::setw(handle_width) << s
+                      << " listening with backlog "
+                      << backlog_size
+                      << std::endl;
+            // clang-format on
+        }
+    }
+
+    auto parse(int argc, char** argv)
+    {
+        const auto arguments {Network::parse(argc, argv, "v")};
+        const auto& options {arguments.second};
+
+        if (options.contains('?')) {
+            std::cerr << "Usage: "
+                      << *argv
+                      << " [-v]"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (options.contains('v')) {
+            is_verbose = true;
+        }
+    }
+
+    auto serve(EventLoop& loop,
+               const Socket& connection_socket,
+               UniqueSocket data_socket) -> Task<>
+    {
+        const auto core {get_core(*data_socket, loop.runtime())};
+        Number sum {};
+
+        try {
+            while (true) {
+                PooledBuffer buffer {BUFFER_SIZE};
+                const auto length {co_await async_read(loop, core, buffer)};
+                const std::string str {buffer.view(to_size(length))};
+
+                if (str == "DOWN") {
+                    // Quit on DOWN command.  Shutting down the
+                    // listener wakes the acceptor, and the loop ends
+                    // once the other connections are finished.
+                    is_shutdown_pending = true;
+                    static_cast<void>(connection_socket.shutdown(SHUT_RDWR));
+                    break;
+                }
+
+                if (str == "END") {
+                    // Send output sum.
+                    co_await async_write(loop, core, std::to_string(sum));
+                    break;
+                }
+
+                if (str.empty()) {
+                    // Peer closed the connection.
+                    break;
+                }
+
+                // Add received inputs.
+                sum += std::stoll(str);
+            }
+        }
+        catch (const Error& error) {
+            std::cerr << error.what() << std::endl;
+        }
+    }
+
+    auto accept(EventLoop& loop, const Socket& connection_socket) -> Task<>
+    {
+        const auto core {get_core(connection_socket, loop.runtime())};
+
+        try {
+            while (!is_shutdown_pending) {
+                // Wait for incoming connection.
+                auto data_socket {
+                    create_socket(co_await async_accept(loop, core))
+                };
+                const Address host {data_socket->get_name(Symbol::accept)};
+                const Address peer {data_socket->get_peername()};
+
+                if (is_verbose) {
+                    const Address self {data_socket->get_sockname()};
+                    // clang-format off
+                    std::cout << "Socket "
+                              << std::right << std::setw(handle_width)
+                              << *data_socket
+                              << " connected "
+                              << self
+                              << std::endl
+                              << std::right << std::setw(indent_width)
+                              << "to "
+                              << peer
+                              << std::endl;
+                    // clang-format on
+                }
+
+                assert(host.text() == peer.text());
+
+                if (const auto error {data_socket->set_nonblocking(true)}) {
+                    std::cerr << error.string() << std::endl;
+                    continue;
+                }
+
+                spawn(serve(loop, connection_socket, std::move(data_socket)));
+            }
+        }
+        catch (const Error& error) {
+            if (!is_shutdown_pending) {
+                std::cerr << error.what() << std::endl;
+            }
+        }
+    }
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    // Fetch arguments from command line.
+    parse(argc, argv);
+
+    try {
+        const auto sr {run(is_verbose)};
+        EventLoop loop {sr.get()};
+
+        // Bind Unix domain socket to pathname.
+        const auto connection_socket {bind()};
+
+        // Prepare for accepting connections without blocking.
+        listen(*connection_socket);
+
+        // Multiplex all connections on this thread.
+        spawn(accept(loop, *connection_socket));
+
+        if (const auto error {loop.run()}) {
+            std::cerr << error.string() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    catch (const Error& error) {
+        std::cerr << error.what() << std::endl;
+    }
+}
+
+#else
+
+auto main(int argc, char* argv[]) -> int
+{
+    static_cast<void>(argc);
+    std::cerr << *argv
+              << ": Event loop is not supported on this platform"
+              << std::endl;
+    return EXIT_FAILURE;
+}
+
+#endif
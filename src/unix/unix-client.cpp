@@ -17,10 +17,10 @@
 // example in https://www.man7.org/linux/man-pages/man7/unix.7.html.
 
 #include "network/assert.hpp"           // assert()
-#include "network/network.hpp"          // Address, Error, Socket,
-                                        // Symbol, TextBuffer,
-                                        // UniqueSocket, connect(),
-                                        // socket_error
+#include "network/network.hpp"          // Address, Error, PooledBuffer,
+                                        // Socket, Symbol, UniqueSocket,
+                                        // connect(), socket_error,
+                                        // to_size()
 #include "network/parse.hpp"            // parse()
 #include "unix/connection.hpp"          // BUFFER_SIZE, SOCKET_HINTS,
                                         // SOCKET_NAME
@@ -43,12 +43,13 @@ namespace
 {
     using Network::Address;
     using Network::Error;
+    using Network::PooledBuffer;
     using Network::Socket;
     using Network::Symbol;
-    using Network::TextBuffer;
     using Network::UniqueSocket;
     using Network::connect;
     using Network::socket_error;
+    using Network::to_size;
 
     constexpr auto handle_width {6};
     constexpr auto indent_width {handle_width + 18};
@@ -112,15 +113,15 @@ namespace
 
     auto read(const Socket& s) -> std::string
     {
-        TextBuffer buffer {BUFFER_SIZE};
-        const auto error {s.read(buffer)};
+        PooledBuffer buffer {BUFFER_SIZE};
+        const auto length {s.read(buffer)};
 
-        if (error == socket_error) {
+        if (length == socket_error) {
             std::perror("read");
             std::exit(EXIT_FAILURE);
         }
 
-        return buffer;
+        return std::string {buffer.view(to_size(length))};
     }
 
     auto shutdown(const Socket& s)
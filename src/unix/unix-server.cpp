@@ -17,10 +17,13 @@
 // example in https://www.man7.org/linux/man-pages/man7/unix.7.html.
 
 #include "network/assert.hpp"           // assert()
-#include "network/network.hpp"          // Address, Error, Socket,
-                                        // Symbol, TextBuffer,
-                                        // UniqueSocket, accept(),
-                                        // bind(), socket_error
+#include "network/eventloop.hpp"        // EventLoop
+#include "network/network.hpp"          // Address, Error, PooledBuffer,
+                                        // Socket, Symbol, UniqueSocket,
+                                        // accept(), bind(),
+                                        // handle_type, run(),
+                                        // socket_error, to_size()
+#include "network/os-features.hpp"      // HAVE_EPOLL
 #include "network/parse.hpp"            // parse()
 #include "unix/connection.hpp"          // BUFFER_SIZE, SOCKET_HINTS,
                                         // SOCKET_NAME
@@ -36,13 +39,19 @@ namespace
 {
     using Network::Address;
     using Network::Error;
+    using Network::PooledBuffer;
     using Network::Socket;
     using Network::Symbol;
-    using Network::TextBuffer;
     using Network::UniqueSocket;
     using Network::accept;
     using Network::bind;
+    using Network::handle_type;
+    using Network::run;
     using Network::socket_error;
+    using Network::to_size;
+#ifdef HAVE_EPOLL
+    using Network::EventLoop;
+#endif
 
     using Number = long long;
 
@@ -50,6 +59,7 @@ namespace
     constexpr auto handle_width {6};
     constexpr auto indent_width {handle_width + 18};
 
+    auto is_event_driven {false};  // NOLINT
     auto is_verbose {false};  // NOLINT
 
     auto accept(const UniqueSocket& s1)
@@ -121,17 +131,28 @@ namespace
 
     auto parse(int argc, char** argv)
     {
-        const auto arguments {Network::parse(argc, argv, "v")};
+        const auto arguments {Network::parse(argc, argv, "ev")};
         const auto& options {arguments.second};
 
         if (options.contains('?')) {
             std::cerr << "Usage: "
                       << *argv
-                      << " [-v]"
+                      << " [-e] [-v]"
                       << std::endl;
             std::exit(EXIT_FAILURE);
         }
 
+        if (options.contains('e')) {
+#ifdef HAVE_EPOLL
+            is_event_driven = true;
+#else
+            std::cerr << *argv
+                      << ": Event loop is not supported on this platform"
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+#endif
+        }
+
         if (options.contains('v')) {
             is_verbose = true;
         }
@@ -139,15 +160,15 @@ namespace
 
     auto read(const Socket& s) -> std::string
     {
-        TextBuffer buffer {BUFFER_SIZE};
-        const auto error {s.read(buffer)};
+        PooledBuffer buffer {BUFFER_SIZE};
+        const auto length {s.read(buffer)};
 
-        if (error == socket_error) {
+        if (length == socket_error) {
             std::perror("read");
             std::exit(EXIT_FAILURE);
         }
 
-        return buffer;
+        return std::string {buffer.view(to_size(length))};
     }
 
     auto write(const Socket& s, auto value)
@@ -160,22 +181,11 @@ namespace
             std::exit(EXIT_FAILURE);
         }
     }
-}
 
-auto main(int argc, char* argv[]) -> int
-{
-    // Fetch arguments from command line.
-    parse(argc, argv);
-
-    try {
-        // Bind Unix domain socket to pathname.
-        const auto connection_socket {bind()};
+    auto serve(const UniqueSocket& connection_socket)
+    {
         auto shutdown_pending {false};
 
-        // Prepare for accepting connections. While one request is
-        // being processed other requests can be waiting.
-        listen(*connection_socket);
-
         // This is the main loop for handling connections.
         while (!shutdown_pending) {
             // Wait for incoming connection.
@@ -200,6 +210,96 @@ auto main(int argc, char* argv[]) -> int
             }
         }
     }
+
+#ifdef HAVE_EPOLL
+    auto serve_events(const UniqueSocket& connection_socket)
+    {
+        const auto sr {run(is_verbose)};
+        EventLoop loop {sr.get()};
+
+        // Each accepted connection keeps its own running sum and is
+        // owned by the event loop until the client is done with it.
+        auto on_accept = [&](handle_type, EventLoop::Events) {
+            auto data_socket {accept(connection_socket)};
+            const auto& s {*data_socket};
+
+            if (const auto error {s.set_nonblocking(true)}) {
+                std::cerr << error.string() << std::endl;
+                std::exit(EXIT_FAILURE);
+            }
+
+            auto on_read = [&loop, &s, sum = Number {}]
+                (handle_type handle, EventLoop::Events) mutable {
+                const auto str {read(s)};
+
+                if (str == "DOWN") {
+                    // Quit on DOWN command.
+                    loop.stop();
+                }
+                else if (str == "END") {
+                    // Send output sum.
+                    write(s, sum);
+                    static_cast<void>(loop.remove(handle));
+                }
+                else if (str.empty()) {
+                    // Peer closed the connection.
+                    static_cast<void>(loop.remove(handle));
+                }
+                else {
+                    // Add received inputs.
+                    sum += std::stoll(str);
+                }
+            };
+
+            if (const auto error {loop.add(std::move(data_socket),
+                                           EventLoop::events_read,
+                                           on_read)}) {
+                std::cerr << error.string() << std::endl;
+                std::exit(EXIT_FAILURE);
+            }
+        };
+
+        if (const auto error {loop.add(static_cast<handle_type>
+                                       (*connection_socket),
+                                       EventLoop::events_read,
+                                       on_accept)}) {
+            std::cerr << error.string() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (const auto error {loop.run()}) {
+            std::cerr << error.string() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+#endif
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    // Fetch arguments from command line.
+    parse(argc, argv);
+
+    try {
+        // Bind Unix domain socket to pathname.
+        const auto connection_socket {bind()};
+
+        // Prepare for accepting connections. While one request is
+        // being processed other requests can be waiting.
+        listen(*connection_socket);
+
+#ifdef HAVE_EPOLL
+        if (is_event_driven) {
+            // Multiplex all connections on this thread.
+            serve_events(connection_socket);
+        }
+        else
+#endif
+        {
+            // Handle one connection at a time.
+            serve(connection_socket);
+        }
+    }
     catch (const Error& error) {
         std::cerr << error.what() << std::endl;
     }
@@ -22,9 +22,10 @@
 #include "network/socketdata.hpp"       // SocketData
 #include "network/socketstate.hpp"      // SocketState
 #include "network/to-path.hpp"          // to_path()
+#include "network/trace.hpp"            // trace()
 
 #include <filesystem>   // std::filesystem
-#include <iostream>     // std::cout, std::endl
+#include <ostream>      // std::ostream
 
 Network::UnixSocket::UnixSocket(const SocketData& t_sd) : InetSocket(t_sd)
 {
@@ -59,12 +60,11 @@ auto Network::UnixSocket::remove(const PathnameView& t_path) const -> bool
         return false;
     }
 
-    if (core().runtime()->is_verbose()) {
-        std::cout << "Calling std::filesystem::remove("
-                  << t_path
-                  << ')'
-                  << std::endl;
-    }
+    trace(core().tracer(), [&](std::ostream& os) {
+        os << "Calling std::filesystem::remove("
+           << t_path
+           << ')';
+    });
 
     return std::filesystem::remove(t_path);
 }
@@ -15,62 +15,69 @@
 
 #ifndef _WIN32
 
-#include "network/write.hpp"            // write()
-#include "network/error.hpp"            // Error
-#include "network/format-os-error.hpp"  // format_os_error()
+#include "network/write-result.hpp"     // write_result()
 #include "network/get-api-error.hpp"    // get_api_error()
+#include "network/iocounter.hpp"        // IoCounter
+#include "network/oserror.hpp"          // OsError
 #include "network/quote.hpp"            // quote()
 #include "network/reset-api-error.hpp"  // reset_api_error()
+#include "network/sizeresult.hpp"       // SizeResult
 #include "network/socket-error.hpp"     // socket_error
 #include "network/socketcore.hpp"       // SocketCore
+#include "network/systemcall.hpp"       // SystemCall
 #include "network/to-os-error.hpp"      // to_os_error()
+#include "network/trace.hpp"            // trace()
 
 #include <sys/types.h>      // ssize_t
 #include <unistd.h>         // ::write()
 
-#include <iostream>     // std::cout, std::endl
-#include <sstream>      // std::ostringstream
+#include <cstdint>      // std::int64_t, std::uint64_t
+#include <expected>     // std::unexpected
+#include <ostream>      // std::ostream
 #include <string_view>  // std::string_view
 
-auto Network::write(const SocketCore& sc, std::string_view sv) -> ssize_t
+auto Network::write_result(const SocketCore& sc,
+                           std::string_view sv) -> SizeResult
 {
     const auto handle {sc.handle()};
 
-    if (sc.runtime()->is_verbose()) {
+    trace(sc.tracer(), [&](std::ostream& os) {
         // clang-format off
-        std::cout << "Calling ::write("
-                  << handle
-                  << ", "
-                  << quote(sv)
-                  << ", "
-                  << sv.size()
-                  << ')'
-                  << std::endl;
+        os << "Calling ::write("
+           << handle
+           << ", "
+           << quote(sv)
+           << ", "
+           << sv.size()
+           << ')';
         // clang-format on
-    }
+    });
 
+    sc.count(IoCounter::system_calls);
     reset_api_error();
     const auto ssize {::write(handle, sv.data(), sv.size())};
 
     if (ssize == socket_error) {
         const auto api_error {get_api_error()};
         const auto os_error {to_os_error(api_error)};
-        std::ostringstream oss;
-        // clang-format off
-        oss << "Call to ::write("
-            << handle
-            << ", "
-            << quote(sv)
-            << ", "
-            << sv.size()
-            << ") failed with error "
-            << api_error
-            << ": "
-            << format_os_error(os_error);
-        // clang-format on
-        throw Error {oss.str()};
+        sc.count_error(os_error);
+        const SystemCall call {
+            .m_name = "::write",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", ..., "
+                   << t_call.m_values[0];
+                // clang-format on
+            },
+            .m_values = {static_cast<std::int64_t>(sv.size())},
+            .m_handle = handle,
+        };
+        return std::unexpected {OsError {os_error, api_error, call}};
     }
 
+    sc.count(IoCounter::bytes_written, static_cast<std::uint64_t>(ssize));
+
     return ssize;
 }
 
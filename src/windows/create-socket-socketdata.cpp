@@ -1,4 +1,4 @@
-// Copyright (C) 2022  "Michael G. Morey" <mgmorey@gmail.com>
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -18,13 +18,30 @@
 #include "network/create-socket-socketdata.hpp" // create_socket()
 #include "network/inetsocket.hpp"               // InetSocket
 #include "network/socketdata.hpp"               // SocketData
+#include "network/socketdeleter.hpp"            // SocketDeleter
+#include "network/socketslab.hpp"               // SocketSlab
 #include "network/uniquesocket.hpp"             // UniqueSocket
 
 #include <memory>       // std::make_unique()
+#include <new>          // ::new
 
 auto Network::create_socket(const SocketData& sd) -> UniqueSocket
 {
     return std::make_unique<InetSocket>(sd);
 }
 
+auto Network::create_socket(const SocketData& sd,
+                            SocketSlab& slab) -> UniqueSocket
+{
+    auto* const slot {slab.allocate()};
+
+    try {
+        return {::new (slot) InetSocket {sd}, SocketDeleter {&slab}};
+    }
+    catch (...) {
+        slab.deallocate(slot);
+        throw;
+    }
+}
+
 #endif
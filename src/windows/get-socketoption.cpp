@@ -0,0 +1,100 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifdef _WIN32
+
+#include "network/get-socketoption.hpp" // get_option()
+#include "network/get-api-error.hpp"    // get_api_error()
+#include "network/iocounter.hpp"        // IoCounter
+#include "network/oserror.hpp"          // OsError
+#include "network/reset-api-error.hpp"  // reset_api_error()
+#include "network/socket-error.hpp"     // socket_error
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/systemcall.hpp"       // SystemCall
+#include "network/to-os-error.hpp"      // to_os_error()
+#include "network/trace.hpp"            // trace()
+
+#include <winsock2.h>       // ::getsockopt()
+
+#include <expected>     // std::expected, std::unexpected
+#include <ostream>      // std::ostream
+#include <string_view>  // std::string_view
+
+auto Network::get_option(const SocketCore& sc,
+                         int level,
+                         int name,
+                         std::string_view string) ->
+    std::expected<int, OsError>
+{
+    const auto handle {sc.handle()};
+    int value {0};
+    int length {sizeof value};
+    auto* const data {reinterpret_cast<char*>(&value)};  // NOLINT
+
+    trace(sc.tracer(), [&](std::ostream& os) {
+        // clang-format off
+        os << "Calling ::getsockopt("
+           << handle
+           << ", "
+           << string
+           << ", ..., "
+           << length
+           << ')';
+        // clang-format on
+    });
+
+    sc.count(IoCounter::system_calls);
+    reset_api_error();
+
+    if (::getsockopt(handle, level, name,
+                     data, &length) == socket_error) {
+        const auto api_error {get_api_error()};
+        const auto os_error {to_os_error(api_error)};
+        sc.count_error(os_error);
+        const SystemCall call {
+            .m_name = "::getsockopt",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", "
+                   << t_call.m_detail
+                   << ", ..., "
+                   << t_call.m_values[0];
+                // clang-format on
+            },
+            .m_detail = string,
+            .m_values = {length},
+            .m_handle = handle,
+        };
+        return std::unexpected {OsError {os_error, api_error, call}};
+    }
+
+    trace(sc.tracer(), [&](std::ostream& os) {
+        // clang-format off
+        os << "Call to ::getsockopt("
+           << handle
+           << ", "
+           << string
+           << ", ..., "
+           << length
+           << ") returned data "
+           << value;
+        // clang-format on
+    });
+
+    return value;
+}
+
+#endif
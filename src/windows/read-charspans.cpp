@@ -0,0 +1,114 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifdef _WIN32
+
+#include "network/read-charspans.hpp"   // read()
+#include "network/charspan.hpp"         // CharSpan
+#include "network/error.hpp"            // Error
+#include "network/get-api-error.hpp"    // get_api_error()
+#include "network/iocounter.hpp"        // IoCounter
+#include "network/oserror.hpp"          // OsError
+#include "network/quote-charspans.hpp"  // quote()
+#include "network/reset-api-error.hpp"  // reset_api_error()
+#include "network/smallvector.hpp"      // SmallVector
+#include "network/socket-error.hpp"     // socket_error
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/systemcall.hpp"       // SystemCall
+#include "network/to-os-error.hpp"      // to_os_error()
+#include "network/trace.hpp"            // trace()
+
+#include <sys/types.h>      // ssize_t
+#include <winsock2.h>       // DWORD, ULONG, WSABUF, ::WSARecv()
+
+#include <algorithm>    // std::ranges::transform()
+#include <cstdint>      // std::uint64_t
+#include <ostream>      // std::ostream
+#include <span>         // std::span
+
+auto Network::read(const SocketCore& sc,
+                   std::span<const CharSpan> css) -> ssize_t
+{
+    const auto handle {sc.handle()};
+    auto* const tracer {sc.tracer()};
+    SmallVector<WSABUF> storage {css.size()};
+    const auto buffers {storage.span()};
+    std::ranges::transform(css, buffers.begin(), [](CharSpan cs) {
+        return WSABUF {static_cast<ULONG>(cs.size()), cs.data()};
+    });
+    const auto buffer_count {static_cast<DWORD>(buffers.size())};
+    DWORD flags {0};
+    DWORD size {0};
+
+    trace(tracer, [&](std::ostream& os) {
+        // clang-format off
+        os << "Calling ::WSARecv("
+           << handle
+           << ", "
+           << quote(css)
+           << ", "
+           << buffer_count
+           << ", ...)";
+        // clang-format on
+    });
+
+    sc.count(IoCounter::system_calls);
+    reset_api_error();
+
+    if (::WSARecv(handle,
+                  buffers.data(),
+                  buffer_count,
+                  &size,
+                  &flags,
+                  nullptr,
+                  nullptr) == socket_error) {
+        const auto api_error {get_api_error()};
+        const auto os_error {to_os_error(api_error)};
+        sc.count_error(os_error);
+        const SystemCall call {
+            .m_name = "::WSARecv",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", ..., "
+                   << t_call.m_values[0]
+                   << ", ...";
+                // clang-format on
+            },
+            .m_values = {buffer_count},
+            .m_handle = handle,
+        };
+        throw Error {OsError {os_error, api_error, call}};
+    }
+
+    sc.count(IoCounter::bytes_read, static_cast<std::uint64_t>(size));
+
+    trace(tracer, [&](std::ostream& os) {
+        // clang-format off
+        os << "Call to ::WSARecv("
+           << handle
+           << ", "
+           << quote(css)
+           << ", "
+           << buffer_count
+           << ", ...) returned data "
+           << quote(css, size);
+        // clang-format on
+    });
+
+    return static_cast<ssize_t>(size);
+}
+
+#endif
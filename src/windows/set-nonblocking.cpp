@@ -0,0 +1,72 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifdef _WIN32
+
+#include "network/set-nonblocking.hpp"  // set_nonblocking()
+#include "network/get-api-error.hpp"    // get_api_error()
+#include "network/oserror.hpp"          // OsError
+#include "network/reset-api-error.hpp"  // reset_api_error()
+#include "network/socket-error.hpp"     // socket_error
+#include "network/socketcore.hpp"       // SocketCore
+#include "network/systemcall.hpp"       // SystemCall
+#include "network/to-os-error.hpp"      // to_os_error()
+#include "network/trace.hpp"            // trace()
+
+#include <winsock2.h>       // FIONBIO, u_long, ::ioctlsocket()
+
+#include <cstdint>      // std::int64_t
+#include <ostream>      // std::ostream
+
+auto Network::set_nonblocking(const SocketCore& sc,
+                              bool is_nonblocking) -> OsError
+{
+    const auto handle {sc.handle()};
+    u_long mode {is_nonblocking ? 1UL : 0UL};
+
+    trace(sc.tracer(), [&](std::ostream& os) {
+        // clang-format off
+        os << "Calling ::ioctlsocket("
+           << handle
+           << ", FIONBIO, "
+           << mode
+           << ')';
+        // clang-format on
+    });
+
+    reset_api_error();
+
+    if (::ioctlsocket(handle, FIONBIO, &mode) == socket_error) {
+        const auto api_error {get_api_error()};
+        const auto os_error {to_os_error(api_error)};
+        const SystemCall call {
+            .m_name = "::ioctlsocket",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", FIONBIO, "
+                   << t_call.m_values[0];
+                // clang-format on
+            },
+            .m_values = {static_cast<std::int64_t>(mode)},
+            .m_handle = handle,
+        };
+        return {os_error, api_error, call};
+    }
+
+    return {};
+}
+
+#endif
@@ -0,0 +1,102 @@
+// Copyright (C) 2026  "Michael G. Morey" <mgmorey@gmail.com>
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifdef _WIN32
+
+#include "network/write-stringviews.hpp"        // write()
+#include "network/error.hpp"                    // Error
+#include "network/get-api-error.hpp"            // get_api_error()
+#include "network/iocounter.hpp"                // IoCounter
+#include "network/oserror.hpp"                  // OsError
+#include "network/quote-stringviews.hpp"        // quote()
+#include "network/reset-api-error.hpp"          // reset_api_error()
+#include "network/smallvector.hpp"              // SmallVector
+#include "network/socket-error.hpp"             // socket_error
+#include "network/socketcore.hpp"               // SocketCore
+#include "network/systemcall.hpp"               // SystemCall
+#include "network/to-os-error.hpp"              // to_os_error()
+#include "network/trace.hpp"                    // trace()
+
+#include <sys/types.h>      // ssize_t
+#include <winsock2.h>       // DWORD, ULONG, WSABUF, ::WSASend()
+
+#include <algorithm>    // std::ranges::transform()
+#include <cstdint>      // std::uint64_t
+#include <ostream>      // std::ostream
+#include <span>         // std::span
+#include <string_view>  // std::string_view
+
+auto Network::write(const SocketCore& sc,
+                    std::span<const std::string_view> svs) -> ssize_t
+{
+    const auto handle {sc.handle()};
+    SmallVector<WSABUF> storage {svs.size()};
+    const auto buffers {storage.span()};
+    std::ranges::transform(svs, buffers.begin(), [](std::string_view sv) {
+        // ::WSASend() does not modify the buffers despite the
+        // non-const pointer in WSABUF.
+        return WSABUF {static_cast<ULONG>(sv.size()),
+                       const_cast<char*>(sv.data())};  // NOLINT
+    });
+    const auto buffer_count {static_cast<DWORD>(buffers.size())};
+    DWORD size {0};
+
+    trace(sc.tracer(), [&](std::ostream& os) {
+        // clang-format off
+        os << "Calling ::WSASend("
+           << handle
+           << ", "
+           << quote(svs)
+           << ", "
+           << buffer_count
+           << ", ...)";
+        // clang-format on
+    });
+
+    sc.count(IoCounter::system_calls);
+    reset_api_error();
+
+    if (::WSASend(handle,
+                  buffers.data(),
+                  buffer_count,
+                  &size,
+                  0,
+                  nullptr,
+                  nullptr) == socket_error) {
+        const auto api_error {get_api_error()};
+        const auto os_error {to_os_error(api_error)};
+        sc.count_error(os_error);
+        const SystemCall call {
+            .m_name = "::WSASend",
+            .m_arguments = [](std::ostream& os, const SystemCall& t_call) {
+                // clang-format off
+                os << t_call.m_handle
+                   << ", ..., "
+                   << t_call.m_values[0]
+                   << ", ...";
+                // clang-format on
+            },
+            .m_values = {buffer_count},
+            .m_handle = handle,
+        };
+        throw Error {OsError {os_error, api_error, call}};
+    }
+
+    sc.count(IoCounter::bytes_written, static_cast<std::uint64_t>(size));
+
+    return static_cast<ssize_t>(size);
+}
+
+#endif